@@ -0,0 +1,612 @@
+/********************************************************************************
+* allocator.c: Innehller definitioner av arena-, pool- och
+*              storblocksallokerarna som implementerar grnssnittet allocator.
+********************************************************************************/
+#define _GNU_SOURCE /* Krvs fr mremap. */
+#include "allocator.h"
+
+#include <stdint.h> /* Innehller SIZE_MAX. */
+#include <string.h> /* Innehller memcpy. */
+
+#ifdef __linux__
+#include <sys/mman.h> /* Innehller mmap, mremap, munmap och madvise. */
+#include <unistd.h>   /* Innehller sysconf. */
+#endif
+
+/********************************************************************************
+* ARENA_HEADER: Storlek i byte fr ett blockhuvud, avrundat uppt s att
+*               blockets data fr arenans justering.
+********************************************************************************/
+#define ARENA_HEADER \
+   ((sizeof(struct arena_chunk) + ARENA_ALIGNMENT - 1) & ~(size_t)(ARENA_ALIGNMENT - 1))
+
+/********************************************************************************
+* POOL_HEADER: Storlek i byte fr ett plattshuvud, avrundat uppt s att
+*              plattans block fr samma justering som arenans allokeringar.
+********************************************************************************/
+#define POOL_HEADER \
+   ((sizeof(struct pool_slab) + ARENA_ALIGNMENT - 1) & ~(size_t)(ARENA_ALIGNMENT - 1))
+
+/********************************************************************************
+* align_up: Returnerar angivet antal byte avrundat uppt till nrmaste multipel
+*           av angiven justering, som mste vara en tvpotens. Vid verslag
+*           returneras 0.
+*
+*           - size     : Antalet byte som ska avrundas.
+*           - alignment: Justeringen i byte.
+********************************************************************************/
+static inline size_t align_up(const size_t size,
+                              const size_t alignment)
+{
+   if (size > SIZE_MAX - (alignment - 1)) return 0;
+   return (size + alignment - 1) & ~(alignment - 1);
+}
+
+/********************************************************************************
+* chunk_data: Returnerar adressen till angivet blocks data.
+*
+*             - chunk: Pekare till blocket.
+********************************************************************************/
+static inline unsigned char* chunk_data(struct arena_chunk* chunk)
+{
+   return (unsigned char*)chunk + ARENA_HEADER;
+}
+
+/********************************************************************************
+* arena_next_chunk: Gr ett block med plats fr minst angivet antal byte till
+*                   arenans aktuella block. Efterfljande block som redan r
+*                   allokerade (efter en terstllning) teranvnds om de r
+*                   tillrckligt stora, annars allokeras ett nytt block som
+*                   lnkas in efter aktuellt block. Vid lyckad allokering
+*                   returneras 0, annars felkod 1.
+*
+*                   - self: Pekare till arenan.
+*                   - size: Antalet byte som blocket minst ska rymma.
+********************************************************************************/
+static int arena_next_chunk(struct arena_allocator* self,
+                            const size_t size)
+{
+   struct arena_chunk* next = self->current ? self->current->next : self->first;
+   struct arena_chunk* chunk = 0;
+
+   if (next && next->capacity >= size)
+   {
+      chunk = next;
+   }
+   else
+   {
+      const size_t capacity = size > self->chunk_size ? size : self->chunk_size;
+      if (capacity > SIZE_MAX - ARENA_HEADER) return 1;
+      chunk = (struct arena_chunk*)malloc(ARENA_HEADER + capacity);
+      if (!chunk) return 1;
+      chunk->capacity = capacity;
+      chunk->next = next;
+
+      if (self->current) self->current->next = chunk;
+      else self->first = chunk;
+   }
+
+   self->current = chunk;
+   self->offset = 0;
+   return 0;
+}
+
+/********************************************************************************
+* arena_allocate: Allokerar angivet antal byte frn arenan genom att flytta
+*                 fram arenans position i aktuellt block.
+*
+*                 - context: Pekare till arenan.
+*                 - size   : Antalet byte som ska allokeras.
+********************************************************************************/
+static void* arena_allocate(void* context,
+                            size_t size)
+{
+   struct arena_allocator* self = (struct arena_allocator*)context;
+   void* block = 0;
+
+   size = align_up(size ? size : 1, ARENA_ALIGNMENT);
+   if (!size) return 0;
+
+   if (!self->current || self->current->capacity - self->offset < size)
+   {
+      if (arena_next_chunk(self, size)) return 0;
+   }
+
+   block = chunk_data(self->current) + self->offset;
+   self->offset += size;
+   self->last = block;
+   return block;
+}
+
+/********************************************************************************
+* arena_reallocate: Omallokerar angivet minne frn arenan. Om minnet utgr
+*                   arenans senaste allokering och ryms i aktuellt block sker
+*                   omallokeringen p plats, annars allokeras nytt minne dit
+*                   befintligt innehll kopieras. Det gamla minnet frigrs
+*                   inte frrn arenan terstlls.
+*
+*                   - context : Pekare till arenan.
+*                   - block   : Pekare till minnet (eller null).
+*                   - old_size: Minnets nuvarande storlek i byte.
+*                   - new_size: Minnets storlek i byte efter omallokeringen.
+********************************************************************************/
+static void* arena_reallocate(void* context,
+                              void* block,
+                              size_t old_size,
+                              size_t new_size)
+{
+   struct arena_allocator* self = (struct arena_allocator*)context;
+   void* copy = 0;
+
+   if (!block) return arena_allocate(self, new_size);
+
+   if (block == self->last)
+   {
+      const size_t start = (size_t)((unsigned char*)block - chunk_data(self->current));
+      const size_t size = align_up(new_size ? new_size : 1, ARENA_ALIGNMENT);
+
+      if (size && size <= self->current->capacity - start)
+      {
+         self->offset = start + size;
+         return block;
+      }
+   }
+
+   if (new_size <= old_size) return block;
+   copy = arena_allocate(self, new_size);
+   if (!copy) return 0;
+   memcpy(copy, block, old_size);
+   return copy;
+}
+
+/********************************************************************************
+* arena_deallocate: Frigr angivet minne frn arenan. Endast arenans senaste
+*                   allokering kan frigras, genom att arenans position flyttas
+*                   tillbaka. vrigt minne frigrs frst nr arenan terstlls.
+*
+*                   - context: Pekare till arenan.
+*                   - block  : Pekare till minnet (eller null).
+*                   - size   : Minnets storlek i byte.
+********************************************************************************/
+static void arena_deallocate(void* context,
+                             void* block,
+                             size_t size)
+{
+   struct arena_allocator* self = (struct arena_allocator*)context;
+   (void)size;
+
+   if (block && block == self->last)
+   {
+      self->offset = (size_t)((unsigned char*)block - chunk_data(self->current));
+      self->last = 0;
+   }
+   return;
+}
+
+/********************************************************************************
+* arena_allocator_init: Initierar angiven arena, dr minne allokeras i block
+*                       om minst angiven storlek frst vid behov.
+*
+*                       - self      : Pekare till arenan som ska initieras.
+*                       - chunk_size: Minsta storlek i byte fr arenans block.
+********************************************************************************/
+void arena_allocator_init(struct arena_allocator* self,
+                          const size_t chunk_size)
+{
+   self->base.allocate = arena_allocate;
+   self->base.reallocate = arena_reallocate;
+   self->base.deallocate = arena_deallocate;
+   self->base.context = self;
+   self->first = 0;
+   self->current = 0;
+   self->offset = 0;
+   self->chunk_size = align_up(chunk_size ? chunk_size : 1, ARENA_ALIGNMENT);
+   self->last = 0;
+   return;
+}
+
+/********************************************************************************
+* arena_allocator_reset: terstller angiven arena p konstant tid, varefter
+*                        samtliga tidigare allokeringar r ogiltiga. Arenans
+*                        block behlls och teranvnds fr nya allokeringar.
+*
+*                        - self: Pekare till arenan som ska terstllas.
+********************************************************************************/
+void arena_allocator_reset(struct arena_allocator* self)
+{
+   self->current = self->first;
+   self->offset = 0;
+   self->last = 0;
+   return;
+}
+
+/********************************************************************************
+* arena_allocator_clear: Frigr samtliga block allokerade fr angiven arena.
+*
+*                        - self: Pekare till arenan som ska tmmas.
+********************************************************************************/
+void arena_allocator_clear(struct arena_allocator* self)
+{
+   struct arena_chunk* chunk = self->first;
+
+   while (chunk)
+   {
+      struct arena_chunk* next = chunk->next;
+      free(chunk);
+      chunk = next;
+   }
+
+   arena_allocator_init(self, self->chunk_size);
+   return;
+}
+
+/********************************************************************************
+* pool_add_slab: Allokerar en ny platta fr angiven pool och lgger till
+*                plattans block i poolens fri-lista. Vid lyckad allokering
+*                returneras 0, annars felkod 1.
+*
+*                - self: Pekare till poolen.
+********************************************************************************/
+static int pool_add_slab(struct pool_allocator* self)
+{
+   struct pool_slab* slab = 0;
+   unsigned char* block = 0;
+
+   if (self->slab_blocks > (SIZE_MAX - POOL_HEADER) / self->block_size) return 1;
+   slab = (struct pool_slab*)malloc(POOL_HEADER + self->slab_blocks * self->block_size);
+   if (!slab) return 1;
+
+   slab->next = self->slabs;
+   self->slabs = slab;
+   block = (unsigned char*)slab + POOL_HEADER;
+
+   for (size_t i = 0; i < self->slab_blocks; ++i)
+   {
+      *(void**)block = self->free_list;
+      self->free_list = block;
+      block += self->block_size;
+   }
+
+   return 0;
+}
+
+/********************************************************************************
+* pool_allocate: Allokerar ett block frn poolen. Om angivet antal byte
+*                verstiger poolens blockstorlek returneras null.
+*
+*                - context: Pekare till poolen.
+*                - size   : Antalet byte som ska allokeras.
+********************************************************************************/
+static void* pool_allocate(void* context,
+                           size_t size)
+{
+   struct pool_allocator* self = (struct pool_allocator*)context;
+   void* block = 0;
+
+   if (size > self->block_size) return 0;
+   if (!self->free_list && pool_add_slab(self)) return 0;
+
+   block = self->free_list;
+   self->free_list = *(void**)block;
+   return block;
+}
+
+/********************************************************************************
+* pool_reallocate: Omallokerar angivet block frn poolen. Eftersom samtliga
+*                  block har samma storlek returneras samma block s lnge
+*                  ny storlek ryms i blocket, annars returneras null.
+*
+*                  - context : Pekare till poolen.
+*                  - block   : Pekare till blocket (eller null).
+*                  - old_size: Blockets nuvarande storlek i byte.
+*                  - new_size: Blockets storlek i byte efter omallokeringen.
+********************************************************************************/
+static void* pool_reallocate(void* context,
+                             void* block,
+                             size_t old_size,
+                             size_t new_size)
+{
+   struct pool_allocator* self = (struct pool_allocator*)context;
+   (void)old_size;
+
+   if (!block) return pool_allocate(self, new_size);
+   return new_size <= self->block_size ? block : 0;
+}
+
+/********************************************************************************
+* pool_deallocate: Lmnar tillbaka angivet block till poolens fri-lista.
+*
+*                  - context: Pekare till poolen.
+*                  - block  : Pekare till blocket (eller null).
+*                  - size   : Blockets storlek i byte.
+********************************************************************************/
+static void pool_deallocate(void* context,
+                            void* block,
+                            size_t size)
+{
+   struct pool_allocator* self = (struct pool_allocator*)context;
+   (void)size;
+
+   if (block)
+   {
+      *(void**)block = self->free_list;
+      self->free_list = block;
+   }
+   return;
+}
+
+/********************************************************************************
+* pool_allocator_init: Initierar angiven pool fr block av angiven storlek,
+*                      dr minne allokeras i plattor om angivet antal block
+*                      frst vid behov. Allokeringar strre n blockstorleken
+*                      misslyckas.
+*
+*                      - self       : Pekare till poolen som ska initieras.
+*                      - block_size : Storlek i byte per block.
+*                      - slab_blocks: Antalet block per platta.
+********************************************************************************/
+void pool_allocator_init(struct pool_allocator* self,
+                         const size_t block_size,
+                         const size_t slab_blocks)
+{
+   const size_t size = block_size > sizeof(void*) ? block_size : sizeof(void*);
+   self->base.allocate = pool_allocate;
+   self->base.reallocate = pool_reallocate;
+   self->base.deallocate = pool_deallocate;
+   self->base.context = self;
+   self->slabs = 0;
+   self->free_list = 0;
+   self->block_size = align_up(size, ARENA_ALIGNMENT);
+   self->slab_blocks = slab_blocks ? slab_blocks : 1;
+   return;
+}
+
+/********************************************************************************
+* pool_allocator_clear: Frigr samtliga plattor allokerade fr angiven pool,
+*                       varefter samtliga tidigare allokeringar r ogiltiga.
+*
+*                       - self: Pekare till poolen som ska tmmas.
+********************************************************************************/
+void pool_allocator_clear(struct pool_allocator* self)
+{
+   struct pool_slab* slab = self->slabs;
+
+   while (slab)
+   {
+      struct pool_slab* next = slab->next;
+      free(slab);
+      slab = next;
+   }
+
+   self->slabs = 0;
+   self->free_list = 0;
+   return;
+}
+
+#ifdef __linux__
+
+/********************************************************************************
+* huge_map: Returnerar en ny anonym minnesmappning som rymmer angivet antal
+*           byte, avrundat uppt till hela sidor. Om stora sidor har begrts
+*           fresls dessa fr mappningen. Vid misslyckad mappning returneras
+*           null.
+*
+*           - self: Pekare till allokeraren.
+*           - size: Antalet byte som ska rymmas.
+********************************************************************************/
+static void* huge_map(const struct huge_allocator* self,
+                      const size_t size)
+{
+   const size_t length = align_up(size, self->page_size);
+   void* block = 0;
+
+   if (!length) return 0;
+   block = mmap(0, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+   if (block == MAP_FAILED) return 0;
+
+#ifdef MADV_HUGEPAGE
+   if (self->huge_pages) madvise(block, length, MADV_HUGEPAGE);
+#endif
+   return block;
+}
+
+/********************************************************************************
+* huge_remap: ndrar storleken p angiven minnesmappning via mremap. Vid
+*             tillvxt utkas mappningen p plats om mjligt, annars flyttar
+*             krnan sidorna till en ny adress utan att innehllet kopieras.
+*             Vid minskning tas sidorna efter den nya lngden bort direkt,
+*             vilket lmnar tillbaka minnet till operativsystemet. Vid
+*             misslyckad omallokering returneras null och mappningen lmnas
+*             intakt.
+*
+*             - self    : Pekare till allokeraren.
+*             - block   : Pekare till mappningen.
+*             - old_size: Mappningens nuvarande storlek i byte.
+*             - new_size: Mappningens storlek i byte efter omallokeringen.
+********************************************************************************/
+static void* huge_remap(const struct huge_allocator* self,
+                        void* block,
+                        const size_t old_size,
+                        const size_t new_size)
+{
+   const size_t old_length = align_up(old_size, self->page_size);
+   const size_t new_length = align_up(new_size, self->page_size);
+   void* copy = 0;
+
+   if (!new_length) return 0;
+   if (new_length == old_length) return block;
+   copy = mremap(block, old_length, new_length, MREMAP_MAYMOVE);
+   return copy == MAP_FAILED ? 0 : copy;
+}
+
+/********************************************************************************
+* huge_unmap: Tar bort angiven minnesmappning.
+*
+*             - self : Pekare till allokeraren.
+*             - block: Pekare till mappningen.
+*             - size : Mappningens storlek i byte.
+********************************************************************************/
+static void huge_unmap(const struct huge_allocator* self,
+                       void* block,
+                       const size_t size)
+{
+   munmap(block, align_up(size, self->page_size));
+   return;
+}
+
+#else
+
+/********************************************************************************
+* huge_map: Allokerar angivet antal byte via malloc, eftersom
+*           minnesmappningar endast anvnds i Linux.
+*
+*           - self: Pekare till allokeraren.
+*           - size: Antalet byte som ska allokeras.
+********************************************************************************/
+static void* huge_map(const struct huge_allocator* self,
+                      const size_t size)
+{
+   (void)self;
+   return malloc(size);
+}
+
+/********************************************************************************
+* huge_remap: Omallokerar angivet minne via realloc, eftersom
+*             minnesmappningar endast anvnds i Linux.
+*
+*             - self    : Pekare till allokeraren.
+*             - block   : Pekare till minnet.
+*             - old_size: Minnets nuvarande storlek i byte.
+*             - new_size: Minnets storlek i byte efter omallokeringen.
+********************************************************************************/
+static void* huge_remap(const struct huge_allocator* self,
+                        void* block,
+                        const size_t old_size,
+                        const size_t new_size)
+{
+   (void)self;
+   (void)old_size;
+   return realloc(block, new_size);
+}
+
+/********************************************************************************
+* huge_unmap: Frigr angivet minne via free, eftersom minnesmappningar
+*             endast anvnds i Linux.
+*
+*             - self : Pekare till allokeraren.
+*             - block: Pekare till minnet.
+*             - size : Minnets storlek i byte.
+********************************************************************************/
+static void huge_unmap(const struct huge_allocator* self,
+                       void* block,
+                       const size_t size)
+{
+   (void)self;
+   (void)size;
+   free(block);
+   return;
+}
+
+#endif /* __linux__ */
+
+/********************************************************************************
+* huge_allocate: Allokerar angivet antal byte, dr block om minst
+*                allokerarens grns placeras i en minnesmappning och vriga
+*                block allokeras via malloc.
+*
+*                - context: Pekare till allokeraren.
+*                - size   : Antalet byte som ska allokeras.
+********************************************************************************/
+static void* huge_allocate(void* context,
+                           size_t size)
+{
+   const struct huge_allocator* self = (const struct huge_allocator*)context;
+   return size >= self->threshold ? huge_map(self, size) : malloc(size);
+}
+
+/********************************************************************************
+* huge_deallocate: Frigr angivet block, dr minnesmappade block tas bort via
+*                  munmap och vriga block frigrs via free.
+*
+*                  - context: Pekare till allokeraren.
+*                  - block  : Pekare till blocket (eller null).
+*                  - size   : Blockets storlek i byte.
+********************************************************************************/
+static void huge_deallocate(void* context,
+                            void* block,
+                            size_t size)
+{
+   const struct huge_allocator* self = (const struct huge_allocator*)context;
+
+   if (!block) return;
+   if (size >= self->threshold) huge_unmap(self, block, size);
+   else free(block);
+   return;
+}
+
+/********************************************************************************
+* huge_reallocate: Omallokerar angivet block. Om blocket r minnesmappat bde
+*                  fre och efter omallokeringen sker denna via mremap, och om
+*                  det ligger under grnsen bde fre och efter sker den via
+*                  realloc. Nr blocket passerar grnsen allokeras ett nytt
+*                  block dit befintligt innehll kopieras, vilket endast sker
+*                  en gng per passage.
+*
+*                  - context : Pekare till allokeraren.
+*                  - block   : Pekare till blocket (eller null).
+*                  - old_size: Blockets nuvarande storlek i byte.
+*                  - new_size: Blockets storlek i byte efter omallokeringen.
+********************************************************************************/
+static void* huge_reallocate(void* context,
+                             void* block,
+                             size_t old_size,
+                             size_t new_size)
+{
+   const struct huge_allocator* self = (const struct huge_allocator*)context;
+   const int old_mapped = old_size >= self->threshold;
+   const int new_mapped = new_size >= self->threshold;
+   void* copy = 0;
+
+   if (!block) return huge_allocate(context, new_size);
+   if (old_mapped && new_mapped) return huge_remap(self, block, old_size, new_size);
+   if (!old_mapped && !new_mapped) return realloc(block, new_size);
+
+   copy = huge_allocate(context, new_size);
+   if (!copy) return 0;
+   memcpy(copy, block, old_size < new_size ? old_size : new_size);
+   huge_deallocate(context, block, old_size);
+   return copy;
+}
+
+/********************************************************************************
+* huge_allocator_init: Initierar angiven allokerare fr mycket stora block,
+*                      dr block om minst angivet antal byte placeras i
+*                      anonyma minnesmappningar. Grnsen avrundas uppt till
+*                      minst en sida.
+*
+*                      - self      : Pekare till allokeraren som ska initieras.
+*                      - threshold : Minsta storlek i byte fr minnesmappade
+*                                    block, dr 0 innebr
+*                                    HUGE_ALLOCATOR_THRESHOLD.
+*                      - huge_pages: Indikerar ifall transparenta stora sidor
+*                                    ska fresls fr minnesmappade block.
+********************************************************************************/
+void huge_allocator_init(struct huge_allocator* self,
+                         const size_t threshold,
+                         const int huge_pages)
+{
+#ifdef __linux__
+   const long page_size = sysconf(_SC_PAGESIZE);
+   self->page_size = page_size > 0 ? (size_t)page_size : 4096;
+#else
+   self->page_size = 1;
+#endif
+   self->base.allocate = huge_allocate;
+   self->base.reallocate = huge_reallocate;
+   self->base.deallocate = huge_deallocate;
+   self->base.context = self;
+   self->threshold = threshold ? threshold : HUGE_ALLOCATOR_THRESHOLD;
+   if (self->threshold < self->page_size) self->threshold = self->page_size;
+   self->huge_pages = huge_pages;
+   return;
+}
\ No newline at end of file
@@ -0,0 +1,244 @@
+/********************************************************************************
+* allocator.h: Innehller ett utbytbart grnssnitt fr minnesallokering samt
+*              tre implementeringar av grnssnittet:
+*
+*              - arena_allocator: Allokerar genom att flytta fram en pekare i
+*                stora block (bump pointer). Enskilda allokeringar frigrs
+*                inte, i stllet terstlls hela arenan p konstant tid,
+*                exempelvis efter varje hanterad frfrgan.
+*
+*              - pool_allocator: Allokerar block av fast storlek frn strre
+*                plattor (slabs), dr frigjorda block teranvnds via en
+*                fri-lista. Lmpar sig fr objekt av samma storlek, exempelvis
+*                strukten int_vector.
+*
+*              - huge_allocator: Allokerar sm block via malloc, men lgger
+*                block ver en viss storlek i anonyma minnesmappningar som
+*                vxer via mremap, s att krnan flyttar sidorna i stllet
+*                fr att innehllet kopieras. Lmpar sig fr mycket stora
+*                vektorer, exempelvis hundratals MB, dr varje omallokering
+*                annars kan kopiera hela innehllet. Sidorna kan ven
+*                fresls som transparenta stora sidor (transparent huge
+*                pages). Minnesmappningar anvnds endast i Linux, vriga
+*                plattformar anvnder malloc fr samtliga storlekar.
+*
+*              En nullpekare till en allokerare tolkas som standardallokeraren,
+*              dvs. malloc, realloc och free.
+********************************************************************************/
+#ifndef ALLOCATOR_H_
+#define ALLOCATOR_H_
+
+/* Inkluderingsdirektiv: */
+#include <stdlib.h> /* Innehller malloc, realloc och free. */
+
+/********************************************************************************
+* allocator: Strukt fr ett grnssnitt fr minnesallokering, bestende av
+*            funktionspekare fr allokering, omallokering och frigrande samt
+*            en kontextpekare som skickas med vid varje anrop. Storleken p
+*            befintligt minne skickas med vid omallokering och frigrande,
+*            s att allokeraren inte behver lagra denna sjlv.
+********************************************************************************/
+struct allocator
+{
+   void* (*allocate)(void* context, size_t size);          /* Allokerar minne. */
+   void* (*reallocate)(void* context, void* block,
+                       size_t old_size, size_t new_size); /* Omallokerar minne. */
+   void (*deallocate)(void* context, void* block,
+                      size_t size);                       /* Frigr minne. */
+   void* context;                                         /* Allokerarens kontext. */
+};
+
+/********************************************************************************
+* ARENA_ALIGNMENT: Justering i byte fr samtliga allokeringar frn en arena.
+********************************************************************************/
+#define ARENA_ALIGNMENT 16
+
+/********************************************************************************
+* arena_chunk: Strukt fr ett block som en arena allokerar ifrn.
+********************************************************************************/
+struct arena_chunk
+{
+   struct arena_chunk* next; /* Pekare till nsta block i arenan. */
+   size_t capacity;          /* Blockets kapacitet i byte. */
+};
+
+/********************************************************************************
+* arena_allocator: Strukt fr en arena, dr grnssnittet base skickas till
+*                  funktioner som tar emot en allokerare.
+********************************************************************************/
+struct arena_allocator
+{
+   struct allocator base;       /* Arenans allokeringsgrnssnitt. */
+   struct arena_chunk* first;   /* Pekare till arenans frsta block. */
+   struct arena_chunk* current; /* Pekare till blocket som allokeras ifrn. */
+   size_t offset;               /* Antalet anvnda byte i aktuellt block. */
+   size_t chunk_size;           /* Minsta storlek i byte fr nya block. */
+   void* last;                  /* Senaste allokeringen, som kan vxa p plats. */
+};
+
+/********************************************************************************
+* pool_slab: Strukt fr en platta med block som en pool allokerar ifrn.
+********************************************************************************/
+struct pool_slab
+{
+   struct pool_slab* next; /* Pekare till nsta platta i poolen. */
+};
+
+/********************************************************************************
+* pool_allocator: Strukt fr en pool med block av fast storlek, dr
+*                 grnssnittet base skickas till funktioner som tar emot en
+*                 allokerare.
+********************************************************************************/
+struct pool_allocator
+{
+   struct allocator base;   /* Poolens allokeringsgrnssnitt. */
+   struct pool_slab* slabs; /* Pekare till poolens senast allokerade platta. */
+   void* free_list;         /* Pekare till frsta lediga block. */
+   size_t block_size;       /* Storlek i byte per block. */
+   size_t slab_blocks;      /* Antalet block per platta. */
+};
+
+/********************************************************************************
+* HUGE_ALLOCATOR_THRESHOLD: Standardvrde fr den minsta storlek i byte som
+*                           placeras i en minnesmappning av huge_allocator,
+*                           motsvarande en stor sida. Ett block kopieras en
+*                           gng nr det passerar grnsen, varfr grnsen
+*                           br hllas lg i frhllande till blocken.
+********************************************************************************/
+#ifndef HUGE_ALLOCATOR_THRESHOLD
+#define HUGE_ALLOCATOR_THRESHOLD ((size_t)2 << 20)
+#endif
+
+/********************************************************************************
+* huge_allocator: Strukt fr en allokerare fr mycket stora block, dr
+*                 grnssnittet base skickas till funktioner som tar emot en
+*                 allokerare. Huruvida ett block r minnesmappat avgrs
+*                 enbart av dess storlek, som skickas med vid varje anrop.
+********************************************************************************/
+struct huge_allocator
+{
+   struct allocator base; /* Allokerarens allokeringsgrnssnitt. */
+   size_t threshold;      /* Minsta storlek i byte fr minnesmappade block. */
+   size_t page_size;      /* Sidstorleken i byte, som mappningar avrundas till. */
+   int huge_pages;        /* Indikerar ifall stora sidor ska fresls. */
+};
+
+/********************************************************************************
+* allocator_alloc: Allokerar angivet antal byte via angiven allokerare, dr
+*                  null innebr malloc. Vid misslyckad allokering returneras
+*                  null.
+*
+*                  - self: Pekare till allokeraren (eller null).
+*                  - size: Antalet byte som ska allokeras.
+********************************************************************************/
+static inline void* allocator_alloc(const struct allocator* self,
+                                    const size_t size)
+{
+   return self ? self->allocate(self->context, size) : malloc(size);
+}
+
+/********************************************************************************
+* allocator_realloc: Omallokerar angivet minne via angiven allokerare, dr
+*                    null innebr realloc. Vid misslyckad omallokering
+*                    returneras null och befintligt minne lmnas intakt.
+*
+*                    - self    : Pekare till allokeraren (eller null).
+*                    - block   : Pekare till minnet (eller null).
+*                    - old_size: Minnets nuvarande storlek i byte.
+*                    - new_size: Minnets storlek i byte efter omallokeringen.
+********************************************************************************/
+static inline void* allocator_realloc(const struct allocator* self,
+                                      void* block,
+                                      const size_t old_size,
+                                      const size_t new_size)
+{
+   return self ? self->reallocate(self->context, block, old_size, new_size) :
+                 realloc(block, new_size);
+}
+
+/********************************************************************************
+* allocator_free: Frigr angivet minne via angiven allokerare, dr null
+*                 innebr free.
+*
+*                 - self : Pekare till allokeraren (eller null).
+*                 - block: Pekare till minnet (eller null).
+*                 - size : Minnets storlek i byte.
+********************************************************************************/
+static inline void allocator_free(const struct allocator* self,
+                                  void* block,
+                                  const size_t size)
+{
+   if (self) self->deallocate(self->context, block, size);
+   else free(block);
+   return;
+}
+
+/********************************************************************************
+* arena_allocator_init: Initierar angiven arena, dr minne allokeras i block
+*                       om minst angiven storlek frst vid behov.
+*
+*                       - self      : Pekare till arenan som ska initieras.
+*                       - chunk_size: Minsta storlek i byte fr arenans block.
+********************************************************************************/
+void arena_allocator_init(struct arena_allocator* self,
+                          const size_t chunk_size);
+
+/********************************************************************************
+* arena_allocator_reset: terstller angiven arena p konstant tid, varefter
+*                        samtliga tidigare allokeringar r ogiltiga. Arenans
+*                        block behlls och teranvnds fr nya allokeringar.
+*
+*                        - self: Pekare till arenan som ska terstllas.
+********************************************************************************/
+void arena_allocator_reset(struct arena_allocator* self);
+
+/********************************************************************************
+* arena_allocator_clear: Frigr samtliga block allokerade fr angiven arena.
+*
+*                        - self: Pekare till arenan som ska tmmas.
+********************************************************************************/
+void arena_allocator_clear(struct arena_allocator* self);
+
+/********************************************************************************
+* pool_allocator_init: Initierar angiven pool fr block av angiven storlek,
+*                      dr minne allokeras i plattor om angivet antal block
+*                      frst vid behov. Allokeringar strre n blockstorleken
+*                      misslyckas.
+*
+*                      - self       : Pekare till poolen som ska initieras.
+*                      - block_size : Storlek i byte per block.
+*                      - slab_blocks: Antalet block per platta.
+********************************************************************************/
+void pool_allocator_init(struct pool_allocator* self,
+                         const size_t block_size,
+                         const size_t slab_blocks);
+
+/********************************************************************************
+* pool_allocator_clear: Frigr samtliga plattor allokerade fr angiven pool,
+*                       varefter samtliga tidigare allokeringar r ogiltiga.
+*
+*                       - self: Pekare till poolen som ska tmmas.
+********************************************************************************/
+void pool_allocator_clear(struct pool_allocator* self);
+
+/********************************************************************************
+* huge_allocator_init: Initierar angiven allokerare fr mycket stora block,
+*                      dr block om minst angivet antal byte placeras i
+*                      anonyma minnesmappningar. Sdana block vxer och
+*                      krymper via mremap, dr minskning lmnar tillbaka
+*                      frigjorda sidor till operativsystemet direkt. Block
+*                      under grnsen allokeras via malloc och flyttas till
+*                      eller frn en minnesmappning nr de passerar grnsen.
+*
+*                      - self      : Pekare till allokeraren som ska initieras.
+*                      - threshold : Minsta storlek i byte fr minnesmappade
+*                                    block, dr 0 innebr
+*                                    HUGE_ALLOCATOR_THRESHOLD.
+*                      - huge_pages: Indikerar ifall transparenta stora sidor
+*                                    ska fresls fr minnesmappade block.
+********************************************************************************/
+void huge_allocator_init(struct huge_allocator* self,
+                         const size_t threshold,
+                         const int huge_pages);
+
+#endif /* ALLOCATOR_H_ */
\ No newline at end of file
@@ -0,0 +1,2394 @@
+/********************************************************************************
+* benchmark.c: Mtningar av prestanda fr strukten int_vector:
+*
+*              - Antalet anrop till allokeraren samt tidstgng per operation
+*                fr push- och popoperationer, dels med den tidigare
+*                implementeringen (omallokering vid varje operation), dels
+*                med strukten int_vector.
+*              - Tidstgngen fr utskrift via fprintf per heltal jmfrt
+*                med buffrad formatering via int_vector_print.
+*              - Tidstgngen fr inlsning via fscanf per heltal jmfrt
+*                med int_vector_load och en minnesmappad binrfil.
+*              - Antalet allokeringar och cachemissar fr korta vektorer
+*                inom respektive utanfr den inbyggda bufferten.
+*              - Tidstgngen fr kortlivade vektorer med
+*                standardallokeraren jmfrt med pool- och arenaallokerarna.
+*              - Tidstgngen fr sortering via qsort jmfrt med
+*                int_vector_sort.
+*              - Tidstgngen samt lngsta enskilda omallokering nr en
+*                mycket stor vektor fylls och tms, med standardallokeraren
+*                jmfrt med minnesmappade block via huge_allocator.
+*              - Genomstrmningen fr samtidiga pushoperationer till
+*                int_vector_concurrent med ett kande antal trdar, dels
+*                ett heltal i taget, dels i omgngar, fljt av kontroll att
+*                inget heltal har gtt frlorat efter frysningen.
+*              - Tidstgngen fr push- och popoperationer med aktuell
+*                instrumentering av allokeringarna, se int_vector_stats.h,
+*                fljt av en utskrift av statistiken samt kontroll att
+*                samtliga allokerade byte har frigjorts.
+*              - Genomstrmningen fr int_vector_assign samt fr summering,
+*                min/max, rkning och skning fr varje
+*                instruktionsuppsttning som processorn stder, efter
+*                kontroll att resultaten r lika med de skalra versionernas.
+*              - Minnestgng samt genomstrmning fr summering och utskrift
+*                av samma vrden lagrade i i8_vector, i16_vector, i32_vector,
+*                i64_vector och f32_vector, efter kontroll att samtliga
+*                vektortyper ger samma summa och byte fr byte samma utskrift,
+*                samt kontroll av valet av smalaste elementbredd.
+*              - Tidstgng och minnestgng fr utskrift och summering av
+*                en aritmetisk talfljd lagrad i int_vector jmfrt med en
+*                lat int_vector_lazy, samt komprimeringsgrad och
+*                genomstrmning fr summering och utskrift av nstan
+*                monotona data i int_vector_packed, efter kontroll att
+*                resultaten r lika med int_vectors.
+*              - Tidstgngen fr berkning och utskrift av ett antal
+*                omgngar heltal till en fil, dels synkront via
+*                int_vector_print, dels asynkront via int_vector_writer med
+*                och utan O_DIRECT, efter kontroll att filerna r byte fr
+*                byte lika.
+*              - Tidstgngen fr utskrift av en stor vektor till en fil via
+*                int_vector_print jmfrt med int_vector_print_parallel med
+*                ett kande antal trdar, dels via pwrite, dels i tur och
+*                ordning, efter kontroll att filerna r byte fr byte lika.
+*              - Tidstgng och minnestgng fr att lmna samma vektor till
+*                ett antal steg, dels via kopiering, dels via delning med
+*                int_vector_shared, efter kontroll att vyer ger samma
+*                resultat som kopior och att en ndring endast pverkar
+*                den ndrade kopian.
+*              - Tidstgngen per steg fr en k dr heltal lggs till lngst
+*                bak och tas bort lngst fram, dels i en int_vector, dels i
+*                en int_deque, efter kontroll att int_deque ger samma
+*                resultat som en int_vector vid push och pop i bda ndar.
+*              - Genomstrmningen fr tilldelning, transformering och
+*                summering via trdpoolen i int_vector_parallel med ett
+*                kande antal trdar, efter kontroll att resultaten r lika
+*                med motsvarande operationer i en trd.
+*
+*              Kompilera exempelvis enligt nedan:
+*
+*              gcc -O2 benchmark.c int_vector.c int_format.c int_vector_io.c
+*                  int_simd.c allocator.c int_vector_sort.c int_vector_stats.c
+*                  int_vector_concurrent.c i8_vector.c i16_vector.c
+*                  i64_vector.c f32_vector.c int_vector_lazy.c
+*                  int_vector_packed.c int_vector_writer.c
+*                  int_vector_dump.c int_vector_view.c int_vector_shared.c
+*                  int_deque.c int_vector_parallel.c -pthread -o benchmark
+*
+*              Lgg till flaggan -DINT_VECTOR_STATS fr att mta kostnaden fr
+*              instrumenteringen av allokeringarna.
+********************************************************************************/
+#define _POSIX_C_SOURCE 199309L /* Krvs fr clock_gettime. */
+#define _DEFAULT_SOURCE         /* Krvs fr syscall. */
+#include "int_vector.h"
+#include "int_vector_io.h"
+#include "int_simd.h"
+#include "int_vector_sort.h"
+#include "int_vector_stats.h"
+#include "int_vector_concurrent.h"
+#include "vector_family.h"
+#include "int_vector_lazy.h"
+#include "int_vector_packed.h"
+#include "int_vector_writer.h"
+#include "int_vector_dump.h"
+#include "int_vector_view.h"
+#include "int_vector_shared.h"
+#include "int_deque.h"
+#include "int_vector_parallel.h"
+
+#include <limits.h>  /* Innehller INT_MIN och INT_MAX. */
+#include <pthread.h> /* Innehller pthread_create och pthread_join. */
+#include <string.h>  /* Innehller memcmp. */
+
+#include <time.h>   /* Innehller clock_gettime. */
+
+#ifdef __linux__
+#include <linux/perf_event.h> /* Innehller perf_event_attr. */
+#include <sys/ioctl.h>        /* Innehller ioctl. */
+#include <sys/syscall.h>      /* Innehller SYS_perf_event_open. */
+#include <unistd.h>           /* Innehller syscall, read och close. */
+#endif
+
+/********************************************************************************
+* legacy_vector: Strukt fr den tidigare implementeringen, dr fltet
+*                omallokeras vid varje push- och popoperation.
+********************************************************************************/
+struct legacy_vector
+{
+   int* data;          /* Pekare till det dynamiska fltet. */
+   size_t size;        /* Vektorns storlek. */
+   size_t alloc_calls; /* Antalet anrop till allokeraren. */
+};
+
+/********************************************************************************
+* legacy_push: Lgger till ett heltal lngst bak i angiven vektor enligt den
+*              tidigare implementeringen. Returnerar 0 vid lyckad
+*              minnesallokering, annars felkod 1.
+*
+*              - self: Pekare till vektorn.
+*              - num : Det nya tal som ska lggas till.
+********************************************************************************/
+static int legacy_push(struct legacy_vector* self,
+                       const int num)
+{
+   int* copy = (int*)realloc(self->data, sizeof(int) * (self->size + 1));
+   self->alloc_calls++;
+   if (!copy) return 1;
+   copy[self->size++] = num;
+   self->data = copy;
+   return 0;
+}
+
+/********************************************************************************
+* legacy_pop: Tar bort sista heltalet i angiven vektor enligt den tidigare
+*             implementeringen. Returnerar 0 vid lyckad minnesallokering,
+*             annars felkod 1.
+*
+*             - self: Pekare till vektorn.
+********************************************************************************/
+static int legacy_pop(struct legacy_vector* self)
+{
+   self->alloc_calls++;
+
+   if (self->size <= 1)
+   {
+      free(self->data);
+      self->data = 0;
+      self->size = 0;
+      return 0;
+   }
+   else
+   {
+      int* copy = (int*)realloc(self->data, sizeof(int) * (self->size - 1));
+      if (!copy) return 1;
+      self->data = copy;
+      self->size--;
+      return 0;
+   }
+}
+
+/********************************************************************************
+* counted_push: Lgger till ett heltal i angiven vektor och rknar upp angiven
+*               rknare om kapaciteten ndrades, vilket motsvarar ett anrop
+*               till allokeraren.
+*
+*               - self       : Pekare till vektorn.
+*               - num        : Det nya tal som ska lggas till.
+*               - alloc_calls: Pekare till rknaren.
+********************************************************************************/
+static void counted_push(struct int_vector* self,
+                         const int num,
+                         size_t* alloc_calls)
+{
+   const size_t capacity = int_vector_capacity(self);
+   int_vector_push(self, num);
+   if (int_vector_capacity(self) != capacity) (*alloc_calls)++;
+   return;
+}
+
+/********************************************************************************
+* counted_pop: Tar bort sista heltalet i angiven vektor och rknar upp angiven
+*              rknare om kapaciteten ndrades.
+*
+*              - self       : Pekare till vektorn.
+*              - alloc_calls: Pekare till rknaren.
+********************************************************************************/
+static void counted_pop(struct int_vector* self,
+                        size_t* alloc_calls)
+{
+   const size_t capacity = int_vector_capacity(self);
+   int_vector_pop(self);
+   if (int_vector_capacity(self) != capacity) (*alloc_calls)++;
+   return;
+}
+
+/********************************************************************************
+* now: Returnerar aktuell tidpunkt i nanosekunder frn en monoton klocka.
+********************************************************************************/
+static double now(void)
+{
+   struct timespec ts;
+   clock_gettime(CLOCK_MONOTONIC, &ts);
+   return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+/********************************************************************************
+* cache_counter_start: Startar rkning av cachemissar fr aktuell process via
+*                      prestandarknarna i Linux. Returnerar en fildeskriptor
+*                      fr rknaren, eller -1 om rknaren inte r tillgnglig,
+*                      exempelvis i virtuella maskiner eller p andra
+*                      plattformar.
+********************************************************************************/
+static int cache_counter_start(void)
+{
+#ifdef __linux__
+   struct perf_event_attr attr;
+   int fd;
+
+   memset(&attr, 0, sizeof(attr));
+   attr.type = PERF_TYPE_HARDWARE;
+   attr.size = sizeof(attr);
+   attr.config = PERF_COUNT_HW_CACHE_MISSES;
+   attr.disabled = 1;
+   attr.exclude_kernel = 1;
+   attr.exclude_hv = 1;
+
+   fd = (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+   if (fd < 0) return -1;
+   ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+   ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+   return fd;
+#else
+   return -1;
+#endif
+}
+
+/********************************************************************************
+* cache_counter_stop: Stoppar angiven rknare och returnerar antalet
+*                     cachemissar sedan start, eller -1 om rknaren inte r
+*                     tillgnglig.
+*
+*                     - fd: Fildeskriptor fr rknaren (eller -1).
+********************************************************************************/
+static long long cache_counter_stop(const int fd)
+{
+#ifdef __linux__
+   long long count = -1;
+   if (fd < 0) return -1;
+   ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+   if (read(fd, &count, sizeof(count)) != (ssize_t)sizeof(count)) count = -1;
+   close(fd);
+   return count;
+#else
+   (void)fd;
+   return -1;
+#endif
+}
+
+/********************************************************************************
+* print_result: Skriver ut resultatet fr en mtning i terminalen.
+*
+*               - name       : Mtningens namn.
+*               - ops        : Antalet genomfrda operationer.
+*               - alloc_calls: Antalet anrop till allokeraren.
+*               - ns         : Total tidstgng i nanosekunder.
+********************************************************************************/
+static void print_result(const char* name,
+                         const size_t ops,
+                         const size_t alloc_calls,
+                         const double ns)
+{
+   printf("%-28s %12zu ops %10.4f allokeringar/op %10.2f ns/op\n",
+          name, ops, (double)alloc_calls / (double)ops, ns / (double)ops);
+   return;
+}
+
+/********************************************************************************
+* bench_oscillate: Fyller en vektor precis till en kapacitetsgrns och lter
+*                  den sedan pendla kring grnsen via omvxlande push- och
+*                  popoperationer, dels med den tidigare implementeringen,
+*                  dels med strukten int_vector.
+*
+*                  - fill  : Antalet heltal som vektorn fylls med frst.
+*                  - rounds: Antalet par av push- och popoperationer.
+********************************************************************************/
+static void bench_oscillate(const size_t fill,
+                            const size_t rounds)
+{
+   struct legacy_vector legacy = { 0, 0, 0 };
+   struct int_vector v;
+   size_t alloc_calls = 0;
+   double start;
+
+   for (size_t i = 0; i < fill; ++i) legacy_push(&legacy, (int)i);
+   legacy.alloc_calls = 0;
+   start = now();
+
+   for (size_t i = 0; i < rounds; ++i)
+   {
+      legacy_push(&legacy, (int)i);
+      legacy_pop(&legacy);
+   }
+
+   print_result("pendling (tidigare)", 2 * rounds, legacy.alloc_calls, now() - start);
+   free(legacy.data);
+
+   int_vector_init(&v);
+   int_vector_reserve(&v, fill);
+   for (size_t i = 0; i < fill; ++i) int_vector_push(&v, (int)i);
+   start = now();
+
+   for (size_t i = 0; i < rounds; ++i)
+   {
+      counted_push(&v, (int)i, &alloc_calls);
+      counted_pop(&v, &alloc_calls);
+   }
+
+   print_result("pendling (int_vector)", 2 * rounds, alloc_calls, now() - start);
+   int_vector_clear(&v);
+   return;
+}
+
+/********************************************************************************
+* bench_sawtooth: Fyller en vektor med angivet antal heltal och tmmer den
+*                 sedan via popoperationer, vilket upprepas angivet antal
+*                 gnger, dels med den tidigare implementeringen, dels med
+*                 strukten int_vector.
+*
+*                 - size  : Antalet heltal per cykel.
+*                 - cycles: Antalet cykler.
+********************************************************************************/
+static void bench_sawtooth(const size_t size,
+                           const size_t cycles)
+{
+   struct legacy_vector legacy = { 0, 0, 0 };
+   struct int_vector v;
+   size_t alloc_calls = 0;
+   double start = now();
+
+   for (size_t i = 0; i < cycles; ++i)
+   {
+      for (size_t j = 0; j < size; ++j) legacy_push(&legacy, (int)j);
+      for (size_t j = 0; j < size; ++j) legacy_pop(&legacy);
+   }
+
+   print_result("sgtand (tidigare)", 2 * size * cycles, legacy.alloc_calls, now() - start);
+   free(legacy.data);
+
+   int_vector_init(&v);
+   start = now();
+
+   for (size_t i = 0; i < cycles; ++i)
+   {
+      for (size_t j = 0; j < size; ++j) counted_push(&v, (int)j, &alloc_calls);
+      for (size_t j = 0; j < size; ++j) counted_pop(&v, &alloc_calls);
+   }
+
+   print_result("sgtand (int_vector)", 2 * size * cycles, alloc_calls, now() - start);
+   int_vector_clear(&v);
+   return;
+}
+
+/********************************************************************************
+* bench_print: Skriver ut en vektor med angivet antal heltal till /dev/null,
+*              dels via ett anrop till fprintf per heltal (tidigare
+*              implementering), dels via int_vector_print.
+*
+*              - size: Antalet heltal som ska skrivas ut.
+********************************************************************************/
+static void bench_print(const size_t size)
+{
+   struct int_vector v;
+   FILE* ostream = fopen("/dev/null", "w");
+   double start;
+   if (!ostream) return;
+
+   int_vector_init(&v);
+   int_vector_resize(&v, size);
+   int_vector_assign(&v, -(int)(size / 2), 7919);
+   start = now();
+
+   fprintf(ostream, "--------------------------------------------------------------------------------\n");
+
+   for (const int* i = int_vector_begin(&v); i < int_vector_end(&v); ++i)
+   {
+      fprintf(ostream, "%d\n", *i);
+   }
+
+   fprintf(ostream, "--------------------------------------------------------------------------------\n\n");
+   fflush(ostream);
+   print_result("utskrift (fprintf)", size, 0, now() - start);
+
+   start = now();
+   int_vector_print(&v, ostream);
+   fflush(ostream);
+   print_result("utskrift (int_vector_print)", size, 0, now() - start);
+
+   int_vector_clear(&v);
+   fclose(ostream);
+   return;
+}
+
+/********************************************************************************
+* verify_pipe: Kontrollerar att int_vector_load inte tappar efterfljande
+*              vektorer tyst vid inlsning frn ett rr, som inte stder
+*              fseek. Tv vektorer ska lsas in frn en fil, medan
+*              inlsning av samma data via ett rr ska returnera
+*              INT_VECTOR_LOAD_ERROR i stllet fr att nsta vektor
+*              rapporteras som slut p indata. En ensam vektor ska kunna
+*              lsas in via ett rr. Vid lyckad kontroll returneras 0,
+*              annars felkod 1.
+********************************************************************************/
+static int verify_pipe(void)
+{
+   struct int_vector v;
+   FILE* stream;
+   int status = 0;
+
+   int_vector_init(&v);
+   int_vector_push(&v, 1);
+   int_vector_push(&v, 2);
+
+   for (int vectors = 2; vectors >= 1; --vectors)
+   {
+      if (!(stream = fopen("benchmark_load.txt", "w"))) return 1;
+      for (int i = 0; i < vectors; ++i) int_vector_print(&v, stream);
+      fclose(stream);
+
+      if ((stream = fopen("benchmark_load.txt", "r")))
+      {
+         for (int i = 0; i < vectors; ++i)
+         {
+            if (int_vector_load(&v, stream, 0) != INT_VECTOR_LOAD_OK || v.size != 2) status = 1;
+         }
+
+         if (int_vector_load(&v, stream, 0) != INT_VECTOR_LOAD_END) status = 1;
+         fclose(stream);
+      }
+      else status = 1;
+
+      if ((stream = popen("cat benchmark_load.txt", "r")))
+      {
+         if (vectors > 1 && int_vector_load(&v, stream, 0) != INT_VECTOR_LOAD_ERROR) status = 1;
+         if (vectors == 1 && (int_vector_load(&v, stream, 0) != INT_VECTOR_LOAD_OK || v.size != 2 ||
+                              int_vector_load(&v, stream, 0) != INT_VECTOR_LOAD_END)) status = 1;
+         pclose(stream);
+      }
+      else status = 1;
+   }
+
+   remove("benchmark_load.txt");
+   int_vector_clear(&v);
+   return status;
+}
+
+/********************************************************************************
+* verify_mapped: Kontrollerar att en vektor hmtad ur en minnesmappning r
+*                lika med angiven vektor och att den inte kan ndras: pop
+*                upprepat lika mnga gnger som vektorn har heltal, fljt
+*                av push, resize, erase_range, sortering och tilldelning,
+*                ska lmna mappningen intakt i stllet fr att omallokera
+*                eller skriva i den. Delas vektorn via int_vector_share ska
+*                int_vector_shared_mut kopiera elementen ven utan andra
+*                gare, varefter vektorn ska kunna anvndas som vanligt.
+*                Vid lyckad kontroll returneras 0, annars felkod 1.
+*
+*                - mapped  : Pekare till den mappade vektorn.
+*                - expected: Pekare till vektorn som sparades i filen.
+********************************************************************************/
+static int verify_mapped(struct int_vector* mapped,
+                         const struct int_vector* expected)
+{
+   const size_t bytes = sizeof(int) * expected->size;
+   struct int_vector_shared shared;
+   struct int_vector* changed;
+   const int* data;
+   size_t failed = 0;
+
+   if (!int_vector_is_borrowed(mapped) || mapped->size != expected->size ||
+       memcmp(mapped->data, expected->data, bytes)) return 1;
+
+   for (size_t i = 0; i < expected->size; ++i) failed += int_vector_pop(mapped) != 0;
+
+   int_vector_assign(mapped, 0, 0);
+   if (failed != expected->size || !int_vector_push(mapped, 1) || !int_vector_resize(mapped, 0) ||
+       !int_vector_erase_range(mapped, 0, mapped->size) || !int_vector_sort(mapped, 0) ||
+       mapped->size != expected->size || memcmp(mapped->data, expected->data, bytes)) return 1;
+
+   /* En delad mappning ska kopieras vid ndring ven utan andra gare. */
+   data = mapped->data;
+   int_vector_shared_init(&shared);
+   if (int_vector_share(&shared, mapped) || !(changed = int_vector_shared_mut(&shared)) ||
+       changed->data == data || int_vector_push(changed, 1) || changed->size != expected->size + 1 ||
+       changed->data[expected->size] != 1 || memcmp(changed->data, expected->data, bytes) ||
+       memcmp(data, expected->data, bytes))
+   {
+      int_vector_shared_release(&shared);
+      return 1;
+   }
+
+   int_vector_shared_release(&shared);
+   if (int_vector_is_borrowed(mapped) || int_vector_push(mapped, 1) ||
+       mapped->size != 1 || mapped->data[0] != 1) return 1;
+
+   int_vector_clear(mapped);
+   return 0;
+}
+
+/********************************************************************************
+* bench_load: Skriver en vektor med angivet antal heltal till en temporr fil
+*             och lser sedan in den, dels via ett anrop till fscanf per
+*             heltal (tidigare implementering), dels via int_vector_load.
+*             Slutligen sparas vektorn i det binra filformatet, som
+*             ppnas via minnesmappning, varefter den mappade vektorn
+*             kontrolleras via verify_mapped. Vid lyckad kontroll
+*             returneras 0, annars felkod 1.
+*
+*             - size: Antalet heltal som ska lsas in.
+********************************************************************************/
+static int bench_load(const size_t size)
+{
+   struct int_vector v;
+   FILE* stream = tmpfile();
+   char separator[128];
+   int num;
+   double start;
+   int status = 0;
+   if (!stream) return 1;
+
+   int_vector_init(&v);
+   int_vector_resize(&v, size);
+   int_vector_assign(&v, -(int)(size / 2), 7919);
+   int_vector_print(&v, stream);
+   int_vector_clear(&v);
+
+   rewind(stream);
+   start = now();
+
+   if (fscanf(stream, "%127s", separator) == 1)
+   {
+      while (fscanf(stream, "%d", &num) == 1) int_vector_push(&v, num);
+   }
+
+   print_result("inlsning (fscanf)", size, 0, now() - start);
+   int_vector_clear(&v);
+
+   rewind(stream);
+   start = now();
+   int_vector_load(&v, stream, 0);
+   print_result("inlsning (int_vector_load)", size, 0, now() - start);
+   fclose(stream);
+
+   if ((stream = fopen("benchmark.bin", "wb")))
+   {
+      struct int_vector_mapping mapping;
+      struct int_vector mapped;
+      int_vector_save_binary(&v, 1, stream);
+      fclose(stream);
+
+      start = now();
+
+      if (int_vector_open_mapped(&mapping, "benchmark.bin") == 0)
+      {
+         int_vector_mapping_get(&mapping, 0, &mapped);
+         print_result("inlsning (mappad binrfil)", size, 0, now() - start);
+         if (verify_mapped(&mapped, &v)) status = 1;
+         int_vector_close_mapped(&mapping);
+      }
+
+      remove("benchmark.bin");
+   }
+
+   int_vector_clear(&v);
+   return status;
+}
+
+/********************************************************************************
+* counting_allocator: Strukt fr en allokerare som vidarebefordrar anropen till
+*                     malloc, realloc och free samt rknar antalet anrop.
+********************************************************************************/
+struct counting_allocator
+{
+   struct allocator base; /* Allokeringsgrnssnittet. */
+   size_t calls;          /* Antalet anrop till allokeraren. */
+};
+
+/********************************************************************************
+* counting_allocate, counting_reallocate, counting_deallocate: Rknar upp
+*                    anropen och vidarebefordrar dem till malloc, realloc
+*                    respektive free.
+********************************************************************************/
+static void* counting_allocate(void* context,
+                               size_t size)
+{
+   ((struct counting_allocator*)context)->calls++;
+   return malloc(size);
+}
+
+static void* counting_reallocate(void* context,
+                                 void* block,
+                                 size_t old_size,
+                                 size_t new_size)
+{
+   (void)old_size;
+   ((struct counting_allocator*)context)->calls++;
+   return realloc(block, new_size);
+}
+
+static void counting_deallocate(void* context,
+                                void* block,
+                                size_t size)
+{
+   (void)size;
+   ((struct counting_allocator*)context)->calls++;
+   free(block);
+   return;
+}
+
+/********************************************************************************
+* run_requests: Simulerar ett antal frfrgningar, dr varje frfrgan skapar
+*               ett antal kortlivade vektorer via int_vector_new_with, fyller
+*               dem och raderar dem. Om en arena anges terstlls den efter
+*               varje frfrgan. Returnerar summan av samtliga heltal, s att
+*               resultatet kan jmfras mellan allokerarna.
+*
+*               - requests        : Antalet frfrgningar.
+*               - vectors         : Antalet vektorer per frfrgan.
+*               - pushes          : Antalet heltal per vektor.
+*               - header_allocator: Allokerare fr vektorernas huvuden.
+*               - data_allocator  : Allokerare fr vektorernas flt.
+*               - arena           : Arena som terstlls (eller null).
+********************************************************************************/
+static long long run_requests(const size_t requests,
+                              const size_t vectors,
+                              const size_t pushes,
+                              const struct allocator* header_allocator,
+                              const struct allocator* data_allocator,
+                              struct arena_allocator* arena)
+{
+   struct int_vector* v[64];
+   long long sum = 0;
+
+   for (size_t r = 0; r < requests; ++r)
+   {
+      for (size_t i = 0; i < vectors; ++i)
+      {
+         v[i] = int_vector_new_with(header_allocator, data_allocator);
+         if (!v[i]) return -1;
+         for (size_t j = 0; j < pushes; ++j) int_vector_push(v[i], (int)(r + i + j));
+      }
+
+      for (size_t i = 0; i < vectors; ++i)
+      {
+         for (const int* j = int_vector_begin(v[i]); j < int_vector_end(v[i]); ++j) sum += *j;
+         int_vector_delete_with(&v[i], header_allocator);
+      }
+
+      if (arena) arena_allocator_reset(arena);
+   }
+
+   return sum;
+}
+
+/********************************************************************************
+* bench_allocators: Jmfr tidstgngen fr kortlivade vektorer med
+*                   standardallokeraren, med en pool fr vektorernas huvuden
+*                   samt med en pool fr huvudena och en arena fr flten,
+*                   dr arenan terstlls efter varje frfrgan. Antalet anrop
+*                   till malloc, realloc och free rknas, dr poolens plattor
+*                   och arenans block rknas som ett anrop vardera. Vid
+*                   avvikande resultat mellan allokerarna returneras felkod 1,
+*                   annars 0.
+*
+*                   - requests: Antalet frfrgningar.
+********************************************************************************/
+static int bench_allocators(const size_t requests)
+{
+   const size_t vectors = 64, pushes = 24;
+   const size_t ops = requests * vectors;
+   struct counting_allocator counting = { { counting_allocate, counting_reallocate,
+                                            counting_deallocate, 0 }, 0 };
+   struct pool_allocator pool;
+   struct arena_allocator arena;
+   long long expected, sum;
+   size_t blocks = 0;
+   double start;
+
+   counting.base.context = &counting;
+   pool_allocator_init(&pool, sizeof(struct int_vector), 256);
+   arena_allocator_init(&arena, 65536);
+
+   start = now();
+   expected = run_requests(requests, vectors, pushes, &counting.base, &counting.base, 0);
+   print_result("kortlivade vektorer (malloc)", ops, counting.calls, now() - start);
+
+   counting.calls = 0;
+   start = now();
+   sum = run_requests(requests, vectors, pushes, &pool.base, &counting.base, 0);
+   for (const struct pool_slab* i = pool.slabs; i; i = i->next) blocks++;
+   print_result("kortlivade vektorer (pool)", ops, counting.calls + blocks, now() - start);
+   if (sum != expected) return 1;
+
+   start = now();
+   sum = run_requests(requests, vectors, pushes, &pool.base, &arena.base, &arena);
+   for (const struct arena_chunk* i = arena.first; i; i = i->next) blocks++;
+   print_result("kortlivade vektorer (arena)", ops, blocks, now() - start);
+
+   arena_allocator_clear(&arena);
+   pool_allocator_clear(&pool);
+   return sum == expected ? 0 : 1;
+}
+
+/********************************************************************************
+* bench_small: Skapar ett stort antal korta vektorer, fyller dem och summerar
+*              samtliga heltal, dels med exakt s mnga heltal som ryms i den
+*              inbyggda bufferten, dels med ett heltal mer, s att heltalen
+*              flyttas till heapen. Antalet anrop till allokeraren samt
+*              antalet cachemissar per vektor skrivs ut, dr cachemissarna
+*              endast kan mtas om prestandarknarna r tillgngliga.
+*
+*              - count: Antalet vektorer.
+********************************************************************************/
+static void bench_small(const size_t count)
+{
+   const size_t sizes[] = { INT_VECTOR_SMALL_CAPACITY, INT_VECTOR_SMALL_CAPACITY + 1 };
+   struct counting_allocator counting = { { counting_allocate, counting_reallocate,
+                                            counting_deallocate, 0 }, 0 };
+   struct int_vector* vectors = (struct int_vector*)malloc(sizeof(struct int_vector) * count);
+   if (!vectors) return;
+   counting.base.context = &counting;
+
+   for (size_t k = 0; k < sizeof(sizes) / sizeof(sizes[0]); ++k)
+   {
+      char name[64];
+      long long sum = 0, misses;
+      double start, elapsed;
+      int fd;
+
+      counting.calls = 0;
+      fd = cache_counter_start();
+      start = now();
+
+      for (size_t i = 0; i < count; ++i)
+      {
+         int_vector_init_with(&vectors[i], &counting.base);
+         for (size_t j = 0; j < sizes[k]; ++j) int_vector_push(&vectors[i], (int)(i + j));
+      }
+
+      for (size_t i = 0; i < count; ++i)
+      {
+         for (const int* j = int_vector_begin(&vectors[i]); j < int_vector_end(&vectors[i]); ++j)
+         {
+            sum += *j;
+         }
+      }
+
+      for (size_t i = 0; i < count; ++i) int_vector_clear(&vectors[i]);
+      elapsed = now() - start;
+      misses = cache_counter_stop(fd);
+
+      sprintf(name, "korta vektorer (%zu heltal)", sizes[k]);
+      print_result(name, count, counting.calls, elapsed);
+      if (misses < 0) printf("%-28s %12lld summa cachemissar ej tillgngliga\n", name, sum);
+      else printf("%-28s %12lld summa %10.4f cachemissar/op\n", name, sum,
+                  (double)misses / (double)count);
+   }
+
+   free(vectors);
+   return;
+}
+
+/********************************************************************************
+* print_throughput: Skriver ut genomstrmningen fr en mtning i terminalen.
+*
+*                   - name : Mtningens namn.
+*                   - bytes: Antalet byte som har skrivits eller lsts.
+*                   - ns   : Total tidstgng i nanosekunder.
+********************************************************************************/
+static void print_throughput(const char* name,
+                             const size_t bytes,
+                             const double ns)
+{
+   printf("%-28s %12zu byte %10.2f GB/s\n", name, bytes, (double)bytes / ns);
+   return;
+}
+
+/********************************************************************************
+* verify_assign: Kontrollerar att vald version av int_simd_assign ger bitexakt
+*                samma resultat som den skalra versionen fr ett antal start-
+*                och stegvrden, inklusive verslag, samt fr storlekar som
+*                inte r jmnt delbara med antalet heltal per register.
+*                Vid lyckad kontroll returneras 0, annars felkod 1.
+*
+*                - isa: Instruktionsuppsttningen som ska kontrolleras.
+********************************************************************************/
+static int verify_assign(const int isa)
+{
+   static const int values[][2] =
+   {
+      { 0, 1 }, { 100, -1 }, { INT_MAX - 5, 1 }, { INT_MIN + 3, -1 },
+      { INT_MAX, INT_MAX }, { INT_MIN, INT_MIN }, { -7, 123456789 }, { 1, -987654321 }
+   };
+   int expected[1000], actual[1000];
+
+   for (size_t i = 0; i < sizeof(values) / sizeof(values[0]); ++i)
+   {
+      for (size_t size = 0; size <= 1000; size += size < 40 ? 1 : 239)
+      {
+         int_simd_select(INT_SIMD_SCALAR);
+         int_simd_assign(expected, size, values[i][0], values[i][1]);
+         int_simd_select(isa);
+         int_simd_assign(actual, size, values[i][0], values[i][1]);
+         if (memcmp(expected, actual, sizeof(int) * size)) return 1;
+      }
+   }
+
+   return 0;
+}
+
+/********************************************************************************
+* bench_assign: Mter genomstrmningen fr int_vector_assign fr varje
+*               instruktionsuppsttning som processorn stder, efter kontroll
+*               att resultatet r bitexakt lika med den skalra versionen.
+*               Vid lyckad kontroll returneras 0, annars felkod 1.
+*
+*               - size  : Antalet heltal i vektorn.
+*               - rounds: Antalet tilldelningar per instruktionsuppsttning.
+********************************************************************************/
+static int bench_assign(const size_t size,
+                        const size_t rounds)
+{
+   struct int_vector v;
+   const int best = int_simd_best();
+   int status = 0;
+
+   int_vector_init(&v);
+   if (int_vector_resize(&v, size)) return 1;
+
+   for (int isa = INT_SIMD_SCALAR; isa <= best; ++isa)
+   {
+      char name[64];
+      double start;
+
+      if (verify_assign(isa))
+      {
+         printf("tilldelning (%s): avviker frn skalr version!\n", int_simd_isa_name(isa));
+         status = 1;
+         continue;
+      }
+
+      int_simd_select(isa);
+      int_vector_assign(&v, 0, 1);
+      start = now();
+      for (size_t i = 0; i < rounds; ++i) int_vector_assign(&v, (int)i, 3);
+      sprintf(name, "tilldelning (%s)", int_simd_isa_name(isa));
+      print_throughput(name, sizeof(int) * size * rounds, now() - start);
+   }
+
+   int_simd_select(best);
+   int_vector_clear(&v);
+   return status;
+}
+
+/********************************************************************************
+* verify_scan: Kontrollerar att vald version av summerings-, min/max-,
+*              rkne- och skkrnorna ger samma resultat som de skalra
+*              versionerna fr slumpmssiga flt av varierande storlek,
+*              inklusive extremvrden och storlekar som inte r jmnt
+*              delbara med antalet heltal per register. Vid lyckad kontroll
+*              returneras 0, annars felkod 1.
+*
+*              - isa: Instruktionsuppsttningen som ska kontrolleras.
+********************************************************************************/
+static int verify_scan(const int isa)
+{
+   static const int ranges[][2] =
+   {
+      { -50, 50 }, { INT_MIN, INT_MAX }, { INT_MAX, INT_MAX }, { INT_MIN, -1 }, { 5, -5 }
+   };
+   int data[1000];
+   srand(10);
+
+   for (size_t size = 0; size <= 1000; size += size < 40 ? 1 : 239)
+   {
+      const int values[] = { size > 0 ? data[size / 2] : 0, 1000, INT_MIN };
+      int expected_min = 0, expected_max = 0, min = 0, max = 0;
+      long long expected_sum;
+      int expected_status;
+
+      for (size_t i = 0; i < size; ++i)
+      {
+         data[i] = i % 13 == 0 ? INT_MIN : i % 17 == 0 ? INT_MAX : rand() % 201 - 100;
+      }
+
+      int_simd_select(INT_SIMD_SCALAR);
+      expected_sum = int_simd_sum(data, size);
+      expected_status = int_simd_minmax(data, size, &expected_min, &expected_max);
+      int_simd_select(isa);
+      if (int_simd_sum(data, size) != expected_sum) return 1;
+      if (int_simd_minmax(data, size, &min, &max) != expected_status ||
+          min != expected_min || max != expected_max) return 1;
+
+      for (size_t i = 0; i < sizeof(values) / sizeof(values[0]); ++i)
+      {
+         size_t expected_count, expected_index;
+         int_simd_select(INT_SIMD_SCALAR);
+         expected_count = int_simd_count_eq(data, size, values[i]);
+         expected_index = int_simd_find(data, size, values[i]);
+         int_simd_select(isa);
+         if (int_simd_count_eq(data, size, values[i]) != expected_count ||
+             int_simd_find(data, size, values[i]) != expected_index) return 1;
+      }
+
+      for (size_t i = 0; i < sizeof(ranges) / sizeof(ranges[0]); ++i)
+      {
+         size_t expected_count;
+         int_simd_select(INT_SIMD_SCALAR);
+         expected_count = int_simd_count_range(data, size, ranges[i][0], ranges[i][1]);
+         int_simd_select(isa);
+         if (int_simd_count_range(data, size, ranges[i][0], ranges[i][1]) != expected_count) return 1;
+      }
+   }
+
+   return 0;
+}
+
+/********************************************************************************
+* bench_scan: Mter genomstrmningen fr int_vector_sum, int_vector_minmax,
+*             int_vector_count_eq, int_vector_count_range och
+*             int_vector_find (utan trff, dvs. hela vektorn genomsks) fr
+*             varje instruktionsuppsttning som processorn stder, efter
+*             kontroll att resultaten r lika med de skalra versionernas.
+*             Vid lyckad kontroll returneras 0, annars felkod 1.
+*
+*             - size  : Antalet heltal i vektorn.
+*             - rounds: Antalet genomskningar per krna och
+*                       instruktionsuppsttning.
+********************************************************************************/
+static int bench_scan(const size_t size,
+                      const size_t rounds)
+{
+   struct int_vector v;
+   const int best = int_simd_best();
+   const size_t bytes = sizeof(int) * size * rounds;
+   volatile long long sink = 0;
+   int status = 0;
+
+   int_vector_init(&v);
+   if (int_vector_resize(&v, size)) return 1;
+   int_vector_assign(&v, -(int)(size / 2), 1);
+
+   for (int isa = INT_SIMD_SCALAR; isa <= best; ++isa)
+   {
+      const char* isa_name = int_simd_isa_name(isa);
+      char name[64];
+      double start;
+
+      if (verify_scan(isa))
+      {
+         printf("skning (%s): avviker frn skalr version!\n", isa_name);
+         status = 1;
+         continue;
+      }
+
+      int_simd_select(isa);
+
+      start = now();
+      for (size_t i = 0; i < rounds; ++i) sink += int_vector_sum(&v);
+      sprintf(name, "summa (%s)", isa_name);
+      print_throughput(name, bytes, now() - start);
+
+      start = now();
+      for (size_t i = 0; i < rounds; ++i)
+      {
+         int min, max;
+         int_vector_minmax(&v, &min, &max);
+         sink += min + max;
+      }
+      sprintf(name, "min/max (%s)", isa_name);
+      print_throughput(name, bytes, now() - start);
+
+      start = now();
+      for (size_t i = 0; i < rounds; ++i) sink += (long long)int_vector_count_eq(&v, (int)i);
+      sprintf(name, "antal lika (%s)", isa_name);
+      print_throughput(name, bytes, now() - start);
+
+      start = now();
+      for (size_t i = 0; i < rounds; ++i) sink += (long long)int_vector_count_range(&v, -(int)i, 1000);
+      sprintf(name, "antal i intervall (%s)", isa_name);
+      print_throughput(name, bytes, now() - start);
+
+      start = now();
+      for (size_t i = 0; i < rounds; ++i) sink += int_vector_find(&v, INT_MAX) != 0;
+      sprintf(name, "skning (%s)", isa_name);
+      print_throughput(name, bytes, now() - start);
+   }
+
+   (void)sink;
+   int_simd_select(best);
+   int_vector_clear(&v);
+   return status;
+}
+
+/********************************************************************************
+* compare_int: Jmfrelsefunktion fr qsort, som sorterar heltal i stigande
+*              ordning.
+*
+*              - a: Pekare till det frsta heltalet.
+*              - b: Pekare till det andra heltalet.
+********************************************************************************/
+static int compare_int(const void* a,
+                       const void* b)
+{
+   const int x = *(const int*)a, y = *(const int*)b;
+   return (x > y) - (x < y);
+}
+
+/********************************************************************************
+* bench_sort: Mter tidstgngen fr sortering av slumpmssiga heltal via
+*             qsort jmfrt med int_vector_sort med en trd respektive med
+*             samtliga processorkrnor, dock minst fyra trdar, s att den
+*             flertrdade histogram- och spridningsfasen kontrolleras mot
+*             qsort ven p en dator med en krna. Vid lika resultat
+*             returneras 0, annars felkod 1.
+*
+*             - size: Antalet heltal som ska sorteras.
+********************************************************************************/
+static int bench_sort(const size_t size)
+{
+   size_t threads[] = { 1, 0 };
+   struct int_vector input, expected, v;
+   int status = 0;
+   double start;
+
+   int_vector_init(&input);
+   int_vector_init(&expected);
+   int_vector_init(&v);
+   srand(11);
+   threads[1] = int_vector_sort_threads() > 4 ? int_vector_sort_threads() : 4;
+
+   for (size_t i = 0; i < size; ++i)
+   {
+      int_vector_push(&input, (int)((unsigned)rand() * 2654435761u + (unsigned)rand()));
+   }
+
+   int_vector_concat(&expected, &input);
+   start = now();
+   qsort(int_vector_begin(&expected), size, sizeof(int), compare_int);
+   print_result("sortering (qsort)", size, 0, now() - start);
+
+   for (size_t k = 0; k < sizeof(threads) / sizeof(threads[0]); ++k)
+   {
+      char name[64];
+      int_vector_set_sort_threads(threads[k]);
+      int_vector_resize(&v, 0);
+      int_vector_concat(&v, &input);
+
+      start = now();
+      if (int_vector_sort(&v, 0)) status = 1;
+      sprintf(name, "sortering (radix, %zu trdar)", int_vector_sort_threads());
+      print_result(name, size, 2, now() - start);
+      if (memcmp(int_vector_begin(&v), int_vector_begin(&expected), sizeof(int) * size)) status = 1;
+   }
+
+   int_vector_set_sort_threads(0);
+   int_vector_clear(&input);
+   int_vector_clear(&expected);
+   int_vector_clear(&v);
+   return status;
+}
+
+/********************************************************************************
+* run_huge: Fyller en vektor med angivet antal heltal via angiven allokerare
+*           och tmmer den sedan via popoperationer, fljt av kontroll av
+*           innehllet efter fyllning samt efter halva tmningen. Endast
+*           pushoperationer som krver omallokering mts enskilt, s att
+*           mtningen i sig inte pverkar vriga operationer. Returnerar 0
+*           om innehllet r korrekt, annars felkod 1.
+*
+*           - name     : Mtningens namn.
+*           - size     : Antalet heltal som vektorn fylls med.
+*           - allocator: Pekare till allokeraren fr vektorns flt.
+********************************************************************************/
+static int run_huge(const char* name,
+                    const size_t size,
+                    const struct allocator* allocator)
+{
+   struct int_vector v;
+   double start, longest = 0.0;
+   int status = 0;
+
+   int_vector_init_with(&v, allocator);
+   start = now();
+
+   for (size_t i = 0; i < size; ++i)
+   {
+      if (v.size == int_vector_capacity(&v))
+      {
+         const double t = now();
+         if (int_vector_push(&v, (int)i)) status = 1;
+         if (now() - t > longest) longest = now() - t;
+      }
+      else
+      {
+         int_vector_push(&v, (int)i);
+      }
+   }
+
+   for (size_t i = 0; i < v.size; ++i)
+   {
+      if (v.data[i] != (int)i) status = 1;
+   }
+
+   for (size_t i = 0; i < size; ++i)
+   {
+      int_vector_pop(&v);
+      if (v.size == size / 2)
+      {
+         for (size_t j = 0; j < v.size; ++j)
+         {
+            if (v.data[j] != (int)j) status = 1;
+         }
+      }
+   }
+
+   printf("%-28s %12zu ops %10.2f ns/op %10.2f ms lngsta omallokering\n",
+          name, 2 * size, (now() - start) / (double)(2 * size), longest / 1e6);
+   int_vector_clear(&v);
+   return status;
+}
+
+/********************************************************************************
+* bench_huge: Jmfr tidstgngen fr en mycket stor vektor med
+*             standardallokeraren samt med huge_allocator, med respektive
+*             utan transparenta stora sidor. Vid korrekt innehll returneras
+*             0, annars felkod 1.
+*
+*             - size: Antalet heltal som vektorn fylls med.
+********************************************************************************/
+static int bench_huge(const size_t size)
+{
+   struct huge_allocator mapped, huge_pages;
+   int status = 0;
+
+   huge_allocator_init(&mapped, 0, 0);
+   huge_allocator_init(&huge_pages, 0, 1);
+
+   status |= run_huge("stor vektor (malloc)", size, 0);
+   status |= run_huge("stor vektor (mremap)", size, &mapped.base);
+   status |= run_huge("stor vektor (mremap, thp)", size, &huge_pages.base);
+   return status;
+}
+
+/********************************************************************************
+* concurrent_task: Strukt fr en skrivande trds andel av en mtning av
+*                  int_vector_concurrent, dr trden lgger till heltalen
+*                  first, first + 1 ... first + count - 1.
+********************************************************************************/
+struct concurrent_task
+{
+   struct int_vector_concurrent* vector; /* Pekare till den delade vektorn. */
+   size_t first;                         /* Trdens frsta heltal. */
+   size_t count;                         /* Antalet heltal trden lgger till. */
+   size_t batch;                         /* Antalet heltal per omgng, 0 = push. */
+   int status;                           /* Felkod 1 vid misslyckad allokering. */
+};
+
+/********************************************************************************
+* concurrent_writer: Lgger till trdens heltal i den delade vektorn, antingen
+*                    ett i taget via int_vector_concurrent_push eller i
+*                    omgngar via int_vector_concurrent_append.
+*
+*                    - arg: Pekare till trdens strukt concurrent_task.
+********************************************************************************/
+static void* concurrent_writer(void* arg)
+{
+   struct concurrent_task* task = (struct concurrent_task*)arg;
+   int buffer[1024];
+   task->status = 0;
+
+   if (task->batch == 0)
+   {
+      for (size_t i = 0; i < task->count; ++i)
+      {
+         task->status |= int_vector_concurrent_push(task->vector, (int)(task->first + i));
+      }
+      return 0;
+   }
+
+   for (size_t i = 0; i < task->count; i += task->batch)
+   {
+      const size_t n = task->count - i < task->batch ? task->count - i : task->batch;
+      for (size_t j = 0; j < n; ++j) buffer[j] = (int)(task->first + i + j);
+      task->status |= int_vector_concurrent_append(task->vector, buffer, n);
+   }
+   return 0;
+}
+
+/********************************************************************************
+* run_concurrent: Lter angivet antal trdar lgga till sammanlagt angivet
+*                 antal heltal i en delad vektor och fryser sedan vektorn.
+*                 Drefter sorteras den frysta vektorn och kontrolleras s att
+*                 varje heltal frekommer exakt en gng. Returnerar 0 om inget
+*                 heltal har gtt frlorat eller dubblerats, annars felkod 1.
+*
+*                 - threads: Antalet skrivande trdar (hgst 64).
+*                 - size   : Det sammanlagda antalet heltal.
+*                 - batch  : Antalet heltal per omgng (hgst 1024), 0 = push.
+********************************************************************************/
+static int run_concurrent(const size_t threads,
+                          const size_t size,
+                          const size_t batch)
+{
+   struct int_vector_concurrent vector;
+   struct concurrent_task tasks[64];
+   pthread_t handles[64];
+   int started[64];
+   struct int_vector v;
+   char name[64];
+   int status = 0;
+   double start;
+
+   int_vector_concurrent_init(&vector);
+   int_vector_init(&v);
+   start = now();
+
+   for (size_t i = 0; i < threads; ++i)
+   {
+      tasks[i].vector = &vector;
+      tasks[i].first = size / threads * i;
+      tasks[i].count = i + 1 < threads ? size / threads : size - tasks[i].first;
+      tasks[i].batch = batch;
+      started[i] = pthread_create(&handles[i], 0, concurrent_writer, &tasks[i]) == 0;
+      if (!started[i]) concurrent_writer(&tasks[i]);
+   }
+
+   for (size_t i = 0; i < threads; ++i)
+   {
+      if (started[i]) pthread_join(handles[i], 0);
+      status |= tasks[i].status;
+   }
+
+   sprintf(name, "samtidig %s (%zu trdar)", batch ? "append" : "push", threads);
+   print_result(name, size, 0, now() - start);
+
+   if (int_vector_concurrent_freeze(&vector, &v) || v.size != size || int_vector_sort(&v, 0))
+   {
+      status = 1;
+   }
+
+   for (size_t i = 0; i < v.size && !status; ++i)
+   {
+      if (v.data[i] != (int)i) status = 1;
+   }
+
+   int_vector_concurrent_clear(&vector);
+   int_vector_clear(&v);
+   return status;
+}
+
+/********************************************************************************
+* bench_concurrent: Mter genomstrmningen fr int_vector_concurrent med 1, 2,
+*                   4 ... upp till angivet antal trdar, ett heltal i taget
+*                   samt i omgngar om 1024 heltal. Varje mtning fljs av
+*                   kontroll att inget heltal har gtt frlorat. Returnerar 0
+*                   om samtliga kontroller lyckas, annars felkod 1.
+*
+*                   - size       : Det sammanlagda antalet heltal per mtning.
+*                   - max_threads: Det hgsta antalet trdar (hgst 64).
+********************************************************************************/
+static int bench_concurrent(const size_t size,
+                            const size_t max_threads)
+{
+   int status = 0;
+
+   for (size_t threads = 1; threads <= max_threads; threads *= 2)
+   {
+      status |= run_concurrent(threads, size, 0);
+      status |= run_concurrent(threads, size, 1024);
+   }
+   return status;
+}
+
+/********************************************************************************
+* bench_stats: Fyller en vektor med angivet antal heltal och tmmer den sedan
+*              via popoperationer, vilket upprepas angivet antal gnger, med
+*              aktuell instrumentering av allokeringarna. Drefter skrivs
+*              statistiken ut. Om instrumenteringen r aktiverad kontrolleras
+*              att varje allokering har frigjorts och att inga levande byte
+*              terstr, annars returneras felkod 1.
+*
+*              - size  : Antalet heltal per cykel.
+*              - cycles: Antalet cykler.
+********************************************************************************/
+static int bench_stats(const size_t size,
+                       const size_t cycles)
+{
+   struct int_vector v;
+   struct int_vector_stats stats;
+   double start;
+
+   int_vector_stats_reset();
+   int_vector_init(&v);
+   start = now();
+
+   for (size_t k = 0; k < cycles; ++k)
+   {
+      for (size_t i = 0; i < size; ++i) int_vector_push(&v, (int)i);
+      for (size_t i = 0; i < size; ++i) int_vector_pop(&v);
+   }
+
+   int_vector_clear(&v);
+   int_vector_stats_get(&stats);
+   print_result(int_vector_stats_enabled() ? "sgtand (instrumenterad)" : "sgtand (ej instrumenterad)",
+                2 * size * cycles, stats.allocations + stats.reallocations + stats.frees,
+                now() - start);
+   int_vector_stats_dump(stdout);
+
+   if (!int_vector_stats_enabled()) return 0;
+   return stats.allocations != stats.frees || stats.live_bytes != 0;
+}
+
+/********************************************************************************
+* same_contents: Indikerar ifall angivna filer har samma innehll, dr bda
+*                filerna lses frn brjan.
+*
+*                - a: Pekare till den frsta filen.
+*                - b: Pekare till den andra filen.
+********************************************************************************/
+static int same_contents(FILE* a,
+                         FILE* b)
+{
+   int c;
+   rewind(a);
+   rewind(b);
+
+   do
+   {
+      c = fgetc(a);
+      if (c != fgetc(b)) return 0;
+   } while (c != EOF);
+
+   return 1;
+}
+
+/********************************************************************************
+* verify_width: Kontrollerar att vector_width_for_range vljer den smalaste
+*               elementbredden fr ett antal intervall kring typgrnserna.
+*               Vid lyckad kontroll returneras 0, annars felkod 1.
+********************************************************************************/
+static int verify_width(void)
+{
+   static const struct { long long min, max; enum vector_width width; } cases[] =
+   {
+      { 0, 100, VECTOR_WIDTH_8 }, { -128, 127, VECTOR_WIDTH_8 },
+      { -129, 0, VECTOR_WIDTH_16 }, { 0, 128, VECTOR_WIDTH_16 },
+      { -32768, 32767, VECTOR_WIDTH_16 }, { 0, 32768, VECTOR_WIDTH_32 },
+      { INT_MIN, INT_MAX, VECTOR_WIDTH_32 }, { 0, (long long)INT_MAX + 1, VECTOR_WIDTH_64 },
+      { LLONG_MIN, 0, VECTOR_WIDTH_64 }, { 5, -5, VECTOR_WIDTH_8 }
+   };
+
+   for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); ++i)
+   {
+      if (vector_width_for_range(cases[i].min, cases[i].max) != cases[i].width) return 1;
+   }
+
+   return 0;
+}
+
+/********************************************************************************
+* BENCH_FAMILY: Fyller en vektor av angiven typ med heltalen i intervallet
+*               [-100, 100] upprepade, kontrollerar summan samt utskriften
+*               mot int_vector och mter drefter genomstrmningen fr
+*               summering och utskrift. Vid avvikelse stts status till 1.
+********************************************************************************/
+#define BENCH_FAMILY(name, type, sum_format)                                        \
+   {                                                                                \
+      struct name v;                                                                \
+      FILE* actual = tmpfile();                                                     \
+      double start;                                                                 \
+      if (!actual) return 1;                                                        \
+      name##_init(&v);                                                              \
+      if (name##_resize(&v, size)) return 1;                                        \
+      for (size_t i = 0; i < size; ++i) v.data[i] = (type)((int)(i % 201) - 100);   \
+      if ((long long)name##_sum(&v) != expected_sum) status = 1;                    \
+      name##_print(&v, actual);                                                     \
+      fflush(actual);                                                               \
+      if (!same_contents(expected, actual)) status = 1;                             \
+      fclose(actual);                                                               \
+      start = now();                                                                \
+      for (size_t i = 0; i < rounds; ++i) sink += (double)name##_sum(&v);           \
+      sprintf(label, "summering (%s)", #name);                                      \
+      print_throughput(label, sizeof(type) * size * rounds, now() - start);         \
+      start = now();                                                                \
+      name##_print(&v, null_stream);                                                \
+      fflush(null_stream);                                                          \
+      sprintf(label, "utskrift (%s)", #name);                                       \
+      print_result(label, size, 0, now() - start);                                  \
+      printf("%-28s %12zu byte, summa " sum_format "\n",                            \
+             #name, sizeof(type) * size, name##_sum(&v));                           \
+      name##_clear(&v);                                                             \
+   }
+
+/********************************************************************************
+* bench_family: Lagrar samma vrden i samtliga vektortyper i vector_family.h
+*               och jmfr minnestgng samt genomstrmning fr summering och
+*               utskrift. Innan mtningen kontrolleras att samtliga typer ger
+*               samma summa och byte fr byte samma utskrift som int_vector,
+*               samt att vector_width_for_range vljer i8_vector fr
+*               vrdenas intervall. Vid lyckad kontroll returneras 0, annars
+*               felkod 1.
+*
+*               - size  : Antalet element per vektor.
+*               - rounds: Antalet summeringar per vektortyp.
+********************************************************************************/
+static int bench_family(const size_t size,
+                        const size_t rounds)
+{
+   struct int_vector reference;
+   FILE* expected = tmpfile();
+   FILE* null_stream = fopen("/dev/null", "w");
+   volatile double sink = 0.0;
+   long long expected_sum;
+   char label[64];
+   int status = verify_width();
+
+   if (!expected || !null_stream) return 1;
+
+   int_vector_init(&reference);
+   if (int_vector_resize(&reference, size)) return 1;
+   for (size_t i = 0; i < size; ++i) reference.data[i] = (int)(i % 201) - 100;
+   expected_sum = int_vector_sum(&reference);
+   int_vector_print(&reference, expected);
+   fflush(expected);
+   int_vector_clear(&reference);
+
+   if (vector_width_for_range(-100, 100) != VECTOR_WIDTH_8) status = 1;
+
+   BENCH_FAMILY(i8_vector, int8_t, "%lld")
+   BENCH_FAMILY(i16_vector, int16_t, "%lld")
+   BENCH_FAMILY(i32_vector, int, "%lld")
+   BENCH_FAMILY(i64_vector, int64_t, "%lld")
+   BENCH_FAMILY(f32_vector, float, "%.0f")
+
+   (void)sink;
+   fclose(expected);
+   fclose(null_stream);
+   return status;
+}
+
+#undef BENCH_FAMILY
+
+/********************************************************************************
+* print_to: Skriver ut angiven vektor via angiven funktion till en ny temporr
+*           fil och returnerar filen, eller null om filen inte kunde skapas.
+*           Anvnds fr att jmfra utskrifter byte fr byte via
+*           same_contents.
+*
+*           - print : Utskriftsfunktionen.
+*           - vector: Pekare till vektorn som ska skrivas ut.
+********************************************************************************/
+static FILE* print_to(void (*print)(const void*, FILE*),
+                      const void* vector)
+{
+   FILE* file = tmpfile();
+   if (!file) return 0;
+   print(vector, file);
+   fflush(file);
+   return file;
+}
+
+/********************************************************************************
+* Anpassningar av utskriftsfunktionerna till print_to.
+********************************************************************************/
+static void print_vector(const void* v, FILE* ostream) { int_vector_print((const struct int_vector*)v, ostream); }
+static void print_lazy(const void* v, FILE* ostream) { int_vector_lazy_print((const struct int_vector_lazy*)v, ostream); }
+static void print_packed(const void* v, FILE* ostream) { int_vector_packed_print((const struct int_vector_packed*)v, ostream); }
+
+/********************************************************************************
+* same_print: Indikerar ifall tv vektorer ger byte fr byte samma utskrift.
+*
+*             - print_a: Utskriftsfunktionen fr den frsta vektorn.
+*             - a      : Pekare till den frsta vektorn.
+*             - print_b: Utskriftsfunktionen fr den andra vektorn.
+*             - b      : Pekare till den andra vektorn.
+********************************************************************************/
+static int same_print(void (*print_a)(const void*, FILE*),
+                      const void* a,
+                      void (*print_b)(const void*, FILE*),
+                      const void* b)
+{
+   FILE* file_a = print_to(print_a, a);
+   FILE* file_b = print_to(print_b, b);
+   const int same = file_a && file_b && same_contents(file_a, file_b);
+   if (file_a) fclose(file_a);
+   if (file_b) fclose(file_b);
+   return same;
+}
+
+/********************************************************************************
+* bench_lazy: Tilldelar en aritmetisk talfljd med angivet antal heltal, dels
+*             till en int_vector via int_vector_assign, dels till en lat
+*             int_vector_lazy, och mter tidstgngen fr tilldelning,
+*             utskrift och summering samt minnestgngen fr respektive
+*             vektor. Innan mtningen kontrolleras att vektorerna ger samma
+*             summa, min/max och utskrift. Vid lyckad kontroll returneras 0,
+*             annars felkod 1.
+*
+*             - size: Antalet heltal i talfljden.
+********************************************************************************/
+static int bench_lazy(const size_t size)
+{
+   struct int_vector v;
+   struct int_vector_lazy lazy;
+   FILE* ostream = fopen("/dev/null", "w");
+   int min_v = 0, max_v = 0, min_l = 0, max_l = 0;
+   long long sum_v, sum_l;
+   double start;
+   int status = 0;
+
+   if (!ostream) return 1;
+   int_vector_init(&v);
+   int_vector_lazy_init(&lazy);
+
+   start = now();
+   if (int_vector_resize(&v, size)) return 1;
+   int_vector_assign(&v, -(int)(size / 2), 7);
+   int_vector_print(&v, ostream);
+   fflush(ostream);
+   sum_v = int_vector_sum(&v);
+   print_result("talfljd (int_vector)", size, 0, now() - start);
+
+   start = now();
+   int_vector_lazy_assign(&lazy, size, -(int)(size / 2), 7);
+   int_vector_lazy_print(&lazy, ostream);
+   fflush(ostream);
+   sum_l = int_vector_lazy_sum(&lazy);
+   print_result("talfljd (int_vector_lazy)", size, 0, now() - start);
+
+   printf("%-28s %12zu byte jmfrt med %zu byte\n", "talfljd (minne)",
+          sizeof(struct int_vector_lazy), sizeof(int) * size);
+
+   int_vector_minmax(&v, &min_v, &max_v);
+   int_vector_lazy_minmax(&lazy, &min_l, &max_l);
+   if (sum_v != sum_l || min_v != min_l || max_v != max_l) status = 1;
+   if (!same_print(print_vector, &v, print_lazy, &lazy)) status = 1;
+
+   /* Frsta ndringen som bryter talfljden materialiserar vektorn. */
+   if (int_vector_lazy_set(&lazy, 0, 0) || int_vector_lazy_is_lazy(&lazy)) status = 1;
+   if (int_vector_lazy_sum(&lazy) != sum_v + (long long)(size / 2)) status = 1;
+
+   int_vector_clear(&v);
+   int_vector_lazy_clear(&lazy);
+   fclose(ostream);
+   return status;
+}
+
+/********************************************************************************
+* bench_packed: Fyller en vektor med angivet antal nstan monotona heltal,
+*               dvs. en vxande fljd med sm slumpmssiga steg och enstaka
+*               hopp bakt, och komprimerar den via int_vector_packed.
+*               Drefter skrivs komprimeringsgraden ut tillsammans med
+*               genomstrmningen fr summering och utskrift jmfrt med
+*               int_vector. Innan mtningen kontrolleras att uppackning,
+*               summa och utskrift r lika med originalets. Vid lyckad
+*               kontroll returneras 0, annars felkod 1.
+*
+*               - size  : Antalet heltal.
+*               - rounds: Antalet summeringar per vektor.
+********************************************************************************/
+static int bench_packed(const size_t size,
+                        const size_t rounds)
+{
+   struct int_vector v, thawed;
+   struct int_vector_packed packed;
+   FILE* ostream = fopen("/dev/null", "w");
+   volatile long long sink = 0;
+   unsigned value = 0;
+   double start;
+   int status = 0;
+
+   if (!ostream) return 1;
+   int_vector_init(&v);
+   int_vector_init(&thawed);
+   int_vector_packed_init(&packed);
+   srand(12);
+
+   if (int_vector_resize(&v, size)) return 1;
+
+   for (size_t i = 0; i < size; ++i)
+   {
+      value = i % 1000 == 999 ? value - (unsigned)(rand() % 5000) : value + (unsigned)(rand() % 16);
+      v.data[i] = (int)value;
+   }
+
+   start = now();
+   if (int_vector_packed_freeze(&packed, v.data, v.size)) return 1;
+   print_result("komprimering", size, 0, now() - start);
+   printf("%-28s %12zu byte jmfrt med %zu byte (%.1f bitar/heltal)\n", "komprimerad (minne)",
+          int_vector_packed_bytes(&packed), sizeof(int) * size,
+          8.0 * (double)int_vector_packed_bytes(&packed) / (double)size);
+
+   if (int_vector_packed_thaw(&packed, &thawed) || thawed.size != v.size ||
+       memcmp(thawed.data, v.data, sizeof(int) * v.size)) status = 1;
+   if (int_vector_packed_sum(&packed) != int_vector_sum(&v)) status = 1;
+   if (int_vector_packed_at(&packed, size / 3) != v.data[size / 3]) status = 1;
+   if (!same_print(print_vector, &v, print_packed, &packed)) status = 1;
+
+   start = now();
+   for (size_t i = 0; i < rounds; ++i) sink += int_vector_sum(&v);
+   print_result("summering (int_vector)", size * rounds, 0, now() - start);
+
+   start = now();
+   for (size_t i = 0; i < rounds; ++i) sink += int_vector_packed_sum(&packed);
+   print_result("summering (komprimerad)", size * rounds, 0, now() - start);
+
+   start = now();
+   int_vector_print(&v, ostream);
+   fflush(ostream);
+   print_result("utskrift (int_vector)", size, 0, now() - start);
+
+   start = now();
+   int_vector_packed_print(&packed, ostream);
+   fflush(ostream);
+   print_result("utskrift (komprimerad)", size, 0, now() - start);
+
+   (void)sink;
+   int_vector_clear(&v);
+   int_vector_clear(&thawed);
+   int_vector_packed_clear(&packed);
+   fclose(ostream);
+   return status;
+}
+
+/********************************************************************************
+* compute_batch: Fyller angiven vektor med pseudoslumpmssiga heltal utifrn
+*                angivet omgngsnummer och sorterar den, vilket motsvarar
+*                berkningen av en omgng resultat fre utskrift.
+*
+*                - v    : Pekare till vektorn som ska fyllas.
+*                - batch: Omgngens nummer.
+********************************************************************************/
+static void compute_batch(struct int_vector* v,
+                          const size_t batch)
+{
+   unsigned state = 2654435761u * (unsigned)(batch + 1);
+
+   for (int* i = int_vector_begin(v); i < int_vector_end(v); ++i)
+   {
+      state ^= state << 13;
+      state ^= state >> 17;
+      state ^= state << 5;
+      *i = (int)state;
+   }
+
+   int_vector_sort(v, 0);
+   return;
+}
+
+/********************************************************************************
+* run_writer: Berknar och skriver ut angivet antal omgngar till filen
+*             benchmark_async.txt via int_vector_writer med angivna
+*             flaggor, s att utskriften av varje omgng verlappar
+*             berkningen av nsta. Tidstgngen omfattar ppning,
+*             eventuell frallokering samt stngning av filen. Returnerar
+*             0 om samtliga skrivningar lyckades och filen r byte fr
+*             byte lika med angiven fil, annars felkod 1.
+*
+*             - name       : Mtningens namn.
+*             - v          : Pekare till vektorn fr omgngarna.
+*             - batches    : Antalet omgngar.
+*             - flags      : Flaggor, se int_vector_writer_flags.
+*             - preallocate: Antalet byte som frallokeras (0 = ingen).
+*             - expected   : Pekare till filen med frvntad utskrift.
+********************************************************************************/
+static int run_writer(const char* name,
+                      struct int_vector* v,
+                      const size_t batches,
+                      const int flags,
+                      const size_t preallocate,
+                      FILE* expected)
+{
+   struct int_vector_writer writer;
+   FILE* actual;
+   double start = now();
+   int status = 0;
+
+   if (int_vector_writer_open_with(&writer, "benchmark_async.txt", 0, 0, flags,
+                                   preallocate)) return 1;
+
+   for (size_t batch = 0; batch < batches; ++batch)
+   {
+      compute_batch(v, batch);
+      if (int_vector_writer_print(&writer, v)) status = 1;
+   }
+
+   if (int_vector_writer_close(&writer)) status = 1;
+   print_result(name, batches * v->size, 0, now() - start);
+
+   if (!(actual = fopen("benchmark_async.txt", "rb"))) return 1;
+   if (!same_contents(expected, actual)) status = 1;
+   fclose(actual);
+   remove("benchmark_async.txt");
+   return status;
+}
+
+/********************************************************************************
+* bench_writer: Berknar angivet antal omgngar med angivet antal heltal och
+*               skriver ut varje omgng till en fil, dels synkront via
+*               int_vector_print, dels asynkront via int_vector_writer,
+*               utan flaggor, med O_DIRECT respektive med frallokering av
+*               filens slutliga storlek. Tidstgngen omfattar i samtliga
+*               fall bde berkning och utskrift, frn ppning till och
+*               med stngning av filen. Vid lyckad kontroll att filerna r
+*               byte fr byte lika returneras 0, annars felkod 1.
+*
+*               - size   : Antalet heltal per omgng.
+*               - batches: Antalet omgngar.
+********************************************************************************/
+static int bench_writer(const size_t size,
+                        const size_t batches)
+{
+   struct int_vector v;
+   FILE* expected;
+   double start = now();
+   long length;
+   int status = 0;
+
+   int_vector_init(&v);
+   if (int_vector_resize(&v, size)) return 1;
+   if (!(expected = fopen("benchmark.txt", "wb"))) return 1;
+
+   for (size_t batch = 0; batch < batches; ++batch)
+   {
+      compute_batch(&v, batch);
+      int_vector_print(&v, expected);
+   }
+
+   if (fclose(expected) != 0) status = 1;
+   print_result("utskrift (synkron)", batches * size, 0, now() - start);
+
+   if (!(expected = fopen("benchmark.txt", "rb"))) return 1;
+   if (fseek(expected, 0, SEEK_END) != 0 || (length = ftell(expected)) < 0) length = 0;
+
+   if (run_writer("utskrift (int_vector_writer)", &v, batches, 0, 0, expected) ||
+       run_writer("utskrift (writer, O_DIRECT)", &v, batches, INT_VECTOR_WRITER_DIRECT, 0, expected) ||
+       run_writer("utskrift (writer, frallok.)", &v, batches, 0, (size_t)length, expected))
+   {
+      status = 1;
+   }
+
+   fclose(expected);
+   remove("benchmark.txt");
+   int_vector_clear(&v);
+   return status;
+}
+
+/********************************************************************************
+* run_dump: Skriver ut angiven vektor tv gnger efter varandra till filen
+*           benchmark_dump.txt via int_vector_print_parallel med angivet
+*           antal trdar och kontrollerar att filen r byte fr byte lika
+*           med angiven fil. Filen ppnas antingen fr skrivning, vilket
+*           ger skrivning via pwrite, eller fr tillgg, vilket ger
+*           skrivning i tur och ordning. Vid lyckad kontroll returneras 0,
+*           annars felkod 1.
+*
+*           - v       : Pekare till vektorn som ska skrivas ut.
+*           - threads : Antalet trdar.
+*           - append  : Indikerar ifall filen ska ppnas fr tillgg.
+*           - expected: Pekare till filen med frvntad utskrift.
+********************************************************************************/
+static int run_dump(const struct int_vector* v,
+                    const size_t threads,
+                    const int append,
+                    FILE* expected)
+{
+   char name[64];
+   FILE* actual = fopen("benchmark_dump.txt", append ? "a+b" : "w+b");
+   double start;
+   int status = 0;
+
+   if (!actual) return 1;
+   int_vector_set_dump_threads(threads);
+   start = now();
+
+   if (int_vector_print_parallel(v, actual) || int_vector_print_parallel(v, actual) ||
+       fflush(actual) != 0)
+   {
+      status = 1;
+   }
+
+   sprintf(name, "parallell (%s, %zu trdar)", append ? "ordnad" : "pwrite", threads);
+   print_result(name, 2 * v->size, 0, now() - start);
+
+   if (!same_contents(expected, actual)) status = 1;
+   fclose(actual);
+   remove("benchmark_dump.txt");
+   return status;
+}
+
+/********************************************************************************
+* bench_dump: Skriver ut en vektor med angivet antal pseudoslumpmssiga
+*             heltal tv gnger till en fil, dels via int_vector_print,
+*             dels via int_vector_print_parallel med 1, 2, 4 och s vidare
+*             upp till antalet processorkrnor trdar, dock minst 4 s att
+*             samtliga utskriftsvgar kontrolleras. Vid lyckad kontroll
+*             att filerna r byte fr byte lika returneras 0, annars
+*             felkod 1.
+*
+*             - size: Antalet heltal i vektorn.
+********************************************************************************/
+static int bench_dump(const size_t size)
+{
+   struct int_vector v;
+   FILE* expected;
+   size_t max_threads;
+   double start;
+   int status = 0;
+
+   int_vector_set_dump_threads(0);
+   max_threads = int_vector_dump_threads() > 4 ? int_vector_dump_threads() : 4;
+   int_vector_init(&v);
+   if (int_vector_resize(&v, size)) return 1;
+   compute_batch(&v, 0);
+   if (!(expected = fopen("benchmark.txt", "w+b"))) return 1;
+
+   start = now();
+   int_vector_print(&v, expected);
+   int_vector_print(&v, expected);
+   if (fflush(expected) != 0) status = 1;
+   print_result("utskrift (int_vector_print)", 2 * size, 0, now() - start);
+
+   for (size_t threads = 1; threads < 2 * max_threads && !status; threads *= 2)
+   {
+      const size_t count = threads < max_threads ? threads : max_threads;
+      if (run_dump(&v, count, 0, expected) || run_dump(&v, count, 1, expected)) status = 1;
+   }
+
+   int_vector_set_dump_threads(0);
+   fclose(expected);
+   remove("benchmark.txt");
+   int_vector_clear(&v);
+   return status;
+}
+
+/********************************************************************************
+* print_view: Anpassning av int_vector_view_print till print_to.
+********************************************************************************/
+static void print_view(const void* v, FILE* ostream) { int_vector_view_print(*(const struct int_vector_view*)v, ostream); }
+
+/********************************************************************************
+* verify_view: Kontrollerar att en vy av mittersta halvan av angiven vektor
+*              ger samma summa, min/max, rkning, skning och utskrift som en
+*              kopia av samma heltal, samt att int_vector_assign_slice
+*              endast ndrar angivet intervall. Vid lyckad kontroll
+*              returneras 0, annars felkod 1.
+*
+*              - v: Pekare till vektorn, som mste innehlla minst 4 heltal.
+********************************************************************************/
+static int verify_view(struct int_vector* v)
+{
+   const size_t first = v->size / 4, last = v->size - v->size / 4;
+   const struct int_vector_view view = int_vector_slice(v, first, last);
+   const int value = v->data[last - 1];
+   struct int_vector copy;
+   int min_v = 0, max_v = 0, min_c = 0, max_c = 0;
+   int status = 0;
+
+   int_vector_init(&copy);
+   if (int_vector_append(&copy, v->data + first, last - first)) return 1;
+
+   int_vector_view_minmax(view, &min_v, &max_v);
+   int_vector_minmax(&copy, &min_c, &max_c);
+   if (int_vector_view_sum(view) != int_vector_sum(&copy) || min_v != min_c || max_v != max_c ||
+       int_vector_view_count_eq(view, value) != int_vector_count_eq(&copy, value) ||
+       int_vector_view_count_range(view, 0, value) != int_vector_count_range(&copy, 0, value) ||
+       int_vector_view_find(view, value) - view.data != int_vector_find(&copy, value) - copy.data ||
+       !same_print(print_view, &view, print_vector, &copy))
+   {
+      status = 1;
+   }
+
+   /* Tilldelningen av intervallet fr inte pverka heltalen utanfr. */
+   min_c = v->data[first - 1];
+   max_c = v->data[last];
+   int_vector_assign(&copy, 5, -3);
+   if (int_vector_assign_slice(v, first, last, 5, -3) || !int_vector_assign_slice(v, 1, 0, 0, 0) ||
+       v->data[first - 1] != min_c || v->data[last] != max_c ||
+       memcmp(v->data + first, copy.data, sizeof(int) * copy.size) != 0)
+   {
+      status = 1;
+   }
+
+   int_vector_clear(&copy);
+   return status;
+}
+
+/********************************************************************************
+* bench_shared: Lmnar en vektor med angivet antal heltal till angivet antal
+*               steg, dels via en kopia per steg, dels via en delad referens
+*               per steg, och mter tidstgngen samt minnestgngen fr
+*               stegens vektorer. Drefter kontrolleras att vyer ger samma
+*               resultat som kopior och att en ndring via
+*               int_vector_shared_mut endast pverkar den ndrade
+*               referensen. Vid lyckad kontroll returneras 0, annars
+*               felkod 1.
+*
+*               - size  : Antalet heltal i vektorn.
+*               - stages: Antalet steg, hgst 64.
+********************************************************************************/
+static int bench_shared(const size_t size,
+                        const size_t stages)
+{
+   struct int_vector v, copies[64];
+   struct int_vector_shared original, shared[64];
+   struct int_vector* changed;
+   long long sum;
+   double start;
+   int status = 0;
+
+   int_vector_init(&v);
+   int_vector_shared_init(&original);
+   if (stages > 64 || int_vector_resize(&v, size)) return 1;
+   int_vector_assign(&v, -(int)(size / 2), 3);
+   if (verify_view(&v)) status = 1;
+   sum = int_vector_sum(&v);
+
+   start = now();
+   for (size_t i = 0; i < stages; ++i)
+   {
+      int_vector_init(&copies[i]);
+      if (int_vector_concat(&copies[i], &v)) status = 1;
+   }
+   print_result("steg (kopia)", stages, stages, now() - start);
+
+   if (int_vector_share(&original, &v) || v.size != 0) status = 1;
+
+   start = now();
+   for (size_t i = 0; i < stages; ++i)
+   {
+      int_vector_shared_init(&shared[i]);
+      int_vector_shared_copy(&shared[i], &original);
+   }
+   print_result("steg (delad)", stages, 0, now() - start);
+
+   printf("%-28s %12zu byte jmfrt med %zu byte\n", "steg (minne)",
+          sizeof(int) * int_vector_shared_get(&original)->size,
+          sizeof(int) * size * stages);
+
+   if (int_vector_shared_references(&original) != stages + 1) status = 1;
+
+   /* Frsta ndringen kopierar vektorn, vriga referenser pverkas inte. */
+   if (!(changed = int_vector_shared_mut(&shared[0])) || int_vector_push(changed, 1)) status = 1;
+   if (int_vector_shared_references(&shared[0]) != 1 ||
+       int_vector_shared_references(&original) != stages ||
+       int_vector_view_sum(int_vector_shared_view(&shared[0])) != sum + 1 ||
+       int_vector_sum(int_vector_shared_get(&shared[1])) != sum ||
+       int_vector_sum(&copies[1]) != sum ||
+       int_vector_shared_mut(&shared[0]) != changed)
+   {
+      status = 1;
+   }
+
+   for (size_t i = 0; i < stages; ++i)
+   {
+      int_vector_shared_release(&shared[i]);
+      int_vector_clear(&copies[i]);
+   }
+
+   int_vector_shared_release(&original);
+   return status;
+}
+
+/********************************************************************************
+* print_deque: Anpassning av int_deque_print till print_to.
+********************************************************************************/
+static void print_deque(const void* d, FILE* ostream) { int_deque_print((const struct int_deque*)d, ostream); }
+
+/********************************************************************************
+* verify_deque: Genomfr angivet antal slumpmssiga push- och popoperationer i
+*               bda ndar, dels p en int_deque, dels p en int_vector via
+*               insert_range och erase_range, och kontrollerar att uttagna
+*               heltal, segment, int_deque_copy_out och utskrift r lika.
+*               Vid lyckad kontroll returneras 0, annars felkod 1.
+*
+*               - ops: Antalet operationer.
+********************************************************************************/
+static int verify_deque(const size_t ops)
+{
+   struct int_deque d;
+   struct int_vector ref, copy;
+   struct int_vector_view first, second;
+   unsigned state = 2463534242u;
+   int status = 0;
+
+   int_deque_init(&d);
+   int_vector_init(&ref);
+   int_vector_init(&copy);
+
+   if (!int_deque_pop_front(&d, 0) || !int_deque_pop_back(&d, 0) || int_deque_front(&d)) status = 1;
+
+   for (size_t i = 0; i < ops && !status; ++i)
+   {
+      const int num = (int)i;
+      int popped = 0;
+      state ^= state << 13;
+      state ^= state >> 17;
+      state ^= state << 5;
+
+      /* Insttningar r ngot vanligare, s att kn vxer och slr runt. */
+      switch (state % 5)
+      {
+         case 0:
+            if (int_deque_push_front(&d, num) || int_vector_insert_range(&ref, 0, &num, 1)) status = 1;
+            break;
+         case 1: case 2:
+            if (int_deque_push_back(&d, num) || int_vector_push(&ref, num)) status = 1;
+            break;
+         case 3:
+            if (ref.size == 0) break;
+            if (int_deque_pop_front(&d, &popped) || popped != ref.data[0] ||
+                int_vector_erase_range(&ref, 0, 1)) status = 1;
+            break;
+         default:
+            if (ref.size == 0) break;
+            if (int_deque_pop_back(&d, &popped) || popped != ref.data[ref.size - 1] ||
+                int_vector_pop(&ref)) status = 1;
+            break;
+      }
+   }
+
+   int_deque_segments(&d, &first, &second);
+   if (status || d.size != ref.size || first.size + second.size != ref.size ||
+       int_vector_view_sum(first) + int_vector_view_sum(second) != int_vector_sum(&ref) ||
+       int_vector_resize(&copy, ref.size) ||
+       int_deque_copy_out(&d, 0, ref.size + 1, copy.data) != ref.size ||
+       memcmp(copy.data, ref.data, sizeof(int) * ref.size) != 0 ||
+       int_deque_copy_out(&d, ref.size / 2, ref.size, copy.data) != ref.size - ref.size / 2 ||
+       memcmp(copy.data, ref.data + ref.size / 2, sizeof(int) * (ref.size - ref.size / 2)) != 0 ||
+       !same_print(print_deque, &d, print_vector, &ref))
+   {
+      status = 1;
+   }
+
+   /* Tm kn framifrn, s att kapaciteten krymper medan ringen slr runt. */
+   for (size_t i = 0; i < ref.size && !status; ++i)
+   {
+      int popped = 0;
+      if (int_deque_pop_front(&d, &popped) || popped != ref.data[i]) status = 1;
+   }
+
+   if (d.size != 0 || d.capacity > INT_VECTOR_MIN_CAPACITY * 2) status = 1;
+
+   int_deque_clear(&d);
+   int_vector_clear(&ref);
+   int_vector_clear(&copy);
+   return status;
+}
+
+/********************************************************************************
+* bench_deque: Anvnder en k med angiven lngd i angivet antal steg, dr
+*              varje steg lgger till ett heltal lngst bak och tar bort
+*              det frsta, dels med en int_vector via erase_range, dels med
+*              en int_deque, och mter tidstgngen per steg. Innan mtningen
+*              kontrolleras int_deque mot en int_vector, och eftert att
+*              bda kerna har tagit ut samma heltal. Vid lyckad kontroll
+*              returneras 0, annars felkod 1.
+*
+*              - ops   : Antalet steg.
+*              - length: Kns lngd.
+********************************************************************************/
+static int bench_deque(const size_t ops,
+                       const size_t length)
+{
+   struct int_vector v;
+   struct int_deque d;
+   long long sum_v = 0, sum_d = 0;
+   double start;
+   int status = verify_deque(ops);
+
+   int_vector_init(&v);
+   int_deque_init(&d);
+
+   for (size_t i = 0; i < length; ++i)
+   {
+      if (int_vector_push(&v, (int)i) || int_deque_push_back(&d, (int)i)) status = 1;
+   }
+
+   start = now();
+   for (size_t i = length; i < ops + length; ++i)
+   {
+      sum_v += v.data[0];
+      if (int_vector_erase_range(&v, 0, 1) || int_vector_push(&v, (int)i)) status = 1;
+   }
+   print_result("k (int_vector)", ops, 0, now() - start);
+
+   start = now();
+   for (size_t i = length; i < ops + length; ++i)
+   {
+      int popped = 0;
+      if (int_deque_pop_front(&d, &popped) || int_deque_push_back(&d, (int)i)) status = 1;
+      sum_d += popped;
+   }
+   print_result("k (int_deque)", ops, 0, now() - start);
+
+   if (sum_v != sum_d || v.size != d.size) status = 1;
+
+   int_vector_clear(&v);
+   int_deque_clear(&d);
+   return status;
+}
+
+/********************************************************************************
+* scale_num: Returnerar angivet heltal multiplicerat med heltalet i angivet
+*            sammanhang plus 1. Anvnds vid int_vector_parallel_transform.
+********************************************************************************/
+static int scale_num(const int num, void* context)
+{
+   return (int)((unsigned)num * (unsigned)*(const int*)context + 1u);
+}
+
+/********************************************************************************
+* mix_index: Blandar in angivet index i angivet heltal. Anvnds vid
+*            int_vector_parallel_for_each.
+********************************************************************************/
+static void mix_index(int* num, const size_t index, void* context)
+{
+   (void)context;
+   *num ^= (int)(index & 0xffff);
+   return;
+}
+
+/********************************************************************************
+* add_num: Returnerar angivet delresultat plus angivet heltal. Anvnds vid
+*          int_vector_parallel_reduce.
+********************************************************************************/
+static long long add_num(const long long result, const int num, void* context)
+{
+   (void)context;
+   return result + num;
+}
+
+/********************************************************************************
+* add_results: Returnerar summan av tv delresultat. Anvnds vid
+*              int_vector_parallel_reduce.
+********************************************************************************/
+static long long add_results(const long long first, const long long second, void* context)
+{
+   (void)context;
+   return first + second;
+}
+
+/********************************************************************************
+* verify_parallel: Kontrollerar att tilldelning, transformering, anrop per
+*                  heltal och summering via trdpoolen ger samma resultat som
+*                  motsvarande operationer i en trd, fr ett antal storlekar
+*                  under och ver INT_VECTOR_PARALLEL_MIN_SIZE samt fr
+*                  angivet antal trdar. Vid lyckad kontroll returneras 0,
+*                  annars felkod 1.
+*
+*                  - threads: Antalet trdar.
+********************************************************************************/
+static int verify_parallel(const size_t threads)
+{
+   static const size_t sizes[] =
+   {
+      0, 1, 1000, INT_VECTOR_PARALLEL_MIN_SIZE - 1, INT_VECTOR_PARALLEL_MIN_SIZE,
+      INT_VECTOR_PARALLEL_CHUNK * 7 + 17, 3000001
+   };
+   struct int_vector expected, actual;
+   int factor = -7;
+   int status = 0;
+
+   int_vector_set_parallel_threads(threads);
+   int_vector_init(&expected);
+   int_vector_init(&actual);
+
+   for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]) && !status; ++i)
+   {
+      if (int_vector_resize(&expected, sizes[i]) || int_vector_resize(&actual, sizes[i])) return 1;
+
+      int_vector_assign(&expected, INT_MAX - 1000, 12345);
+      int_vector_parallel_assign(&actual, INT_MAX - 1000, 12345);
+      if (memcmp(expected.data, actual.data, sizeof(int) * sizes[i]) ||
+          int_vector_parallel_reduce(&actual, 0, add_num, add_results, 0) != int_vector_sum(&expected))
+      {
+         status = 1;
+      }
+
+      for (size_t j = 0; j < expected.size; ++j)
+      {
+         expected.data[j] = scale_num(expected.data[j], &factor);
+         mix_index(&expected.data[j], j, 0);
+      }
+
+      if (int_vector_parallel_transform(&actual, &actual, scale_num, &factor)) status = 1;
+      int_vector_parallel_for_each(&actual, mix_index, 0);
+      if (memcmp(expected.data, actual.data, sizeof(int) * sizes[i])) status = 1;
+   }
+
+   /* Transformering till en annan vektor ndrar mlvektorns storlek. */
+   int_vector_clear(&actual);
+   if (int_vector_parallel_transform(&actual, &expected, scale_num, &factor) ||
+       actual.size != expected.size || actual.data[0] != scale_num(expected.data[0], &factor) ||
+       actual.data[actual.size - 1] != scale_num(expected.data[expected.size - 1], &factor))
+   {
+      status = 1;
+   }
+
+   int_vector_clear(&expected);
+   int_vector_clear(&actual);
+   return status;
+}
+
+/********************************************************************************
+* bench_parallel: Mter genomstrmningen fr int_vector_parallel_assign,
+*                 int_vector_parallel_transform och int_vector_parallel_reduce
+*                 med ett kande antal trdar, jmfrt med int_vector_assign
+*                 respektive int_vector_sum i en trd. Innan mtningen
+*                 kontrolleras att resultaten r lika med motsvarande
+*                 operationer i en trd. Vid lyckad kontroll returneras 0,
+*                 annars felkod 1.
+*
+*                 - size  : Antalet heltal i vektorn.
+*                 - rounds: Antalet omgngar per mtning.
+********************************************************************************/
+static int bench_parallel(const size_t size,
+                          const size_t rounds)
+{
+   struct int_vector v;
+   size_t max_threads;
+   long long sum;
+   int factor = 3;
+   double start;
+   int status = 0;
+
+   int_vector_set_parallel_threads(0);
+   max_threads = int_vector_parallel_threads() > 4 ? int_vector_parallel_threads() : 4;
+   for (size_t threads = 1; threads <= max_threads && !status; ++threads)
+   {
+      if (verify_parallel(threads)) status = 1;
+   }
+
+   int_vector_init(&v);
+   if (status || int_vector_resize(&v, size)) return 1;
+
+   start = now();
+   for (size_t i = 0; i < rounds; ++i) int_vector_assign(&v, (int)i, 3);
+   print_throughput("tilldelning (int_vector)", sizeof(int) * size * rounds, now() - start);
+
+   start = now();
+   for (size_t i = 0; i < rounds; ++i) sum = int_vector_sum(&v);
+   print_throughput("summering (int_vector)", sizeof(int) * size * rounds, now() - start);
+
+   for (size_t threads = 1; threads < 2 * max_threads; threads *= 2)
+   {
+      const size_t count = threads < max_threads ? threads : max_threads;
+      char name[64];
+
+      int_vector_set_parallel_threads(count);
+
+      start = now();
+      for (size_t i = 0; i < rounds; ++i) int_vector_parallel_assign(&v, (int)i, 3);
+      sprintf(name, "tilldelning (%zu trdar)", count);
+      print_throughput(name, sizeof(int) * size * rounds, now() - start);
+
+      start = now();
+      for (size_t i = 0; i < rounds; ++i) int_vector_parallel_transform(&v, &v, scale_num, &factor);
+      sprintf(name, "transform (%zu trdar)", count);
+      print_throughput(name, sizeof(int) * size * rounds, now() - start);
+
+      int_vector_parallel_assign(&v, (int)rounds - 1, 3);
+      start = now();
+      for (size_t i = 0; i < rounds; ++i)
+      {
+         if (int_vector_parallel_reduce(&v, 0, add_num, add_results, 0) != sum) status = 1;
+      }
+      sprintf(name, "reducering (%zu trdar)", count);
+      print_throughput(name, sizeof(int) * size * rounds, now() - start);
+   }
+
+   int_vector_set_parallel_threads(0);
+   int_vector_parallel_shutdown();
+   int_vector_clear(&v);
+   return status;
+}
+
+/********************************************************************************
+* main: Genomfr mtningarna och skriver ut antalet anrop till allokeraren
+*       samt tidstgngen per operation i terminalen. Om ngon vektoriserad
+*       krna avviker frn den skalra versionen returneras felkod 1.
+********************************************************************************/
+int main(void)
+{
+   bench_oscillate(1024, 1000000);
+   bench_sawtooth(100000, 10);
+   bench_print(10000000);
+   if (bench_load(10000000))
+   {
+      printf("mappad vektor: lnat minne har ndrats!\n");
+      return 1;
+   }
+
+   if (verify_pipe())
+   {
+      printf("inlsning via rr: efterfljande vektor har gtt frlorad!\n");
+      return 1;
+   }
+
+   bench_small(1000000);
+
+   if (bench_allocators(100000))
+   {
+      printf("kortlivade vektorer: resultatet avviker mellan allokerarna!\n");
+      return 1;
+   }
+
+   if (bench_sort(10000000))
+   {
+      printf("sortering: resultatet avviker frn qsort!\n");
+      return 1;
+   }
+
+   if (bench_huge((size_t)1 << 26))
+   {
+      printf("stor vektor: innehllet r felaktigt!\n");
+      return 1;
+   }
+
+   if (bench_concurrent(20000000, 32))
+   {
+      printf("samtidig vektor: heltal har gtt frlorade!\n");
+      return 1;
+   }
+
+   if (bench_stats(100000, 10))
+   {
+      printf("instrumentering: samtliga allokeringar har inte frigjorts!\n");
+      return 1;
+   }
+
+   if (bench_family(10000000, 20))
+   {
+      printf("vektorfamilj: vektortyperna ger olika resultat!\n");
+      return 1;
+   }
+
+   if (bench_lazy(10000000) || bench_packed(10000000, 20))
+   {
+      printf("lat/komprimerad vektor: resultatet avviker frn int_vector!\n");
+      return 1;
+   }
+
+   if (bench_writer(2000000, 10))
+   {
+      printf("asynkron utskrift: filen avviker frn int_vector_print!\n");
+      return 1;
+   }
+
+   if (bench_dump(20000000))
+   {
+      printf("parallell utskrift: filen avviker frn int_vector_print!\n");
+      return 1;
+   }
+
+   if (bench_shared(10000000, 16))
+   {
+      printf("delad vektor: vyer eller kopior avviker frn originalet!\n");
+      return 1;
+   }
+
+   if (bench_deque(1000000, 1000))
+   {
+      printf("dubbelsidig k: resultatet avviker frn int_vector!\n");
+      return 1;
+   }
+
+   if (bench_parallel(50000000, 10))
+   {
+      printf("trdpool: resultatet avviker frn en trd!\n");
+      return 1;
+   }
+
+   if (bench_assign(10000000, 20)) return 1;
+   return bench_scan(10000000, 20);
+}
\ No newline at end of file
@@ -0,0 +1,492 @@
+/********************************************************************************
+* benchmark_suite.c: Mtsvit fr uppfljning av prestanda mellan versioner.
+*                    Samtliga operationer mts fr storlekarna 10, 100, 1000
+*                    och s vidare upp till angiven strsta storlek
+*                    (default 10^8), dr fljande operationer mts:
+*
+*                    - push        : int_vector_push frn tom vektor.
+*                    - pop         : int_vector_pop tills vektorn r tom.
+*                    - resize      : int_vector_resize med ett heltal i taget.
+*                    - assign      : int_vector_assign.
+*                    - print_null  : int_vector_print till /dev/null.
+*                    - print_file  : int_vector_print till en temporr fil.
+*                    - array_resize: int_array_resize med ett heltal i taget.
+*                    - array_assign: int_array_assign.
+*
+*                    Fr sm storlekar upprepas varje operation s att minst
+*                    SUITE_MIN_OPS operationer mts. Fr varje mtning anges
+*                    tidstgng per heltal (ns/op), antalet anrop till
+*                    allokeraren per upprepning samt hgsta anvnda
+*                    arbetsminne (peak RSS) under mtningen. Resultatet
+*                    skrivs till stdout som CSV eller JSON, s att resultat
+*                    frn olika versioner kan jmfras.
+*
+*                    Eftersom funktionerna fr int_array r statiska i
+*                    filen func.c inkluderas den filen direkt, dr dess
+*                    funktion main dps om.
+*
+*                    Kompilera via "make benchmark_suite" och kr exempelvis
+*                    enligt nedan:
+*
+*                    ./benchmark_suite csv > resultat.csv
+*                    ./benchmark_suite json 1000000 > resultat.json
+********************************************************************************/
+#define _POSIX_C_SOURCE 200809L /* Krvs fr clock_gettime och getrusage. */
+#include "int_vector.h"
+#include "int_simd.h"
+
+#include <string.h>       /* Innehller strcmp och strncmp. */
+#include <time.h>         /* Innehller clock_gettime. */
+#include <sys/resource.h> /* Innehller getrusage. */
+
+#define main func_main
+#include "func.c"
+#undef main
+
+/********************************************************************************
+* SUITE_MIN_OPS: Minsta antalet operationer per mtning, dr operationen
+*                upprepas fr sm storlekar tills antalet uppns.
+********************************************************************************/
+#define SUITE_MIN_OPS 10000000
+
+/********************************************************************************
+* SUITE_POP_BATCH: Hgsta antalet vektorer som fylls i frvg innan deras
+*                  popoperationer mts i ett svep.
+********************************************************************************/
+#define SUITE_POP_BATCH 4096
+
+/********************************************************************************
+* suite_result: Strukt fr resultatet av en mtning.
+********************************************************************************/
+struct suite_result
+{
+   const char* operation; /* Operationens namn. */
+   size_t size;           /* Antalet heltal per upprepning. */
+   size_t repetitions;    /* Antalet upprepningar. */
+   double ns;             /* Total tidstgng i nanosekunder. */
+   size_t alloc_calls;    /* Totalt antal anrop till allokeraren. */
+   long peak_rss;         /* Hgsta anvnda arbetsminne i KiB, -1 om oknt. */
+};
+
+/********************************************************************************
+* counting_allocator: Strukt fr en allokerare som vidarebefordrar anropen till
+*                     malloc, realloc och free samt rknar antalet anrop.
+********************************************************************************/
+struct counting_allocator
+{
+   struct allocator base; /* Allokeringsgrnssnittet. */
+   size_t calls;          /* Antalet anrop till allokeraren. */
+};
+
+/********************************************************************************
+* counting_allocate, counting_reallocate, counting_deallocate: Rknar upp
+*                    anropen och vidarebefordrar dem till malloc, realloc
+*                    respektive free.
+********************************************************************************/
+static void* counting_allocate(void* context,
+                               size_t size)
+{
+   ((struct counting_allocator*)context)->calls++;
+   return malloc(size);
+}
+
+static void* counting_reallocate(void* context,
+                                 void* block,
+                                 size_t old_size,
+                                 size_t new_size)
+{
+   (void)old_size;
+   ((struct counting_allocator*)context)->calls++;
+   return realloc(block, new_size);
+}
+
+static void counting_deallocate(void* context,
+                                void* block,
+                                size_t size)
+{
+   (void)size;
+   ((struct counting_allocator*)context)->calls++;
+   free(block);
+   return;
+}
+
+/* Statiska variabler: */
+static struct counting_allocator counting =
+{
+   { counting_allocate, counting_reallocate, counting_deallocate, &counting }, 0
+};
+
+/********************************************************************************
+* now: Returnerar aktuell tidpunkt i nanosekunder frn en monoton klocka.
+********************************************************************************/
+static double now(void)
+{
+   struct timespec ts;
+   clock_gettime(CLOCK_MONOTONIC, &ts);
+   return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+/********************************************************************************
+* peak_rss_reset: terstller processens hgsta anvnda arbetsminne till
+*                 nuvarande arbetsminne, s att nsta mtning fr ett eget
+*                 vrde. Stds endast p Linux, annars gller vrdet fr hela
+*                 krningen.
+********************************************************************************/
+static void peak_rss_reset(void)
+{
+   FILE* file = fopen("/proc/self/clear_refs", "w");
+   if (!file) return;
+   fputs("5", file);
+   fclose(file);
+   return;
+}
+
+/********************************************************************************
+* peak_rss: Returnerar processens hgsta anvnda arbetsminne i KiB sedan
+*           senaste terstllningen, eller -1 om vrdet inte kan avlsas.
+********************************************************************************/
+static long peak_rss(void)
+{
+   FILE* file = fopen("/proc/self/status", "r");
+   char line[256];
+   long kib = -1;
+
+   if (file)
+   {
+      while (fgets(line, sizeof(line), file))
+      {
+         if (!strncmp(line, "VmHWM:", 6))
+         {
+            kib = strtol(line + 6, 0, 10);
+            break;
+         }
+      }
+
+      fclose(file);
+   }
+
+   if (kib < 0)
+   {
+      struct rusage usage;
+      if (!getrusage(RUSAGE_SELF, &usage)) kib = usage.ru_maxrss;
+   }
+
+   return kib;
+}
+
+/********************************************************************************
+* run_push: Fyller en vektor med angivet antal heltal via int_vector_push och
+*           tmmer den, angivet antal gnger. Returnerar tidstgngen.
+*
+*           - size: Antalet heltal per upprepning.
+*           - reps: Antalet upprepningar.
+********************************************************************************/
+static double run_push(const size_t size,
+                       const size_t reps)
+{
+   struct int_vector v;
+   const double start = now();
+
+   for (size_t r = 0; r < reps; ++r)
+   {
+      int_vector_init_with(&v, &counting.base);
+      for (size_t i = 0; i < size; ++i) int_vector_push(&v, (int)i);
+      int_vector_clear(&v);
+   }
+
+   return now() - start;
+}
+
+/********************************************************************************
+* run_pop: Fyller vektorer med angivet antal heltal och mter drefter
+*          int_vector_pop tills vektorerna r tomma, angivet antal gnger.
+*          Vektorerna fylls i omgngar om hgst SUITE_POP_BATCH vektorer,
+*          s att endast popoperationerna mts. Returnerar tidstgngen.
+*
+*          - size: Antalet heltal per upprepning.
+*          - reps: Antalet upprepningar.
+********************************************************************************/
+static double run_pop(const size_t size,
+                      const size_t reps)
+{
+   const size_t batch = reps < SUITE_POP_BATCH ? reps : SUITE_POP_BATCH;
+   struct int_vector* vectors = (struct int_vector*)malloc(sizeof(struct int_vector) * batch);
+   double ns = 0;
+
+   if (!vectors) return 0;
+
+   for (size_t r = 0; r < reps; r += batch)
+   {
+      const size_t count = reps - r < batch ? reps - r : batch;
+      double start;
+
+      for (size_t k = 0; k < count; ++k)
+      {
+         int_vector_init_with(&vectors[k], &counting.base);
+         int_vector_resize(&vectors[k], size);
+      }
+
+      start = now();
+
+      for (size_t k = 0; k < count; ++k)
+      {
+         for (size_t i = 0; i < size; ++i) int_vector_pop(&vectors[k]);
+      }
+
+      ns += now() - start;
+      for (size_t k = 0; k < count; ++k) int_vector_clear(&vectors[k]);
+   }
+
+   free(vectors);
+   return ns;
+}
+
+/********************************************************************************
+* run_resize: Vxer en vektor till angiven storlek via int_vector_resize med
+*             ett heltal i taget och tmmer den, angivet antal gnger.
+*             Returnerar tidstgngen.
+*
+*             - size: Antalet heltal per upprepning.
+*             - reps: Antalet upprepningar.
+********************************************************************************/
+static double run_resize(const size_t size,
+                         const size_t reps)
+{
+   struct int_vector v;
+   const double start = now();
+
+   for (size_t r = 0; r < reps; ++r)
+   {
+      int_vector_init_with(&v, &counting.base);
+      for (size_t i = 1; i <= size; ++i) int_vector_resize(&v, i);
+      int_vector_clear(&v);
+   }
+
+   return now() - start;
+}
+
+/********************************************************************************
+* run_assign: Tilldelar en vektor av angiven storlek via int_vector_assign
+*             angivet antal gnger. Returnerar tidstgngen.
+*
+*             - size: Antalet heltal i vektorn.
+*             - reps: Antalet upprepningar.
+********************************************************************************/
+static double run_assign(const size_t size,
+                         const size_t reps)
+{
+   struct int_vector v;
+   double start;
+
+   int_vector_init_with(&v, &counting.base);
+   if (int_vector_resize(&v, size)) return 0;
+   start = now();
+   for (size_t r = 0; r < reps; ++r) int_vector_assign(&v, (int)r, 2);
+   start = now() - start;
+   int_vector_clear(&v);
+   return start;
+}
+
+/********************************************************************************
+* run_print: Skriver ut en vektor av angiven storlek via int_vector_print
+*            till angiven utstrm angivet antal gnger. Vid utskrift till en
+*            fil spolas filen tillbaka fre varje utskrift, s att filens
+*            storlek inte vxer med antalet upprepningar. Returnerar
+*            tidstgngen.
+*
+*            - size   : Antalet heltal i vektorn.
+*            - reps   : Antalet upprepningar.
+*            - ostream: Pekare till utstrmmen.
+*            - seek   : Indikerar ifall utstrmmen ska spolas tillbaka.
+********************************************************************************/
+static double run_print(const size_t size,
+                        const size_t reps,
+                        FILE* ostream,
+                        const int seek)
+{
+   struct int_vector v;
+   double start;
+
+   int_vector_init_with(&v, &counting.base);
+   if (int_vector_resize(&v, size)) return 0;
+   int_vector_assign(&v, -(int)(size / 2), 1);
+   start = now();
+
+   for (size_t r = 0; r < reps; ++r)
+   {
+      if (seek) fseek(ostream, 0, SEEK_SET);
+      int_vector_print(&v, ostream);
+   }
+
+   fflush(ostream);
+   start = now() - start;
+   int_vector_clear(&v);
+   return start;
+}
+
+/********************************************************************************
+* run_array_resize: Vxer en array till angiven storlek via int_array_resize
+*                   med ett heltal i taget och frigr den, angivet antal
+*                   gnger. Varje anrop medfr ett anrop till realloc.
+*                   Returnerar tidstgngen.
+*
+*                   - size: Antalet heltal per upprepning.
+*                   - reps: Antalet upprepningar.
+********************************************************************************/
+static double run_array_resize(const size_t size,
+                               const size_t reps)
+{
+   const double start = now();
+
+   for (size_t r = 0; r < reps; ++r)
+   {
+      int* data = 0;
+      size_t array_size = 0;
+
+      for (size_t i = 1; i <= size; ++i)
+      {
+         if (int_array_resize(&data, &array_size, i)) break;
+         counting.calls++;
+      }
+
+      int_array_delete(&data);
+      counting.calls++;
+   }
+
+   return now() - start;
+}
+
+/********************************************************************************
+* run_array_assign: Tilldelar en array av angiven storlek via int_array_assign
+*                   angivet antal gnger. Returnerar tidstgngen.
+*
+*                   - size: Antalet heltal i arrayen.
+*                   - reps: Antalet upprepningar.
+********************************************************************************/
+static double run_array_assign(const size_t size,
+                               const size_t reps)
+{
+   int* data = int_array_new(size);
+   double start;
+
+   if (!data) return 0;
+   counting.calls++;
+   start = now();
+   for (size_t r = 0; r < reps; ++r) int_array_assign(data, size, 2);
+   start = now() - start;
+   int_array_delete(&data);
+   counting.calls++;
+   return start;
+}
+
+/********************************************************************************
+* print_csv: Skriver ut angivet resultat som en rad i CSV-format.
+*
+*            - result: Pekare till resultatet.
+********************************************************************************/
+static void print_csv(const struct suite_result* result)
+{
+   printf("%s,%zu,%zu,%.3f,%.3f,%ld\n", result->operation, result->size, result->repetitions,
+          result->ns / ((double)result->size * (double)result->repetitions),
+          (double)result->alloc_calls / (double)result->repetitions, result->peak_rss);
+   return;
+}
+
+/********************************************************************************
+* print_json: Skriver ut angivet resultat som ett objekt i JSON-format.
+*
+*             - result: Pekare till resultatet.
+*             - first : Indikerar ifall resultatet r det frsta i listan.
+********************************************************************************/
+static void print_json(const struct suite_result* result,
+                       const int first)
+{
+   printf("%s    { \"operation\": \"%s\", \"size\": %zu, \"repetitions\": %zu, "
+          "\"ns_per_op\": %.3f, \"alloc_calls\": %.3f, \"peak_rss_kib\": %ld }",
+          first ? "" : ",\n", result->operation, result->size, result->repetitions,
+          result->ns / ((double)result->size * (double)result->repetitions),
+          (double)result->alloc_calls / (double)result->repetitions, result->peak_rss);
+   return;
+}
+
+/********************************************************************************
+* main: Genomfr samtliga mtningar och skriver ut resultatet. Frsta
+*       argumentet anger formatet (csv eller json, default csv) och andra
+*       argumentet strsta storlek (default 10^8). Vid felaktiga argument
+*       eller om utstrmmarna inte kan ppnas returneras felkod 1.
+*
+*       - argc: Antalet argument.
+*       - argv: Pekare till fltet med argument.
+********************************************************************************/
+int main(int argc,
+         char** argv)
+{
+   static const char* operations[] =
+   {
+      "push", "pop", "resize", "assign", "print_null", "print_file", "array_resize",
+      "array_assign"
+   };
+   const int json = argc > 1 && !strcmp(argv[1], "json");
+   const size_t max_size = argc > 2 ? (size_t)strtoull(argv[2], 0, 10) : 100000000;
+   FILE* null_stream = fopen("/dev/null", "w");
+   FILE* file_stream = tmpfile();
+   int first = 1;
+
+   if ((argc > 1 && !json && strcmp(argv[1], "csv")) || max_size < 10 ||
+       !null_stream || !file_stream)
+   {
+      fprintf(stderr, "Anvndning: %s [csv|json] [strsta storlek >= 10]\n", argv[0]);
+      if (null_stream) fclose(null_stream);
+      if (file_stream) fclose(file_stream);
+      return 1;
+   }
+
+   if (json)
+   {
+      printf("{\n  \"isa\": \"%s\",\n  \"small_capacity\": %d,\n  \"results\": [\n",
+             int_simd_isa_name(int_simd_isa()), INT_VECTOR_SMALL_CAPACITY);
+   }
+   else
+   {
+      printf("operation,size,repetitions,ns_per_op,alloc_calls,peak_rss_kib\n");
+   }
+
+   for (size_t size = 10; size <= max_size; size *= 10)
+   {
+      const size_t reps = size < SUITE_MIN_OPS ? SUITE_MIN_OPS / size : 1;
+
+      for (size_t i = 0; i < sizeof(operations) / sizeof(operations[0]); ++i)
+      {
+         struct suite_result result = { operations[i], size, reps, 0, 0, -1 };
+         counting.calls = 0;
+         peak_rss_reset();
+
+         switch (i)
+         {
+            case 0: result.ns = run_push(size, reps); break;
+            case 1: result.ns = run_pop(size, reps); break;
+            case 2: result.ns = run_resize(size, reps); break;
+            case 3: result.ns = run_assign(size, reps); break;
+            case 4: result.ns = run_print(size, reps, null_stream, 0); break;
+            case 5: result.ns = run_print(size, reps, file_stream, 1); break;
+            case 6: result.ns = run_array_resize(size, reps); break;
+            default: result.ns = run_array_assign(size, reps); break;
+         }
+
+         result.alloc_calls = counting.calls;
+         result.peak_rss = peak_rss();
+
+         if (json) print_json(&result, first);
+         else print_csv(&result);
+         fflush(stdout);
+         first = 0;
+      }
+
+      if (size > max_size / 10) break;
+   }
+
+   if (json) printf("\n  ]\n}\n");
+   fclose(null_stream);
+   fclose(file_stream);
+   return 0;
+}
\ No newline at end of file
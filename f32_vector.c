@@ -0,0 +1,13 @@
+/********************************************************************************
+* f32_vector.c: Innehller definitioner av associerade externa funktioner fr
+*               strukten f32_vector, som genereras via vector_template_impl.h.
+********************************************************************************/
+#include "f32_vector.h"
+
+#define VECTOR_NAME f32_vector
+#define VECTOR_TYPE float
+#define VECTOR_SUM_TYPE double
+#define VECTOR_FLOATING
+#define VECTOR_LINES int_format_lines_f32
+#define VECTOR_MAX_LINE INT_FORMAT_F32_MAX_LINE
+#include "vector_template_impl.h"
\ No newline at end of file
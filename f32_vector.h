@@ -0,0 +1,21 @@
+/********************************************************************************
+* f32_vector.h: Innehller strukten f32_vector fr dynamiska arrayer
+*               innehllande flyttal av typen float samt associerade
+*               funktioner, vilka genereras via mallen i vector_template.h
+*               med samma grnssnitt som int_vector. Summan berknas i
+*               dubbel precision och utskrift sker med formatet "%g".
+********************************************************************************/
+#ifndef F32_VECTOR_H_
+#define F32_VECTOR_H_
+
+/* Inkluderingsdirektiv: */
+#include "allocator.h"
+#include "int_vector_stats.h"
+
+#define VECTOR_NAME f32_vector
+#define VECTOR_TYPE float
+#define VECTOR_SUM_TYPE double
+#define VECTOR_SMALL_CAPACITY (VECTOR_SMALL_BYTES / sizeof(float))
+#include "vector_template.h"
+
+#endif /* F32_VECTOR_H_ */
\ No newline at end of file
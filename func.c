@@ -102,6 +102,9 @@
 #include <stdio.h>  /*Innehller printf, FILE* med mera. */
 #include <stdlib.h> /* Innehller malloc, realloc, free med mera. */
 
+#include "int_format.h" /* Innehller int_format_print. */
+#include "int_simd.h"   /* Innehller int_simd_assign. */
+
 /********************************************************************************
 * int_array_new: Returnerar pekare till ett dynamiskt allokerat flt av angiven
 *                storlek. Om minnesallokeringen misslyckas s returneras null.
@@ -159,6 +162,8 @@ static int int_array_resize(int** data,
 
 /********************************************************************************
 * int_array_assign: Tilldelar heltal till angiven array med angivet stegvrde.
+*                   Tilldelningen sker vektoriserat via int_simd_assign, se
+*                   int_simd.h, dr verslag ger tvkomplementsomslag.
 * 
 *                   - data: Pekare till arrayen.
 *                   - size: Arrayens storlek, dvs. antalet heltal den rymmer.
@@ -168,18 +173,15 @@ static void int_array_assign(int* data,
                              const size_t size,
                              const int step)
 {
-   for (int i = 0; i < size; ++i)
-   {
-      data[i] = i * step;
-   }
-
+   int_simd_assign(data, size, 0, step);
    return;
 }
 
 /********************************************************************************
 * int_array_print: Skriver ut heltal lagrade i angiven array via angiven utstrm,
 *                  dr standardutenhet stdout anvnds som default fr utskrift
-*                  i terminalen.
+*                  i terminalen. Heltalen formateras buffrat via
+*                  int_format_print, se int_format.h.
 * 
 *                  - data   : Pekare till arrayen vars innehll ska skrivas ut.
 *                  - size   : Arrayens storlek, dvs. antalet heltal den rymmer.
@@ -189,17 +191,7 @@ static void int_array_print(const int* data,
                             const size_t size,
                             FILE* ostream)
 {
-   if (size == 0) return;
-   if (!ostream) ostream = stdout;
-
-   fprintf(ostream, "--------------------------------------------------------------------------------\n");
-
-   for (size_t i = 0; i < size; ++i)
-   {
-      fprintf(ostream, "%d\n", data[i]);
-   }
-
-   fprintf(ostream, "--------------------------------------------------------------------------------\n\n");
+   int_format_print(data, size, ostream, 0, 0);
    return;
 }
 
@@ -0,0 +1,13 @@
+/********************************************************************************
+* i16_vector.c: Innehller definitioner av associerade externa funktioner fr
+*               strukten i16_vector, som genereras via vector_template_impl.h.
+********************************************************************************/
+#include "i16_vector.h"
+
+#define VECTOR_NAME i16_vector
+#define VECTOR_TYPE int16_t
+#define VECTOR_SUM_TYPE long long
+#define VECTOR_UNSIGNED_TYPE uint16_t
+#define VECTOR_LINES int_format_lines_i16
+#define VECTOR_MAX_LINE INT_FORMAT_I16_MAX_LINE
+#include "vector_template_impl.h"
\ No newline at end of file
@@ -0,0 +1,22 @@
+/********************************************************************************
+* i16_vector.h: Innehller strukten i16_vector fr dynamiska arrayer innehllande
+*               16-bitars heltal samt associerade funktioner, vilka genereras via
+*               mallen i vector_template.h med samma grnssnitt som
+*               int_vector. Summan returneras som ett 64-bitars tal.
+********************************************************************************/
+#ifndef I16_VECTOR_H_
+#define I16_VECTOR_H_
+
+/* Inkluderingsdirektiv: */
+#include <stdint.h> /* Innehller int16_t. */
+
+#include "allocator.h"
+#include "int_vector_stats.h"
+
+#define VECTOR_NAME i16_vector
+#define VECTOR_TYPE int16_t
+#define VECTOR_SUM_TYPE long long
+#define VECTOR_SMALL_CAPACITY (VECTOR_SMALL_BYTES / sizeof(int16_t))
+#include "vector_template.h"
+
+#endif /* I16_VECTOR_H_ */
\ No newline at end of file
@@ -0,0 +1,56 @@
+/********************************************************************************
+* i32_vector.h: Innehller namnet i32_vector fr vektorer innehllande 32-bitars
+*               heltal, s att samtliga typer i vector_family.h kan anvndas
+*               med enhetliga namn. Eftersom int_vector redan lagrar heltal av
+*               typen int, som r 32 bitar p samtliga plattformar som stds,
+*               r i32_vector ett alias fr int_vector i stllet fr en egen
+*               typ. Drmed frblir befintlig kod som anvnder int_vector
+*               ofrndrad, och vektorer kan skickas mellan bda namnen.
+********************************************************************************/
+#ifndef I32_VECTOR_H_
+#define I32_VECTOR_H_
+
+/* Inkluderingsdirektiv: */
+#include <limits.h> /* Innehller INT_MAX. */
+
+#include "int_vector.h"
+
+#if INT_MAX != 2147483647
+#error "i32_vector frutstter att int r 32 bitar!"
+#endif
+
+#define i32_vector int_vector
+#define i32_vector_init int_vector_init
+#define i32_vector_init_with int_vector_init_with
+#define i32_vector_is_small int_vector_is_small
+#define i32_vector_clear int_vector_clear
+#define i32_vector_new int_vector_new
+#define i32_vector_new_with int_vector_new_with
+#define i32_vector_delete int_vector_delete
+#define i32_vector_delete_with int_vector_delete_with
+#define i32_vector_begin int_vector_begin
+#define i32_vector_end int_vector_end
+#define i32_vector_last int_vector_last
+#define i32_vector_capacity int_vector_capacity
+#define i32_vector_set_growth_factor int_vector_set_growth_factor
+#define i32_vector_growth_factor int_vector_growth_factor
+#define i32_vector_set_shrink_threshold int_vector_set_shrink_threshold
+#define i32_vector_shrink_threshold int_vector_shrink_threshold
+#define i32_vector_reserve int_vector_reserve
+#define i32_vector_shrink_to_fit int_vector_shrink_to_fit
+#define i32_vector_resize int_vector_resize
+#define i32_vector_push int_vector_push
+#define i32_vector_pop int_vector_pop
+#define i32_vector_append int_vector_append
+#define i32_vector_insert_range int_vector_insert_range
+#define i32_vector_erase_range int_vector_erase_range
+#define i32_vector_concat int_vector_concat
+#define i32_vector_assign int_vector_assign
+#define i32_vector_sum int_vector_sum
+#define i32_vector_minmax int_vector_minmax
+#define i32_vector_count_eq int_vector_count_eq
+#define i32_vector_count_range int_vector_count_range
+#define i32_vector_find int_vector_find
+#define i32_vector_print int_vector_print
+
+#endif /* I32_VECTOR_H_ */
\ No newline at end of file
@@ -0,0 +1,13 @@
+/********************************************************************************
+* i64_vector.c: Innehller definitioner av associerade externa funktioner fr
+*               strukten i64_vector, som genereras via vector_template_impl.h.
+********************************************************************************/
+#include "i64_vector.h"
+
+#define VECTOR_NAME i64_vector
+#define VECTOR_TYPE int64_t
+#define VECTOR_SUM_TYPE long long
+#define VECTOR_UNSIGNED_TYPE uint64_t
+#define VECTOR_LINES int_format_lines_i64
+#define VECTOR_MAX_LINE INT_FORMAT_I64_MAX_LINE
+#include "vector_template_impl.h"
\ No newline at end of file
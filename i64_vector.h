@@ -0,0 +1,22 @@
+/********************************************************************************
+* i64_vector.h: Innehller strukten i64_vector fr dynamiska arrayer innehllande
+*               64-bitars heltal samt associerade funktioner, vilka genereras via
+*               mallen i vector_template.h med samma grnssnitt som
+*               int_vector. Summan slr om vid verslag.
+********************************************************************************/
+#ifndef I64_VECTOR_H_
+#define I64_VECTOR_H_
+
+/* Inkluderingsdirektiv: */
+#include <stdint.h> /* Innehller int64_t. */
+
+#include "allocator.h"
+#include "int_vector_stats.h"
+
+#define VECTOR_NAME i64_vector
+#define VECTOR_TYPE int64_t
+#define VECTOR_SUM_TYPE long long
+#define VECTOR_SMALL_CAPACITY (VECTOR_SMALL_BYTES / sizeof(int64_t))
+#include "vector_template.h"
+
+#endif /* I64_VECTOR_H_ */
\ No newline at end of file
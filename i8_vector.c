@@ -0,0 +1,13 @@
+/********************************************************************************
+* i8_vector.c: Innehller definitioner av associerade externa funktioner fr
+*              strukten i8_vector, som genereras via vector_template_impl.h.
+********************************************************************************/
+#include "i8_vector.h"
+
+#define VECTOR_NAME i8_vector
+#define VECTOR_TYPE int8_t
+#define VECTOR_SUM_TYPE long long
+#define VECTOR_UNSIGNED_TYPE uint8_t
+#define VECTOR_LINES int_format_lines_i8
+#define VECTOR_MAX_LINE INT_FORMAT_I8_MAX_LINE
+#include "vector_template_impl.h"
\ No newline at end of file
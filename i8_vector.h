@@ -0,0 +1,22 @@
+/********************************************************************************
+* i8_vector.h: Innehller strukten i8_vector fr dynamiska arrayer innehllande
+*              8-bitars heltal samt associerade funktioner, vilka genereras via
+*              mallen i vector_template.h med samma grnssnitt som
+*              int_vector. Summan returneras som ett 64-bitars tal.
+********************************************************************************/
+#ifndef I8_VECTOR_H_
+#define I8_VECTOR_H_
+
+/* Inkluderingsdirektiv: */
+#include <stdint.h> /* Innehller int8_t. */
+
+#include "allocator.h"
+#include "int_vector_stats.h"
+
+#define VECTOR_NAME i8_vector
+#define VECTOR_TYPE int8_t
+#define VECTOR_SUM_TYPE long long
+#define VECTOR_SMALL_CAPACITY (VECTOR_SMALL_BYTES / sizeof(int8_t))
+#include "vector_template.h"
+
+#endif /* I8_VECTOR_H_ */
\ No newline at end of file
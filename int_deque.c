@@ -0,0 +1,261 @@
+/********************************************************************************
+* int_deque.c: Innehller definitioner av associerade funktioner fr strukten
+*              int_deque.
+********************************************************************************/
+#include "int_deque.h"
+#include "int_format.h"
+
+#include <stdint.h> /* Innehller SIZE_MAX. */
+#include <string.h> /* Innehller memcpy. */
+
+/********************************************************************************
+* ring_capacity: Returnerar minsta tvpotens som rymmer angivet antal heltal,
+*                dock minst INT_VECTOR_MIN_CAPACITY, eller 0 om en sdan
+*                kapacitet inte kan allokeras.
+*
+*                - required: Minsta antal heltal som ska rymmas.
+********************************************************************************/
+static size_t ring_capacity(const size_t required)
+{
+   size_t capacity = 1;
+
+   while (capacity < required || capacity < INT_VECTOR_MIN_CAPACITY)
+   {
+      if (capacity > SIZE_MAX / sizeof(int) / 2) return 0;
+      capacity *= 2;
+   }
+
+   return capacity;
+}
+
+/********************************************************************************
+* grow: kar kapaciteten fr angiven k till angiven tvpotens via
+*       omallokering. Om kn slr runt flyttas segmentet i ringens brjan
+*       till utrymmet direkt efter det gamla fltets slut, vilket ryms
+*       eftersom kapaciteten minst frdubblas. Vid lyckad omallokering
+*       returneras 0, annars returneras felkod 1 och kn lmnas intakt.
+*
+*       - self    : Pekare till kn.
+*       - capacity: Den nya kapaciteten.
+********************************************************************************/
+static int grow(struct int_deque* self,
+                const size_t capacity)
+{
+   int* data;
+
+   if (self->capacity == 0)
+   {
+      data = (int*)allocator_alloc(self->allocator, sizeof(int) * capacity);
+      if (!data) return 1;
+      INT_VECTOR_STATS_ALLOC(sizeof(int) * capacity);
+   }
+   else
+   {
+      data = (int*)allocator_realloc(self->allocator, self->data, sizeof(int) * self->capacity,
+                                     sizeof(int) * capacity);
+      if (!data) return 1;
+      INT_VECTOR_STATS_REALLOC(self->data, data, sizeof(int) * self->capacity,
+                               sizeof(int) * capacity);
+   }
+
+   if (self->head + self->size > self->capacity)
+   {
+      const size_t wrapped = self->head + self->size - self->capacity;
+      memcpy(data + self->capacity, data, sizeof(int) * wrapped);
+      INT_VECTOR_STATS_COPY(sizeof(int) * wrapped);
+   }
+
+   self->data = data;
+   self->capacity = capacity;
+   return 0;
+}
+
+/********************************************************************************
+* shrink_if_sparse: Halverar kapaciteten fr angiven k om storleken
+*                   understiger int_vectors lgvattenmrke, dock aldrig under
+*                   INT_VECTOR_MIN_CAPACITY. Heltalen kopieras d i ordning
+*                   till brjan av ett nytt flt. En misslyckad krympning
+*                   lmnar kn intakt och kan drmed ignoreras.
+*
+*                   - self: Pekare till kn.
+********************************************************************************/
+static void shrink_if_sparse(struct int_deque* self)
+{
+   const size_t capacity = self->capacity / 2;
+   int* data;
+
+   if (capacity < INT_VECTOR_MIN_CAPACITY ||
+       !((double)self->size < (double)self->capacity * int_vector_shrink_threshold())) return;
+
+   data = (int*)allocator_alloc(self->allocator, sizeof(int) * capacity);
+   if (!data) return;
+   INT_VECTOR_STATS_ALLOC(sizeof(int) * capacity);
+
+   int_deque_copy_out(self, 0, self->size, data);
+   INT_VECTOR_STATS_COPY(sizeof(int) * self->size);
+   allocator_free(self->allocator, self->data, sizeof(int) * self->capacity);
+   INT_VECTOR_STATS_FREE(sizeof(int) * self->capacity);
+
+   self->data = data;
+   self->head = 0;
+   self->capacity = capacity;
+   return;
+}
+
+/********************************************************************************
+* int_deque_reserve: Skerstller att angiven k har kapacitet fr minst
+*                    angivet antal heltal.
+*
+*                    - self    : Pekare till kn.
+*                    - capacity: Minsta kapacitet efter anropet.
+********************************************************************************/
+int int_deque_reserve(struct int_deque* self,
+                      const size_t capacity)
+{
+   size_t rounded;
+   if (capacity <= self->capacity) return 0;
+   if (!(rounded = ring_capacity(capacity))) return 1;
+   return grow(self, rounded);
+}
+
+/********************************************************************************
+* int_deque_push_back: Lgger till ett heltal lngst bak i angiven k.
+*
+*                      - self: Pekare till kn.
+*                      - num : Heltalet som ska lggas till.
+********************************************************************************/
+int int_deque_push_back(struct int_deque* self,
+                        const int num)
+{
+   if (self->size == self->capacity && int_deque_reserve(self, self->size + 1)) return 1;
+   *int_deque_at(self, self->size) = num;
+   self->size++;
+   return 0;
+}
+
+/********************************************************************************
+* int_deque_push_front: Lgger till ett heltal lngst fram i angiven k.
+*
+*                       - self: Pekare till kn.
+*                       - num : Heltalet som ska lggas till.
+********************************************************************************/
+int int_deque_push_front(struct int_deque* self,
+                         const int num)
+{
+   if (self->size == self->capacity && int_deque_reserve(self, self->size + 1)) return 1;
+   self->head = (self->head - 1) & (self->capacity - 1);
+   self->data[self->head] = num;
+   self->size++;
+   return 0;
+}
+
+/********************************************************************************
+* int_deque_pop_back: Tar bort sista heltalet i angiven k.
+*
+*                     - self: Pekare till kn.
+*                     - num : Pekare till variabel fr heltalet (eller null).
+********************************************************************************/
+int int_deque_pop_back(struct int_deque* self,
+                       int* num)
+{
+   if (self->size == 0) return 1;
+   if (num) *num = *int_deque_at(self, self->size - 1);
+   self->size--;
+   shrink_if_sparse(self);
+   return 0;
+}
+
+/********************************************************************************
+* int_deque_pop_front: Tar bort frsta heltalet i angiven k.
+*
+*                      - self: Pekare till kn.
+*                      - num : Pekare till variabel fr heltalet (eller null).
+********************************************************************************/
+int int_deque_pop_front(struct int_deque* self,
+                        int* num)
+{
+   if (self->size == 0) return 1;
+   if (num) *num = self->data[self->head];
+   self->head = (self->head + 1) & (self->capacity - 1);
+   self->size--;
+   shrink_if_sparse(self);
+   return 0;
+}
+
+/********************************************************************************
+* int_deque_segments: Tilldelar angivna vyer kns tv segment i ordning.
+*
+*                     - self  : Pekare till kn.
+*                     - first : Pekare till vyn fr det frsta segmentet.
+*                     - second: Pekare till vyn fr det andra segmentet.
+********************************************************************************/
+void int_deque_segments(const struct int_deque* self,
+                        struct int_vector_view* first,
+                        struct int_vector_view* second)
+{
+   const size_t front = self->capacity - self->head < self->size ?
+                        self->capacity - self->head : self->size;
+   *first = int_vector_view_array(self->data + self->head, front);
+   *second = int_vector_view_array(self->data, self->size - front);
+   return;
+}
+
+/********************************************************************************
+* int_deque_copy_out: Kopierar angivet antal heltal frn angivet index i
+*                     angiven k till angivet flt.
+*
+*                     - self : Pekare till kn.
+*                     - first: Index fr det frsta heltalet.
+*                     - count: Antalet heltal som ska kopieras.
+*                     - dst  : Pekare till fltet som ska tilldelas heltalen.
+********************************************************************************/
+size_t int_deque_copy_out(const struct int_deque* self,
+                          const size_t first,
+                          size_t count,
+                          int* dst)
+{
+   size_t position, front;
+
+   if (first >= self->size) return 0;
+   if (count > self->size - first) count = self->size - first;
+
+   position = (self->head + first) & (self->capacity - 1);
+   front = self->capacity - position < count ? self->capacity - position : count;
+   memcpy(dst, self->data + position, sizeof(int) * front);
+   memcpy(dst + front, self->data, sizeof(int) * (count - front));
+   return count;
+}
+
+/********************************************************************************
+* format_deque: Formaterar angivet antal heltal frn angivet index i en k,
+*               se int_format_range_fn, direkt frn ringens segment.
+*
+*               - s      : Pekare till bufferten som ska tilldelas tecknen.
+*               - context: Pekare till kn.
+*               - first  : Index fr det frsta heltalet.
+*               - count  : Antalet heltal som ska formateras.
+********************************************************************************/
+static size_t format_deque(char* s,
+                           const void* context,
+                           const size_t first,
+                           const size_t count)
+{
+   const struct int_deque* self = (const struct int_deque*)context;
+   const size_t position = (self->head + first) & (self->capacity - 1);
+   const size_t front = self->capacity - position < count ? self->capacity - position : count;
+   const size_t length = int_format_lines(s, self->data + position, front);
+   return length + int_format_lines(s + length, self->data, count - front);
+}
+
+/********************************************************************************
+* int_deque_print: Skriver ut heltalen i angiven k via angiven utstrm.
+*
+*                  - self   : Pekare till kn som ska skrivas ut.
+*                  - ostream: Pekare till utstrmmen (default = stdout).
+********************************************************************************/
+void int_deque_print(const struct int_deque* self,
+                     FILE* ostream)
+{
+   int_format_print_range(self, self->size, INT_FORMAT_MAX_LINE, format_deque, ostream, 0, 0);
+   return;
+}
\ No newline at end of file
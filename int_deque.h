@@ -0,0 +1,229 @@
+/********************************************************************************
+* int_deque.h: Innehller strukten int_deque, en dubbelsidig k av heltal
+*              lagrad i en cirkulr buffert, samt associerade funktioner.
+*
+*              En int_vector kan endast vxa och krympa lngst bak, vilket
+*              innebr att en k dr heltal tas bort lngst fram mste
+*              flytta samtliga terstende heltal vid varje uttag. I en
+*              int_deque lagras heltalen i stllet i en ring, dr
+*              positionen fr det frsta heltalet flyttas vid insttning
+*              och uttag lngst fram. Drmed sker push och pop i bda
+*              ndar i amorterad konstant tid.
+*
+*              Kapaciteten r alltid en tvpotens, s att index i ringen
+*              berknas via en bitmask i stllet fr en division. Fltet
+*              allokeras via en utbytbar allokerare p samma stt som fr
+*              int_vector, se allocator.h, och vxer geometriskt via
+*              omallokering, varefter den del av ringen som slog runt
+*              flyttas till det nya utrymmet.
+*
+*              Heltalen ligger i hgst tv sammanhngande segment, som kan
+*              lsas direkt via int_deque_segments utan att kn frst
+*              linjriseras, exempelvis vid utskrift via int_deque_print.
+********************************************************************************/
+#ifndef INT_DEQUE_H_
+#define INT_DEQUE_H_
+
+/* Inkluderingsdirektiv: */
+#include "int_vector.h"
+#include "int_vector_view.h"
+
+/********************************************************************************
+* int_deque: Strukt fr en dubbelsidig k av heltal i en cirkulr buffert.
+********************************************************************************/
+struct int_deque
+{
+   int* data;                         /* Pekare till ringens flt. */
+   size_t head;                       /* Index fr kns frsta heltal. */
+   size_t size;                       /* Antalet heltal i kn. */
+   size_t capacity;                   /* Ringens kapacitet, 0 eller en tvpotens. */
+   const struct allocator* allocator; /* Allokerare fr fltet, null = malloc. */
+};
+
+/********************************************************************************
+* int_deque_init: Initierar ny tom k utan allokerat minne.
+*
+*                 - self: Pekare till kn som ska initieras.
+********************************************************************************/
+static inline void int_deque_init(struct int_deque* self)
+{
+   self->data = 0;
+   self->head = 0;
+   self->size = 0;
+   self->capacity = 0;
+   self->allocator = 0;
+   return;
+}
+
+/********************************************************************************
+* int_deque_init_with: Initierar ny tom k, vars flt allokeras via angiven
+*                      allokerare. Allokeraren bibehlls nr kn tms.
+*
+*                      - self     : Pekare till kn som ska initieras.
+*                      - allocator: Pekare till allokeraren (null = malloc).
+********************************************************************************/
+static inline void int_deque_init_with(struct int_deque* self,
+                                       const struct allocator* allocator)
+{
+   int_deque_init(self);
+   self->allocator = allocator;
+   return;
+}
+
+/********************************************************************************
+* int_deque_clear: Tmmer angiven k och frigr allokerat minne. Kns
+*                  allokerare bibehlls.
+*
+*                  - self: Pekare till kn som ska tmmas.
+********************************************************************************/
+static inline void int_deque_clear(struct int_deque* self)
+{
+   if (self->capacity > 0)
+   {
+      allocator_free(self->allocator, self->data, self->capacity * sizeof(int));
+      INT_VECTOR_STATS_FREE(self->capacity * sizeof(int));
+   }
+   int_deque_init_with(self, self->allocator);
+   return;
+}
+
+/********************************************************************************
+* int_deque_at: Returnerar adressen till heltalet p angivet index rknat frn
+*               kns brjan. Indexet mste understiga kns storlek.
+*
+*               - self : Pekare till kn.
+*               - index: Heltalets index.
+********************************************************************************/
+static inline int* int_deque_at(const struct int_deque* self,
+                                const size_t index)
+{
+   return self->data + ((self->head + index) & (self->capacity - 1));
+}
+
+/********************************************************************************
+* int_deque_front: Returnerar adressen till kns frsta heltal, eller null om
+*                  kn r tom.
+*
+*                  - self: Pekare till kn.
+********************************************************************************/
+static inline int* int_deque_front(const struct int_deque* self)
+{
+   return self->size > 0 ? int_deque_at(self, 0) : 0;
+}
+
+/********************************************************************************
+* int_deque_back: Returnerar adressen till kns sista heltal, eller null om
+*                 kn r tom.
+*
+*                 - self: Pekare till kn.
+********************************************************************************/
+static inline int* int_deque_back(const struct int_deque* self)
+{
+   return self->size > 0 ? int_deque_at(self, self->size - 1) : 0;
+}
+
+/********************************************************************************
+* int_deque_reserve: Skerstller att angiven k har kapacitet fr minst
+*                    angivet antal heltal, dr kapaciteten avrundas uppt
+*                    till en tvpotens. Vid lyckad minnesallokering
+*                    returneras 0, annars returneras felkod 1 och kn lmnas
+*                    intakt.
+*
+*                    - self    : Pekare till kn.
+*                    - capacity: Minsta kapacitet efter anropet.
+********************************************************************************/
+int int_deque_reserve(struct int_deque* self,
+                      const size_t capacity);
+
+/********************************************************************************
+* int_deque_push_back: Lgger till ett heltal lngst bak i angiven k. Nr kn
+*                      r full frdubblas kapaciteten. Vid lyckad
+*                      minnesallokering returneras 0, annars felkod 1.
+*
+*                      - self: Pekare till kn.
+*                      - num : Heltalet som ska lggas till.
+********************************************************************************/
+int int_deque_push_back(struct int_deque* self,
+                        const int num);
+
+/********************************************************************************
+* int_deque_push_front: Lgger till ett heltal lngst fram i angiven k. Nr
+*                       kn r full frdubblas kapaciteten. Vid lyckad
+*                       minnesallokering returneras 0, annars felkod 1.
+*
+*                       - self: Pekare till kn.
+*                       - num : Heltalet som ska lggas till.
+********************************************************************************/
+int int_deque_push_front(struct int_deque* self,
+                         const int num);
+
+/********************************************************************************
+* int_deque_pop_back: Tar bort sista heltalet i angiven k och tilldelar det
+*                     angiven variabel, om en sdan anges. Kapaciteten
+*                     halveras frst nr storleken understiger int_vectors
+*                     lgvattenmrke, se int_vector_set_shrink_threshold.
+*                     Vid lyckad borttagning returneras 0. Om kn r tom
+*                     returneras felkod 1.
+*
+*                     - self: Pekare till kn.
+*                     - num : Pekare till variabel fr heltalet (eller null).
+********************************************************************************/
+int int_deque_pop_back(struct int_deque* self,
+                       int* num);
+
+/********************************************************************************
+* int_deque_pop_front: Tar bort frsta heltalet i angiven k och tilldelar det
+*                      angiven variabel, om en sdan anges. Kapaciteten
+*                      minskas p samma stt som vid int_deque_pop_back. Vid
+*                      lyckad borttagning returneras 0. Om kn r tom
+*                      returneras felkod 1.
+*
+*                      - self: Pekare till kn.
+*                      - num : Pekare till variabel fr heltalet (eller null).
+********************************************************************************/
+int int_deque_pop_front(struct int_deque* self,
+                        int* num);
+
+/********************************************************************************
+* int_deque_segments: Tilldelar angivna vyer kns heltal i ordning, dr den
+*                     frsta vyn strcker sig frn kns brjan till ringens
+*                     slut och den andra vyn, som r tom om kn inte slr
+*                     runt, frn ringens brjan. Vyerna r giltiga tills kn
+*                     ndras.
+*
+*                     - self  : Pekare till kn.
+*                     - first : Pekare till vyn fr det frsta segmentet.
+*                     - second: Pekare till vyn fr det andra segmentet.
+********************************************************************************/
+void int_deque_segments(const struct int_deque* self,
+                        struct int_vector_view* first,
+                        struct int_vector_view* second);
+
+/********************************************************************************
+* int_deque_copy_out: Kopierar angivet antal heltal frn angivet index i
+*                     angiven k till angivet flt, med hgst tv anrop till
+*                     memcpy. Antalet begrnsas till kns storlek, och
+*                     antalet kopierade heltal returneras.
+*
+*                     - self : Pekare till kn.
+*                     - first: Index fr det frsta heltalet.
+*                     - count: Antalet heltal som ska kopieras.
+*                     - dst  : Pekare till fltet som ska tilldelas heltalen.
+********************************************************************************/
+size_t int_deque_copy_out(const struct int_deque* self,
+                          const size_t first,
+                          size_t count,
+                          int* dst);
+
+/********************************************************************************
+* int_deque_print: Skriver ut heltalen i angiven k i ordning via angiven
+*                  utstrm med samma format som int_vector_print, direkt frn
+*                  ringens tv segment.
+*
+*                  - self   : Pekare till kn som ska skrivas ut.
+*                  - ostream: Pekare till utstrmmen (default = stdout).
+********************************************************************************/
+void int_deque_print(const struct int_deque* self,
+                     FILE* ostream);
+
+#endif /* INT_DEQUE_H_ */
\ No newline at end of file
@@ -0,0 +1,470 @@
+/********************************************************************************
+* int_format.c: Innehller definitioner av funktioner fr snabb formatering
+*               av heltal till text.
+********************************************************************************/
+#include "int_format.h"
+
+#include <math.h>   /* Innehller signbit. */
+#include <string.h> /* Innehller memcpy. */
+
+/********************************************************************************
+* digit_pairs: Tabell med samtliga sifferpar 00 - 99, dr sifferparet fr ett
+*              tal n i intervallet [0, 99] brjar p index 2 * n. Via tabellen
+*              omvandlas tv siffror i taget, vilket halverar antalet
+*              divisioner jmfrt med en siffra i taget.
+********************************************************************************/
+static const char digit_pairs[201] =
+   "00010203040506070809"
+   "10111213141516171819"
+   "20212223242526272829"
+   "30313233343536373839"
+   "40414243444546474849"
+   "50515253545556575859"
+   "60616263646566676869"
+   "70717273747576777879"
+   "80818283848586878889"
+   "90919293949596979899";
+
+/********************************************************************************
+* count_digits: Returnerar antalet decimala siffror i angivet tal.
+*
+*               - num: Talet vars siffror ska rknas.
+********************************************************************************/
+static inline size_t count_digits(const unsigned num)
+{
+   if (num < 10) return 1;
+   if (num < 100) return 2;
+   if (num < 1000) return 3;
+   if (num < 10000) return 4;
+   if (num < 100000) return 5;
+   if (num < 1000000) return 6;
+   if (num < 10000000) return 7;
+   if (num < 100000000) return 8;
+   if (num < 1000000000) return 9;
+   return 10;
+}
+
+/********************************************************************************
+* count_digits64: Returnerar antalet decimala siffror i angivet 64-bitars tal.
+*
+*                 - num: Talet vars siffror ska rknas.
+********************************************************************************/
+static inline size_t count_digits64(unsigned long long num)
+{
+   size_t digits = 1;
+
+   while (num >= 10000)
+   {
+      num /= 10000;
+      digits += 4;
+   }
+
+   if (num >= 1000) return digits + 3;
+   if (num >= 100) return digits + 2;
+   if (num >= 10) return digits + 1;
+   return digits;
+}
+
+/********************************************************************************
+* int_format: Skriver angivet heltal i decimal form till angiven buffert utan
+*             avslutande nolltecken och returnerar antalet skrivna tecken.
+*             Bufferten mste rymma minst INT_FORMAT_MAX_LINE - 1 tecken.
+*
+*             - s  : Pekare till bufferten som ska tilldelas tecknen.
+*             - num: Heltalet som ska formateras.
+********************************************************************************/
+size_t int_format(char* s,
+                  const int num)
+{
+   unsigned magnitude = num < 0 ? 0u - (unsigned)num : (unsigned)num;
+   const size_t sign = num < 0 ? 1 : 0;
+   const size_t length = sign + count_digits(magnitude);
+   char* p = s + length;
+
+   *s = '-';
+
+   while (magnitude >= 100)
+   {
+      const unsigned pair = (magnitude % 100) * 2;
+      magnitude /= 100;
+      *--p = digit_pairs[pair + 1];
+      *--p = digit_pairs[pair];
+   }
+
+   if (magnitude >= 10)
+   {
+      *--p = digit_pairs[magnitude * 2 + 1];
+      *--p = digit_pairs[magnitude * 2];
+   }
+   else
+   {
+      *--p = (char)('0' + magnitude);
+   }
+
+   return length;
+}
+
+/********************************************************************************
+* int_format_i64: Skriver angivet 64-bitars heltal i decimal form till angiven
+*                 buffert utan avslutande nolltecken och returnerar antalet
+*                 skrivna tecken. Tal som ryms i en int formateras via
+*                 int_format, vriga tv siffror i taget via tabellen.
+*
+*                 - s  : Pekare till bufferten som ska tilldelas tecknen.
+*                 - num: Heltalet som ska formateras.
+********************************************************************************/
+size_t int_format_i64(char* s,
+                      const long long num)
+{
+   unsigned long long magnitude =
+      num < 0 ? 0ull - (unsigned long long)num : (unsigned long long)num;
+   const size_t sign = num < 0 ? 1 : 0;
+   size_t length;
+   char* p = 0;
+
+   if (num >= -2147483647 - 1 && num <= 2147483647) return int_format(s, (int)num);
+
+   length = sign + count_digits64(magnitude);
+   p = s + length;
+   *s = '-';
+
+   while (magnitude >= 100)
+   {
+      const unsigned pair = (unsigned)(magnitude % 100) * 2;
+      magnitude /= 100;
+      *--p = digit_pairs[pair + 1];
+      *--p = digit_pairs[pair];
+   }
+
+   if (magnitude >= 10)
+   {
+      *--p = digit_pairs[magnitude * 2 + 1];
+      *--p = digit_pairs[magnitude * 2];
+   }
+   else
+   {
+      *--p = (char)('0' + magnitude);
+   }
+
+   return length;
+}
+
+/********************************************************************************
+* int_format_lines: Skriver angivna heltal till angiven buffert, ett heltal
+*                   per rad, och returnerar antalet skrivna tecken. Bufferten
+*                   mste rymma minst INT_FORMAT_MAX_LINE tecken per heltal.
+*
+*                   - s   : Pekare till bufferten som ska tilldelas tecknen.
+*                   - data: Pekare till fltet med heltal som ska formateras.
+*                   - size: Antalet heltal som ska formateras.
+********************************************************************************/
+size_t int_format_lines(char* s,
+                        const int* data,
+                        const size_t size)
+{
+   char* p = s;
+
+   for (size_t i = 0; i < size; ++i)
+   {
+      p += int_format(p, data[i]);
+      *p++ = '\n';
+   }
+
+   return (size_t)(p - s);
+}
+
+/********************************************************************************
+* int_format_lines_length: Returnerar antalet tecken som int_format_lines
+*                          skriver fr angivna heltal, dvs. antalet siffror,
+*                          minustecken och radbrytningar.
+*
+*                          - data: Pekare till fltet med heltal.
+*                          - size: Antalet heltal.
+********************************************************************************/
+size_t int_format_lines_length(const int* data,
+                               const size_t size)
+{
+   size_t length = size;
+
+   for (size_t i = 0; i < size; ++i)
+   {
+      const int num = data[i];
+      length += num < 0 ? count_digits(0u - (unsigned)num) + 1 : count_digits((unsigned)num);
+   }
+
+   return length;
+}
+
+/********************************************************************************
+* int_format_lines_i8: Skriver angivna 8-bitars heltal till angiven buffert,
+*                      ett heltal per rad, och returnerar antalet skrivna
+*                      tecken.
+*
+*                      - s   : Pekare till bufferten som ska tilldelas tecknen.
+*                      - data: Pekare till fltet med heltal som ska formateras.
+*                      - size: Antalet heltal som ska formateras.
+********************************************************************************/
+size_t int_format_lines_i8(char* s,
+                           const int8_t* data,
+                           const size_t size)
+{
+   char* p = s;
+
+   for (size_t i = 0; i < size; ++i)
+   {
+      p += int_format(p, data[i]);
+      *p++ = '\n';
+   }
+
+   return (size_t)(p - s);
+}
+
+/********************************************************************************
+* int_format_lines_i16: Skriver angivna 16-bitars heltal till angiven buffert,
+*                       ett heltal per rad, och returnerar antalet skrivna
+*                       tecken.
+*
+*                       - s   : Pekare till bufferten som ska tilldelas tecknen.
+*                       - data: Pekare till fltet med heltal som ska formateras.
+*                       - size: Antalet heltal som ska formateras.
+********************************************************************************/
+size_t int_format_lines_i16(char* s,
+                            const int16_t* data,
+                            const size_t size)
+{
+   char* p = s;
+
+   for (size_t i = 0; i < size; ++i)
+   {
+      p += int_format(p, data[i]);
+      *p++ = '\n';
+   }
+
+   return (size_t)(p - s);
+}
+
+/********************************************************************************
+* int_format_lines_i64: Skriver angivna 64-bitars heltal till angiven buffert,
+*                       ett heltal per rad, och returnerar antalet skrivna
+*                       tecken.
+*
+*                       - s   : Pekare till bufferten som ska tilldelas tecknen.
+*                       - data: Pekare till fltet med heltal som ska formateras.
+*                       - size: Antalet heltal som ska formateras.
+********************************************************************************/
+size_t int_format_lines_i64(char* s,
+                            const int64_t* data,
+                            const size_t size)
+{
+   char* p = s;
+
+   for (size_t i = 0; i < size; ++i)
+   {
+      p += int_format_i64(p, (long long)data[i]);
+      *p++ = '\n';
+   }
+
+   return (size_t)(p - s);
+}
+
+/********************************************************************************
+* int_format_lines_f32: Skriver angivna flyttal till angiven buffert, ett
+*                       flyttal per rad med formatet "%g", och returnerar
+*                       antalet skrivna tecken. Heltaliga flyttal med
+*                       hgst sex siffror, som "%g" skriver ut utan
+*                       decimaler eller exponent, formateras via int_format
+*                       i stllet fr snprintf. Negativ nolla undantas,
+*                       eftersom "%g" skriver ut denna som "-0".
+*
+*                       - s   : Pekare till bufferten som ska tilldelas tecknen.
+*                       - data: Pekare till fltet med flyttal som ska formateras.
+*                       - size: Antalet flyttal som ska formateras.
+********************************************************************************/
+size_t int_format_lines_f32(char* s,
+                            const float* data,
+                            const size_t size)
+{
+   char* p = s;
+
+   for (size_t i = 0; i < size; ++i)
+   {
+      const float value = data[i];
+
+      if (value > -1000000.0f && value < 1000000.0f && value == (float)(int)value &&
+          (value != 0.0f || !signbit(value)))
+      {
+         p += int_format(p, (int)value);
+         *p++ = '\n';
+      }
+      else
+      {
+         p += snprintf(p, INT_FORMAT_F32_MAX_LINE, "%g\n", (double)value);
+      }
+   }
+
+   return (size_t)(p - s);
+}
+
+/********************************************************************************
+* int_format_print_range: Skriver ut angivet antal element via angiven
+*                         utstrm, omgivet av avgrnsningsrader. Elementen
+*                         formateras till angiven buffert i fljd via angiven
+*                         funktion, och bufferten skrivs ut via ett anrop till
+*                         fwrite varje gng den blir full. Om ingen buffert
+*                         anges, eller om den r mindre n
+*                         INT_FORMAT_MIN_BUFFER, anvnds en intern buffert.
+*                         Vid lyckad utskrift returneras 0, annars felkod 1.
+*
+*                         - context    : Pekare till elementens klla.
+*                         - size       : Antalet element som ska skrivas ut.
+*                         - max_line   : Maximalt antal tecken per element.
+*                         - format     : Funktionen som formaterar elementen.
+*                         - ostream    : Pekare till utstrmmen (default = stdout).
+*                         - buffer     : Pekare till bufferten (eller null).
+*                         - buffer_size: Buffertens storlek i byte.
+********************************************************************************/
+int int_format_print_range(const void* context,
+                           const size_t size,
+                           const size_t max_line,
+                           int_format_range_fn format,
+                           FILE* ostream,
+                           char* buffer,
+                           const size_t buffer_size)
+{
+   static const char header[] = INT_FORMAT_SEPARATOR "\n";
+   static const char footer[] = INT_FORMAT_SEPARATOR "\n\n";
+   char internal[INT_FORMAT_BUFFER_SIZE];
+   size_t capacity = buffer_size;
+   size_t length = sizeof(header) - 1;
+   size_t i = 0;
+
+   if (size == 0) return 0;
+   if (!ostream) ostream = stdout;
+
+   if (!buffer || buffer_size < INT_FORMAT_MIN_BUFFER)
+   {
+      buffer = internal;
+      capacity = sizeof(internal);
+   }
+
+   memcpy(buffer, header, sizeof(header) - 1);
+
+   while (i < size)
+   {
+      const size_t room = (capacity - length) / max_line;
+      const size_t count = room < size - i ? room : size - i;
+
+      length += format(buffer + length, context, i, count);
+      i += count;
+
+      if (i < size || capacity - length < sizeof(footer) - 1)
+      {
+         if (fwrite(buffer, 1, length, ostream) != length) return 1;
+         length = 0;
+      }
+   }
+
+   memcpy(buffer + length, footer, sizeof(footer) - 1);
+   length += sizeof(footer) - 1;
+   return fwrite(buffer, 1, length, ostream) != length;
+}
+
+/********************************************************************************
+* array_source: Strukt fr ett flt som skrivs ut via int_format_print_with.
+********************************************************************************/
+struct array_source
+{
+   const unsigned char* data; /* Pekare till fltets frsta element. */
+   size_t element_size;       /* Storleken p ett element i byte. */
+   int_format_lines_fn lines; /* Funktionen som formaterar elementen. */
+};
+
+/********************************************************************************
+* format_array: Formaterar angivet antal element frn angiven position i ett
+*               flt via fltets funktion, se int_format_range_fn.
+*
+*               - s      : Pekare till bufferten som ska tilldelas tecknen.
+*               - context: Pekare till fltet, dvs. en strukt array_source.
+*               - first  : Index fr det frsta elementet.
+*               - count  : Antalet element som ska formateras.
+********************************************************************************/
+static size_t format_array(char* s,
+                           const void* context,
+                           const size_t first,
+                           const size_t count)
+{
+   const struct array_source* source = (const struct array_source*)context;
+   return source->lines(s, source->data + first * source->element_size, count);
+}
+
+/********************************************************************************
+* int_format_print_with: Skriver ut angivna element via angiven utstrm,
+*                        omgivet av avgrnsningsrader, via
+*                        int_format_print_range. Vid lyckad utskrift
+*                        returneras 0, annars felkod 1.
+*
+*                        - data        : Pekare till fltet som ska skrivas ut.
+*                        - size        : Antalet element som ska skrivas ut.
+*                        - element_size: Storleken p ett element i byte.
+*                        - max_line    : Maximalt antal tecken per element.
+*                        - lines       : Funktionen som formaterar elementen.
+*                        - ostream     : Pekare till utstrmmen (default = stdout).
+*                        - buffer      : Pekare till bufferten (eller null).
+*                        - buffer_size : Buffertens storlek i byte.
+********************************************************************************/
+int int_format_print_with(const void* data,
+                          const size_t size,
+                          const size_t element_size,
+                          const size_t max_line,
+                          int_format_lines_fn lines,
+                          FILE* ostream,
+                          char* buffer,
+                          const size_t buffer_size)
+{
+   struct array_source source;
+   source.data = (const unsigned char*)data;
+   source.element_size = element_size;
+   source.lines = lines;
+   return int_format_print_range(&source, size, max_line, format_array,
+                                 ostream, buffer, buffer_size);
+}
+
+/********************************************************************************
+* format_lines_int: Anpassar int_format_lines till int_format_lines_fn.
+*
+*                   - s   : Pekare till bufferten som ska tilldelas tecknen.
+*                   - data: Pekare till fltet med heltal som ska formateras.
+*                   - size: Antalet heltal som ska formateras.
+********************************************************************************/
+static size_t format_lines_int(char* s,
+                               const void* data,
+                               const size_t size)
+{
+   return int_format_lines(s, (const int*)data, size);
+}
+
+/********************************************************************************
+* int_format_print: Skriver ut angivna heltal via angiven utstrm med samma
+*                   format som fprintf(ostream, "%d\n", ...) per heltal,
+*                   omgivet av avgrnsningsrader. Ingenting skrivs ut om
+*                   fltet r tomt. Heltalen formateras till angiven buffert,
+*                   som skrivs ut via ett anrop till fwrite varje gng den
+*                   blir full. Om ingen buffert anges, eller om den r mindre
+*                   n INT_FORMAT_MIN_BUFFER, anvnds en intern buffert.
+*                   Vid lyckad utskrift returneras 0, annars felkod 1.
+*
+*                   - data       : Pekare till fltet som ska skrivas ut.
+*                   - size       : Antalet heltal som ska skrivas ut.
+*                   - ostream    : Pekare till utstrmmen (default = stdout).
+*                   - buffer     : Pekare till bufferten (eller null).
+*                   - buffer_size: Buffertens storlek i byte.
+********************************************************************************/
+int int_format_print(const int* data,
+                     const size_t size,
+                     FILE* ostream,
+                     char* buffer,
+                     const size_t buffer_size)
+{
+   return int_format_print_with(data, size, sizeof(int), INT_FORMAT_MAX_LINE,
+                                format_lines_int, ostream, buffer, buffer_size);
+}
\ No newline at end of file
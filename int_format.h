@@ -0,0 +1,221 @@
+/********************************************************************************
+* int_format.h: Innehller funktionalitet fr snabb formatering av heltal till
+*               text. Heltalen omvandlas till decimal form via en tabell med
+*               sifferpar och samlas i en stor buffert, som skrivs till
+*               utstrmmen med ett enda anrop till fwrite per buffert i
+*               stllet fr ett anrop till fprintf per heltal.
+*
+*               Frutom int finns formatering av 8-, 16- och 64-bitars heltal
+*               samt flyttal av typen float, s att varje vektortyp i
+*               vector_template.h fr en formaterare fr sin elementtyp.
+********************************************************************************/
+#ifndef INT_FORMAT_H_
+#define INT_FORMAT_H_
+
+/* Inkluderingsdirektiv: */
+#include <stdio.h>  /* Innehller fwrite, FILE* med mera. */
+#include <stddef.h> /* Innehller size_t. */
+#include <stdint.h> /* Innehller int8_t, int16_t och int64_t. */
+
+/********************************************************************************
+* INT_FORMAT_MAX_LINE: Maximalt antal tecken som ett formaterat heltal upptar
+*                      inklusive radbrytning, exempelvis "-2147483648\n".
+********************************************************************************/
+#define INT_FORMAT_MAX_LINE 12
+
+/********************************************************************************
+* Maximalt antal tecken per formaterat element inklusive radbrytning fr
+* vriga elementtyper, exempelvis "-128\n" fr 8-bitars heltal och
+* "-9223372036854775808\n" fr 64-bitars heltal. Flyttal formateras med
+* samma format som "%g", exempelvis "-1.17549e-38\n".
+********************************************************************************/
+#define INT_FORMAT_I8_MAX_LINE  5
+#define INT_FORMAT_I16_MAX_LINE 7
+#define INT_FORMAT_I64_MAX_LINE 21
+#define INT_FORMAT_F32_MAX_LINE 16
+
+/********************************************************************************
+* INT_FORMAT_SEPARATOR: Avgrnsningsrad som skrivs fre och efter heltalen vid
+*                       utskrift, exklusive radbrytning.
+********************************************************************************/
+#define INT_FORMAT_SEPARATOR \
+   "--------------------------------------------------------------------------------"
+
+/********************************************************************************
+* INT_FORMAT_MIN_BUFFER: Minsta storlek i byte p en buffert som anges vid
+*                        utskrift, s att en avgrnsningsrad ryms i sin helhet.
+********************************************************************************/
+#define INT_FORMAT_MIN_BUFFER 128
+
+/********************************************************************************
+* INT_FORMAT_BUFFER_SIZE: Storlek i byte p den interna buffert som anvnds
+*                         vid utskrift om ingen buffert anges.
+********************************************************************************/
+#ifndef INT_FORMAT_BUFFER_SIZE
+#define INT_FORMAT_BUFFER_SIZE 65536
+#endif
+
+/********************************************************************************
+* int_format_lines_fn: Pekare till en funktion som skriver angivet antal
+*                      element frn angivet flt till angiven buffert, ett
+*                      element per rad, och returnerar antalet skrivna tecken.
+********************************************************************************/
+typedef size_t (*int_format_lines_fn)(char* s,
+                                      const void* data,
+                                      const size_t size);
+
+/********************************************************************************
+* int_format_range_fn: Pekare till en funktion som skriver angivet antal
+*                      element frn angivet index i angiven klla till angiven
+*                      buffert, ett element per rad, och returnerar antalet
+*                      skrivna tecken. Kllan kan exempelvis vara ett flt
+*                      eller en berknad talfljd som inte finns i minnet.
+********************************************************************************/
+typedef size_t (*int_format_range_fn)(char* s,
+                                      const void* context,
+                                      const size_t first,
+                                      const size_t count);
+
+/********************************************************************************
+* int_format: Skriver angivet heltal i decimal form till angiven buffert utan
+*             avslutande nolltecken och returnerar antalet skrivna tecken.
+*             Bufferten mste rymma minst INT_FORMAT_MAX_LINE - 1 tecken.
+*
+*             - s  : Pekare till bufferten som ska tilldelas tecknen.
+*             - num: Heltalet som ska formateras.
+********************************************************************************/
+size_t int_format(char* s,
+                  const int num);
+
+/********************************************************************************
+* int_format_lines: Skriver angivna heltal till angiven buffert, ett heltal
+*                   per rad, och returnerar antalet skrivna tecken. Bufferten
+*                   mste rymma minst INT_FORMAT_MAX_LINE tecken per heltal.
+*
+*                   - s   : Pekare till bufferten som ska tilldelas tecknen.
+*                   - data: Pekare till fltet med heltal som ska formateras.
+*                   - size: Antalet heltal som ska formateras.
+********************************************************************************/
+size_t int_format_lines(char* s,
+                        const int* data,
+                        const size_t size);
+
+/********************************************************************************
+* int_format_lines_length: Returnerar antalet tecken som int_format_lines
+*                          skriver fr angivna heltal, utan att heltalen
+*                          formateras. Anvnds fr att i frvg berkna var
+*                          i en fil varje del av en utskrift hamnar.
+*
+*                          - data: Pekare till fltet med heltal.
+*                          - size: Antalet heltal.
+********************************************************************************/
+size_t int_format_lines_length(const int* data,
+                               const size_t size);
+
+/********************************************************************************
+* int_format_i64: Skriver angivet 64-bitars heltal i decimal form till angiven
+*                 buffert utan avslutande nolltecken och returnerar antalet
+*                 skrivna tecken. Bufferten mste rymma minst
+*                 INT_FORMAT_I64_MAX_LINE - 1 tecken.
+*
+*                 - s  : Pekare till bufferten som ska tilldelas tecknen.
+*                 - num: Heltalet som ska formateras.
+********************************************************************************/
+size_t int_format_i64(char* s,
+                      const long long num);
+
+/********************************************************************************
+* Funktioner som skriver angivna element till angiven buffert, ett element per
+* rad, och returnerar antalet skrivna tecken. Bufferten mste rymma minst
+* motsvarande INT_FORMAT_*_MAX_LINE tecken per element. 8- och 16-bitars
+* heltal formateras via int_format, eftersom de ryms i en int, och flyttal
+* formateras via snprintf med formatet "%g".
+*
+* - s   : Pekare till bufferten som ska tilldelas tecknen.
+* - data: Pekare till fltet med element som ska formateras.
+* - size: Antalet element som ska formateras.
+********************************************************************************/
+size_t int_format_lines_i8(char* s, const int8_t* data, const size_t size);
+size_t int_format_lines_i16(char* s, const int16_t* data, const size_t size);
+size_t int_format_lines_i64(char* s, const int64_t* data, const size_t size);
+size_t int_format_lines_f32(char* s, const float* data, const size_t size);
+
+/********************************************************************************
+* int_format_print_range: Skriver ut angivet antal element via angiven
+*                         utstrm, omgivet av avgrnsningsrader, dr
+*                         elementen hmtas i fljd frn en godtycklig klla
+*                         via angiven funktion. Drmed kan element som inte
+*                         lagras i ett sammanhngande flt, exempelvis en
+*                         berknad talfljd eller komprimerade block, skrivas
+*                         ut utan att frst packas upp i sin helhet.
+*                         Ingenting skrivs ut om antalet r 0. Vid lyckad
+*                         utskrift returneras 0, annars felkod 1.
+*
+*                         - context    : Pekare till elementens klla.
+*                         - size       : Antalet element som ska skrivas ut.
+*                         - max_line   : Maximalt antal tecken per element
+*                                        inklusive radbrytning.
+*                         - format     : Funktionen som formaterar elementen.
+*                         - ostream    : Pekare till utstrmmen (default = stdout).
+*                         - buffer     : Pekare till bufferten (eller null).
+*                         - buffer_size: Buffertens storlek i byte.
+********************************************************************************/
+int int_format_print_range(const void* context,
+                           const size_t size,
+                           const size_t max_line,
+                           int_format_range_fn format,
+                           FILE* ostream,
+                           char* buffer,
+                           const size_t buffer_size);
+
+/********************************************************************************
+* int_format_print_with: Skriver ut angivna element via angiven utstrm,
+*                        omgivet av avgrnsningsrader, p samma stt som
+*                        int_format_print men fr godtycklig elementtyp.
+*                        Elementen formateras till bufferten via angiven
+*                        funktion, som anropas en gng per buffert.
+*                        Ingenting skrivs ut om fltet r tomt. Vid lyckad
+*                        utskrift returneras 0, annars felkod 1.
+*
+*                        - data        : Pekare till fltet som ska skrivas ut.
+*                        - size        : Antalet element som ska skrivas ut.
+*                        - element_size: Storleken p ett element i byte.
+*                        - max_line    : Maximalt antal tecken per element
+*                                        inklusive radbrytning.
+*                        - lines       : Funktionen som formaterar elementen.
+*                        - ostream     : Pekare till utstrmmen (default = stdout).
+*                        - buffer      : Pekare till bufferten (eller null).
+*                        - buffer_size : Buffertens storlek i byte.
+********************************************************************************/
+int int_format_print_with(const void* data,
+                          const size_t size,
+                          const size_t element_size,
+                          const size_t max_line,
+                          int_format_lines_fn lines,
+                          FILE* ostream,
+                          char* buffer,
+                          const size_t buffer_size);
+
+/********************************************************************************
+* int_format_print: Skriver ut angivna heltal via angiven utstrm med samma
+*                   format som fprintf(ostream, "%d\n", ...) per heltal,
+*                   omgivet av avgrnsningsrader. Ingenting skrivs ut om
+*                   fltet r tomt. Heltalen formateras till angiven buffert,
+*                   som skrivs ut via ett anrop till fwrite varje gng den
+*                   blir full. Om ingen buffert anges, eller om den r mindre
+*                   n INT_FORMAT_MIN_BUFFER, anvnds en intern buffert.
+*                   Vid lyckad utskrift returneras 0, annars felkod 1.
+*
+*                   - data       : Pekare till fltet som ska skrivas ut.
+*                   - size       : Antalet heltal som ska skrivas ut.
+*                   - ostream    : Pekare till utstrmmen (default = stdout).
+*                   - buffer     : Pekare till bufferten (eller null).
+*                   - buffer_size: Buffertens storlek i byte.
+********************************************************************************/
+int int_format_print(const int* data,
+                     const size_t size,
+                     FILE* ostream,
+                     char* buffer,
+                     const size_t buffer_size);
+
+#endif /* INT_FORMAT_H_ */
\ No newline at end of file
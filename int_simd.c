@@ -0,0 +1,1041 @@
+/********************************************************************************
+* int_simd.c: Innehller definitioner av vektoriserade krnor fr operationer
+*             p flt med heltal samt val av version i krtid.
+*
+*             Versionerna fr SSE2, AVX2 och AVX-512 kompileras via
+*             funktionsattributet target, s att hela filen kan kompileras
+*             utan srskilda kompilatorflaggor. En version anropas endast
+*             om processorn har std fr motsvarande instruktionsuppsttning.
+********************************************************************************/
+#define _POSIX_C_SOURCE 200809L /* Krvs fr pthread_once. */
+#include "int_simd.h"
+
+#include <pthread.h> /* Innehller pthread_once. */
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define INT_SIMD_X86 1
+#include <immintrin.h> /* Innehller intrinsics fr SSE2, AVX2 och AVX-512. */
+#else
+#define INT_SIMD_X86 0
+#endif
+
+/********************************************************************************
+* assign_kernel: Funktionspekartyp fr krnor som tilldelar en talfljd.
+********************************************************************************/
+typedef void (*assign_kernel)(int* data,
+                              const size_t size,
+                              const int start,
+                              const int step);
+
+/********************************************************************************
+* Funktionspekartyper fr krnor som summerar, sker minsta och strsta vrde,
+* rknar frekomster av ett vrde respektive vrden i ett intervall samt
+* sker efter ett vrde.
+********************************************************************************/
+typedef long long (*sum_kernel)(const int* data,
+                                const size_t size);
+typedef void (*minmax_kernel)(const int* data,
+                              const size_t size,
+                              int* min,
+                              int* max);
+typedef size_t (*count_eq_kernel)(const int* data,
+                                  const size_t size,
+                                  const int value);
+typedef size_t (*count_range_kernel)(const int* data,
+                                     const size_t size,
+                                     const int low,
+                                     const int high);
+typedef size_t (*find_kernel)(const int* data,
+                              const size_t size,
+                              const int value);
+
+/********************************************************************************
+* COUNT_BLOCK: Hgsta antalet heltal som rknas i registren innan rknarna
+*              summeras, s att rknarna per element i registren (32 bitar)
+*              aldrig slr ver.
+********************************************************************************/
+#define COUNT_BLOCK ((size_t)1 << 30)
+
+/* Statiska variabler: */
+static assign_kernel assign_impl;                    /* Vald tilldelningskrna. */
+static sum_kernel sum_impl;                          /* Vald summeringskrna. */
+static minmax_kernel minmax_impl;                    /* Vald min/max-krna. */
+static count_eq_kernel count_eq_impl;                /* Vald rknekrna. */
+static count_range_kernel count_range_impl;          /* Vald intervallkrna. */
+static find_kernel find_impl;                        /* Vald skkrna. */
+static int current_isa = INT_SIMD_SCALAR;            /* Vald instruktionsuppsttning. */
+static pthread_once_t resolved = PTHREAD_ONCE_INIT;  /* Styr valet vid frsta anropet. */
+
+/********************************************************************************
+* progression: Returnerar talet p angivet index i en aritmetisk talfljd med
+*              angivet start- och stegvrde. Berkningen sker med osignerade
+*              tal s att verslag ger tvkomplementsomslag.
+*
+*              - start: Startvrde fr talfljden.
+*              - step : Stegvrde fr talfljden.
+*              - index: Talets index i talfljden.
+********************************************************************************/
+static inline int progression(const int start,
+                              const int step,
+                              const size_t index)
+{
+   return (int)((unsigned)start + (unsigned)index * (unsigned)step);
+}
+
+/********************************************************************************
+* assign_scalar: Skalr version av int_simd_assign, ett heltal per iteration.
+*
+*                - data : Pekare till fltet som ska tilldelas.
+*                - size : Antalet heltal som ska tilldelas.
+*                - start: Startvrde fr talfljden.
+*                - step : Stegvrde fr talfljden.
+********************************************************************************/
+static void assign_scalar(int* data,
+                          const size_t size,
+                          const int start,
+                          const int step)
+{
+   unsigned num = (unsigned)start;
+
+   for (size_t i = 0; i < size; ++i)
+   {
+      data[i] = (int)num;
+      num += (unsigned)step;
+   }
+
+   return;
+}
+
+/********************************************************************************
+* sum_scalar: Skalr version av int_simd_sum, ett heltal per iteration.
+*
+*             - data: Pekare till fltet som ska summeras.
+*             - size: Antalet heltal i fltet.
+********************************************************************************/
+static long long sum_scalar(const int* data,
+                            const size_t size)
+{
+   long long sum = 0;
+   for (size_t i = 0; i < size; ++i) sum += data[i];
+   return sum;
+}
+
+/********************************************************************************
+* minmax_scalar: Skalr version av int_simd_minmax fr flt som inte r tomma.
+*                Minsta och strsta vrde jmfrs med befintliga vrden i
+*                min och max, s att delresultat frn registren kan sls
+*                samman med terstende heltal.
+*
+*                - data: Pekare till fltet som ska genomskas.
+*                - size: Antalet heltal i fltet.
+*                - min : Pekare till minsta vrdet hittills.
+*                - max : Pekare till strsta vrdet hittills.
+********************************************************************************/
+static void minmax_scalar(const int* data,
+                          const size_t size,
+                          int* min,
+                          int* max)
+{
+   int low = *min, high = *max;
+
+   for (size_t i = 0; i < size; ++i)
+   {
+      if (data[i] < low) low = data[i];
+      if (data[i] > high) high = data[i];
+   }
+
+   *min = low;
+   *max = high;
+   return;
+}
+
+/********************************************************************************
+* minmax_scalar_kernel: Skalr version av int_simd_minmax, dr minsta och
+*                       strsta vrde initieras till frsta heltalet.
+*
+*                       - data: Pekare till fltet som ska genomskas.
+*                       - size: Antalet heltal i fltet (minst 1).
+*                       - min : Pekare till variabel fr minsta vrdet.
+*                       - max : Pekare till variabel fr strsta vrdet.
+********************************************************************************/
+static void minmax_scalar_kernel(const int* data,
+                                 const size_t size,
+                                 int* min,
+                                 int* max)
+{
+   *min = *max = data[0];
+   minmax_scalar(data + 1, size - 1, min, max);
+   return;
+}
+
+/********************************************************************************
+* count_eq_scalar: Skalr version av int_simd_count_eq, ett heltal per
+*                  iteration.
+*
+*                  - data : Pekare till fltet som ska genomskas.
+*                  - size : Antalet heltal i fltet.
+*                  - value: Vrdet som ska rknas.
+********************************************************************************/
+static size_t count_eq_scalar(const int* data,
+                              const size_t size,
+                              const int value)
+{
+   size_t count = 0;
+   for (size_t i = 0; i < size; ++i) count += data[i] == value;
+   return count;
+}
+
+/********************************************************************************
+* count_range_scalar: Skalr version av int_simd_count_range fr intervall
+*                     dr low <= high. Intervallkontrollen sker med en
+*                     osignerad jmfrelse, dr tal under low slr om till
+*                     stora osignerade tal.
+*
+*                     - data: Pekare till fltet som ska genomskas.
+*                     - size: Antalet heltal i fltet.
+*                     - low : Intervallets undre grns (inklusive).
+*                     - high: Intervallets vre grns (inklusive).
+********************************************************************************/
+static size_t count_range_scalar(const int* data,
+                                 const size_t size,
+                                 const int low,
+                                 const int high)
+{
+   const unsigned range = (unsigned)high - (unsigned)low;
+   size_t count = 0;
+   for (size_t i = 0; i < size; ++i) count += (unsigned)data[i] - (unsigned)low <= range;
+   return count;
+}
+
+/********************************************************************************
+* find_scalar: Skalr version av int_simd_find, ett heltal per iteration.
+*
+*              - data : Pekare till fltet som ska genomskas.
+*              - size : Antalet heltal i fltet.
+*              - value: Vrdet som ska skas efter.
+********************************************************************************/
+static size_t find_scalar(const int* data,
+                          const size_t size,
+                          const int value)
+{
+   size_t i = 0;
+   while (i < size && data[i] != value) ++i;
+   return i;
+}
+
+#if INT_SIMD_X86
+
+/********************************************************************************
+* assign_sse2: Version av int_simd_assign fr SSE2, fyra heltal per iteration.
+*              Ett register med talfljdens fyra frsta tal lagras och kas
+*              sedan med fyra steg per iteration. terstende tal tilldelas
+*              via den skalra versionen.
+*
+*              - data : Pekare till fltet som ska tilldelas.
+*              - size : Antalet heltal som ska tilldelas.
+*              - start: Startvrde fr talfljden.
+*              - step : Stegvrde fr talfljden.
+********************************************************************************/
+__attribute__((target("sse2")))
+static void assign_sse2(int* data,
+                        const size_t size,
+                        const int start,
+                        const int step)
+{
+   const __m128i increment = _mm_set1_epi32(progression(0, step, 4));
+   __m128i value = _mm_setr_epi32(progression(start, step, 0), progression(start, step, 1),
+                                  progression(start, step, 2), progression(start, step, 3));
+   size_t i = 0;
+
+   for (; i + 4 <= size; i += 4)
+   {
+      _mm_storeu_si128((__m128i*)(data + i), value);
+      value = _mm_add_epi32(value, increment);
+   }
+
+   assign_scalar(data + i, size - i, progression(start, step, i), step);
+   return;
+}
+
+/********************************************************************************
+* assign_avx2: Version av int_simd_assign fr AVX2, tta heltal per iteration.
+*
+*              - data : Pekare till fltet som ska tilldelas.
+*              - size : Antalet heltal som ska tilldelas.
+*              - start: Startvrde fr talfljden.
+*              - step : Stegvrde fr talfljden.
+********************************************************************************/
+__attribute__((target("avx2")))
+static void assign_avx2(int* data,
+                        const size_t size,
+                        const int start,
+                        const int step)
+{
+   const __m256i increment = _mm256_set1_epi32(progression(0, step, 8));
+   __m256i value = _mm256_add_epi32(_mm256_set1_epi32(start),
+                                    _mm256_mullo_epi32(_mm256_set1_epi32(step),
+                                                       _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7)));
+   size_t i = 0;
+
+   for (; i + 8 <= size; i += 8)
+   {
+      _mm256_storeu_si256((__m256i*)(data + i), value);
+      value = _mm256_add_epi32(value, increment);
+   }
+
+   assign_scalar(data + i, size - i, progression(start, step, i), step);
+   return;
+}
+
+/********************************************************************************
+* assign_avx512: Version av int_simd_assign fr AVX-512, sexton heltal per
+*                iteration.
+*
+*                - data : Pekare till fltet som ska tilldelas.
+*                - size : Antalet heltal som ska tilldelas.
+*                - start: Startvrde fr talfljden.
+*                - step : Stegvrde fr talfljden.
+********************************************************************************/
+__attribute__((target("avx512f")))
+static void assign_avx512(int* data,
+                          const size_t size,
+                          const int start,
+                          const int step)
+{
+   const __m512i increment = _mm512_set1_epi32(progression(0, step, 16));
+   __m512i value = _mm512_add_epi32(_mm512_set1_epi32(start),
+                                    _mm512_mullo_epi32(_mm512_set1_epi32(step),
+                                                       _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8,
+                                                                         9, 10, 11, 12, 13, 14, 15)));
+   size_t i = 0;
+
+   for (; i + 16 <= size; i += 16)
+   {
+      _mm512_storeu_si512((void*)(data + i), value);
+      value = _mm512_add_epi32(value, increment);
+   }
+
+   assign_scalar(data + i, size - i, progression(start, step, i), step);
+   return;
+}
+
+/********************************************************************************
+* sum_sse2: Version av int_simd_sum fr SSE2, fyra heltal per iteration.
+*           Eftersom SSE2 saknar instruktion fr teckenutvidgning bildas
+*           64-bitars tal genom att varje heltal packas ihop med sin
+*           teckenmask.
+*
+*           - data: Pekare till fltet som ska summeras.
+*           - size: Antalet heltal i fltet.
+********************************************************************************/
+__attribute__((target("sse2")))
+static long long sum_sse2(const int* data,
+                          const size_t size)
+{
+   const __m128i zero = _mm_setzero_si128();
+   __m128i sum0 = zero, sum1 = zero;
+   long long lanes[2];
+   size_t i = 0;
+
+   for (; i + 4 <= size; i += 4)
+   {
+      const __m128i value = _mm_loadu_si128((const __m128i*)(data + i));
+      const __m128i sign = _mm_cmpgt_epi32(zero, value);
+      sum0 = _mm_add_epi64(sum0, _mm_unpacklo_epi32(value, sign));
+      sum1 = _mm_add_epi64(sum1, _mm_unpackhi_epi32(value, sign));
+   }
+
+   _mm_storeu_si128((__m128i*)lanes, _mm_add_epi64(sum0, sum1));
+   return lanes[0] + lanes[1] + sum_scalar(data + i, size - i);
+}
+
+/********************************************************************************
+* sum_avx2: Version av int_simd_sum fr AVX2, tta heltal per iteration.
+*
+*           - data: Pekare till fltet som ska summeras.
+*           - size: Antalet heltal i fltet.
+********************************************************************************/
+__attribute__((target("avx2")))
+static long long sum_avx2(const int* data,
+                          const size_t size)
+{
+   __m256i sum0 = _mm256_setzero_si256(), sum1 = _mm256_setzero_si256();
+   long long lanes[4];
+   size_t i = 0;
+
+   for (; i + 8 <= size; i += 8)
+   {
+      sum0 = _mm256_add_epi64(sum0, _mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i*)(data + i))));
+      sum1 = _mm256_add_epi64(sum1, _mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i*)(data + i + 4))));
+   }
+
+   _mm256_storeu_si256((__m256i*)lanes, _mm256_add_epi64(sum0, sum1));
+   return lanes[0] + lanes[1] + lanes[2] + lanes[3] + sum_scalar(data + i, size - i);
+}
+
+/********************************************************************************
+* sum_avx512: Version av int_simd_sum fr AVX-512, sexton heltal per iteration.
+*
+*             - data: Pekare till fltet som ska summeras.
+*             - size: Antalet heltal i fltet.
+********************************************************************************/
+__attribute__((target("avx512f")))
+static long long sum_avx512(const int* data,
+                            const size_t size)
+{
+   __m512i sum0 = _mm512_setzero_si512(), sum1 = _mm512_setzero_si512();
+   size_t i = 0;
+
+   for (; i + 16 <= size; i += 16)
+   {
+      sum0 = _mm512_add_epi64(sum0, _mm512_cvtepi32_epi64(_mm256_loadu_si256((const __m256i*)(data + i))));
+      sum1 = _mm512_add_epi64(sum1, _mm512_cvtepi32_epi64(_mm256_loadu_si256((const __m256i*)(data + i + 8))));
+   }
+
+   return _mm512_reduce_add_epi64(_mm512_add_epi64(sum0, sum1)) + sum_scalar(data + i, size - i);
+}
+
+/********************************************************************************
+* select_sse2: Returnerar a dr angiven mask r satt, annars b. Anvnds i
+*              stllet fr min- och maxinstruktioner, som saknas i SSE2.
+*
+*              - mask: Mask dr varje element r antingen 0 eller -1.
+*              - a   : Vrden som vljs dr masken r satt.
+*              - b   : Vrden som vljs dr masken inte r satt.
+********************************************************************************/
+__attribute__((target("sse2")))
+static inline __m128i select_sse2(const __m128i mask,
+                                  const __m128i a,
+                                  const __m128i b)
+{
+   return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+}
+
+/********************************************************************************
+* minmax_sse2: Version av int_simd_minmax fr SSE2, fyra heltal per iteration.
+*
+*              - data: Pekare till fltet som ska genomskas.
+*              - size: Antalet heltal i fltet (minst 1).
+*              - min : Pekare till variabel fr minsta vrdet.
+*              - max : Pekare till variabel fr strsta vrdet.
+********************************************************************************/
+__attribute__((target("sse2")))
+static void minmax_sse2(const int* data,
+                        const size_t size,
+                        int* min,
+                        int* max)
+{
+   __m128i low = _mm_set1_epi32(data[0]), high = low;
+   int lanes[8];
+   size_t i = 0;
+
+   for (; i + 4 <= size; i += 4)
+   {
+      const __m128i value = _mm_loadu_si128((const __m128i*)(data + i));
+      low = select_sse2(_mm_cmpgt_epi32(low, value), value, low);
+      high = select_sse2(_mm_cmpgt_epi32(value, high), value, high);
+   }
+
+   _mm_storeu_si128((__m128i*)lanes, low);
+   _mm_storeu_si128((__m128i*)(lanes + 4), high);
+   *min = *max = data[0];
+   minmax_scalar(lanes, 8, min, max);
+   minmax_scalar(data + i, size - i, min, max);
+   return;
+}
+
+/********************************************************************************
+* minmax_avx2: Version av int_simd_minmax fr AVX2, tta heltal per iteration.
+*
+*              - data: Pekare till fltet som ska genomskas.
+*              - size: Antalet heltal i fltet (minst 1).
+*              - min : Pekare till variabel fr minsta vrdet.
+*              - max : Pekare till variabel fr strsta vrdet.
+********************************************************************************/
+__attribute__((target("avx2")))
+static void minmax_avx2(const int* data,
+                        const size_t size,
+                        int* min,
+                        int* max)
+{
+   __m256i low = _mm256_set1_epi32(data[0]), high = low;
+   int lanes[16];
+   size_t i = 0;
+
+   for (; i + 8 <= size; i += 8)
+   {
+      const __m256i value = _mm256_loadu_si256((const __m256i*)(data + i));
+      low = _mm256_min_epi32(low, value);
+      high = _mm256_max_epi32(high, value);
+   }
+
+   _mm256_storeu_si256((__m256i*)lanes, low);
+   _mm256_storeu_si256((__m256i*)(lanes + 8), high);
+   *min = *max = data[0];
+   minmax_scalar(lanes, 16, min, max);
+   minmax_scalar(data + i, size - i, min, max);
+   return;
+}
+
+/********************************************************************************
+* minmax_avx512: Version av int_simd_minmax fr AVX-512, sexton heltal per
+*                iteration.
+*
+*                - data: Pekare till fltet som ska genomskas.
+*                - size: Antalet heltal i fltet (minst 1).
+*                - min : Pekare till variabel fr minsta vrdet.
+*                - max : Pekare till variabel fr strsta vrdet.
+********************************************************************************/
+__attribute__((target("avx512f")))
+static void minmax_avx512(const int* data,
+                          const size_t size,
+                          int* min,
+                          int* max)
+{
+   __m512i low = _mm512_set1_epi32(data[0]), high = low;
+   size_t i = 0;
+
+   for (; i + 16 <= size; i += 16)
+   {
+      const __m512i value = _mm512_loadu_si512((const void*)(data + i));
+      low = _mm512_min_epi32(low, value);
+      high = _mm512_max_epi32(high, value);
+   }
+
+   *min = _mm512_reduce_min_epi32(low);
+   *max = _mm512_reduce_max_epi32(high);
+   minmax_scalar(data + i, size - i, min, max);
+   return;
+}
+
+/********************************************************************************
+* count_lanes_sse2: Returnerar summan av rknarna i angivet register.
+*
+*                   - counts: Register med fyra 32-bitars rknare.
+********************************************************************************/
+__attribute__((target("sse2")))
+static inline size_t count_lanes_sse2(const __m128i counts)
+{
+   unsigned lanes[4];
+   _mm_storeu_si128((__m128i*)lanes, counts);
+   return (size_t)lanes[0] + lanes[1] + lanes[2] + lanes[3];
+}
+
+/********************************************************************************
+* count_lanes_avx2: Returnerar summan av rknarna i angivet register.
+*
+*                   - counts: Register med tta 32-bitars rknare.
+********************************************************************************/
+__attribute__((target("avx2")))
+static inline size_t count_lanes_avx2(const __m256i counts)
+{
+   return count_lanes_sse2(_mm256_castsi256_si128(counts)) +
+          count_lanes_sse2(_mm256_extracti128_si256(counts, 1));
+}
+
+/********************************************************************************
+* count_eq_sse2: Version av int_simd_count_eq fr SSE2, fyra heltal per
+*                iteration. Jmfrelsen ger -1 per trff, som dras frn
+*                rknarna i registret.
+*
+*                - data : Pekare till fltet som ska genomskas.
+*                - size : Antalet heltal i fltet.
+*                - value: Vrdet som ska rknas.
+********************************************************************************/
+__attribute__((target("sse2")))
+static size_t count_eq_sse2(const int* data,
+                            const size_t size,
+                            const int value)
+{
+   const __m128i target = _mm_set1_epi32(value);
+   size_t count = 0, i = 0;
+
+   while (i + 4 <= size)
+   {
+      const size_t block_end = size - i > COUNT_BLOCK ? i + COUNT_BLOCK : size;
+      __m128i counts = _mm_setzero_si128();
+
+      for (; i + 4 <= block_end; i += 4)
+      {
+         const __m128i match = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(data + i)), target);
+         counts = _mm_sub_epi32(counts, match);
+      }
+
+      count += count_lanes_sse2(counts);
+   }
+
+   return count + count_eq_scalar(data + i, size - i, value);
+}
+
+/********************************************************************************
+* count_eq_avx2: Version av int_simd_count_eq fr AVX2, tta heltal per
+*                iteration.
+*
+*                - data : Pekare till fltet som ska genomskas.
+*                - size : Antalet heltal i fltet.
+*                - value: Vrdet som ska rknas.
+********************************************************************************/
+__attribute__((target("avx2")))
+static size_t count_eq_avx2(const int* data,
+                            const size_t size,
+                            const int value)
+{
+   const __m256i target = _mm256_set1_epi32(value);
+   size_t count = 0, i = 0;
+
+   while (i + 8 <= size)
+   {
+      const size_t block_end = size - i > COUNT_BLOCK ? i + COUNT_BLOCK : size;
+      __m256i counts = _mm256_setzero_si256();
+
+      for (; i + 8 <= block_end; i += 8)
+      {
+         const __m256i match = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(data + i)), target);
+         counts = _mm256_sub_epi32(counts, match);
+      }
+
+      count += count_lanes_avx2(counts);
+   }
+
+   return count + count_eq_scalar(data + i, size - i, value);
+}
+
+/********************************************************************************
+* count_eq_avx512: Version av int_simd_count_eq fr AVX-512, sexton heltal per
+*                  iteration. Jmfrelsen ger en bitmask, vars satta bitar
+*                  rknas direkt.
+*
+*                  - data : Pekare till fltet som ska genomskas.
+*                  - size : Antalet heltal i fltet.
+*                  - value: Vrdet som ska rknas.
+********************************************************************************/
+__attribute__((target("avx512f")))
+static size_t count_eq_avx512(const int* data,
+                              const size_t size,
+                              const int value)
+{
+   const __m512i target = _mm512_set1_epi32(value);
+   size_t count = 0, i = 0;
+
+   for (; i + 16 <= size; i += 16)
+   {
+      const __mmask16 match = _mm512_cmpeq_epi32_mask(_mm512_loadu_si512((const void*)(data + i)), target);
+      count += (size_t)__builtin_popcount((unsigned)match);
+   }
+
+   return count + count_eq_scalar(data + i, size - i, value);
+}
+
+/********************************************************************************
+* count_range_sse2: Version av int_simd_count_range fr SSE2, fyra heltal per
+*                   iteration. Eftersom SSE2 saknar osignerade jmfrelser
+*                   vnds teckenbiten p bda leden, vilket ger samma
+*                   ordning vid signerad jmfrelse.
+*
+*                   - data: Pekare till fltet som ska genomskas.
+*                   - size: Antalet heltal i fltet.
+*                   - low : Intervallets undre grns (inklusive).
+*                   - high: Intervallets vre grns (inklusive).
+********************************************************************************/
+__attribute__((target("sse2")))
+static size_t count_range_sse2(const int* data,
+                               const size_t size,
+                               const int low,
+                               const int high)
+{
+   const __m128i sign = _mm_set1_epi32((int)0x80000000u);
+   const __m128i offset = _mm_set1_epi32(low);
+   const __m128i bound = _mm_xor_si128(_mm_set1_epi32((int)((unsigned)high - (unsigned)low)), sign);
+   const __m128i ones = _mm_set1_epi32(-1);
+   size_t count = 0, i = 0;
+
+   while (i + 4 <= size)
+   {
+      const size_t block_end = size - i > COUNT_BLOCK ? i + COUNT_BLOCK : size;
+      __m128i counts = _mm_setzero_si128();
+
+      for (; i + 4 <= block_end; i += 4)
+      {
+         const __m128i value = _mm_loadu_si128((const __m128i*)(data + i));
+         const __m128i outside = _mm_cmpgt_epi32(_mm_xor_si128(_mm_sub_epi32(value, offset), sign), bound);
+         counts = _mm_sub_epi32(counts, _mm_andnot_si128(outside, ones));
+      }
+
+      count += count_lanes_sse2(counts);
+   }
+
+   return count + count_range_scalar(data + i, size - i, low, high);
+}
+
+/********************************************************************************
+* count_range_avx2: Version av int_simd_count_range fr AVX2, tta heltal per
+*                   iteration.
+*
+*                   - data: Pekare till fltet som ska genomskas.
+*                   - size: Antalet heltal i fltet.
+*                   - low : Intervallets undre grns (inklusive).
+*                   - high: Intervallets vre grns (inklusive).
+********************************************************************************/
+__attribute__((target("avx2")))
+static size_t count_range_avx2(const int* data,
+                               const size_t size,
+                               const int low,
+                               const int high)
+{
+   const __m256i sign = _mm256_set1_epi32((int)0x80000000u);
+   const __m256i offset = _mm256_set1_epi32(low);
+   const __m256i bound = _mm256_xor_si256(_mm256_set1_epi32((int)((unsigned)high - (unsigned)low)), sign);
+   const __m256i ones = _mm256_set1_epi32(-1);
+   size_t count = 0, i = 0;
+
+   while (i + 8 <= size)
+   {
+      const size_t block_end = size - i > COUNT_BLOCK ? i + COUNT_BLOCK : size;
+      __m256i counts = _mm256_setzero_si256();
+
+      for (; i + 8 <= block_end; i += 8)
+      {
+         const __m256i value = _mm256_loadu_si256((const __m256i*)(data + i));
+         const __m256i outside = _mm256_cmpgt_epi32(_mm256_xor_si256(_mm256_sub_epi32(value, offset), sign), bound);
+         counts = _mm256_sub_epi32(counts, _mm256_andnot_si256(outside, ones));
+      }
+
+      count += count_lanes_avx2(counts);
+   }
+
+   return count + count_range_scalar(data + i, size - i, low, high);
+}
+
+/********************************************************************************
+* count_range_avx512: Version av int_simd_count_range fr AVX-512, sexton
+*                     heltal per iteration, dr AVX-512 har std fr
+*                     osignerade jmfrelser.
+*
+*                     - data: Pekare till fltet som ska genomskas.
+*                     - size: Antalet heltal i fltet.
+*                     - low : Intervallets undre grns (inklusive).
+*                     - high: Intervallets vre grns (inklusive).
+********************************************************************************/
+__attribute__((target("avx512f")))
+static size_t count_range_avx512(const int* data,
+                                 const size_t size,
+                                 const int low,
+                                 const int high)
+{
+   const __m512i offset = _mm512_set1_epi32(low);
+   const __m512i range = _mm512_set1_epi32((int)((unsigned)high - (unsigned)low));
+   size_t count = 0, i = 0;
+
+   for (; i + 16 <= size; i += 16)
+   {
+      const __m512i value = _mm512_loadu_si512((const void*)(data + i));
+      const __mmask16 inside = _mm512_cmple_epu32_mask(_mm512_sub_epi32(value, offset), range);
+      count += (size_t)__builtin_popcount((unsigned)inside);
+   }
+
+   return count + count_range_scalar(data + i, size - i, low, high);
+}
+
+/********************************************************************************
+* find_sse2: Version av int_simd_find fr SSE2, fyra heltal per iteration.
+*            Vid trff avlses positionen ur jmfrelsens teckenbitar.
+*
+*            - data : Pekare till fltet som ska genomskas.
+*            - size : Antalet heltal i fltet.
+*            - value: Vrdet som ska skas efter.
+********************************************************************************/
+__attribute__((target("sse2")))
+static size_t find_sse2(const int* data,
+                        const size_t size,
+                        const int value)
+{
+   const __m128i target = _mm_set1_epi32(value);
+   size_t i = 0;
+
+   for (; i + 4 <= size; i += 4)
+   {
+      const __m128i match = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(data + i)), target);
+      const int mask = _mm_movemask_ps(_mm_castsi128_ps(match));
+      if (mask) return i + (size_t)__builtin_ctz((unsigned)mask);
+   }
+
+   return i + find_scalar(data + i, size - i, value);
+}
+
+/********************************************************************************
+* find_avx2: Version av int_simd_find fr AVX2, tta heltal per iteration.
+*
+*            - data : Pekare till fltet som ska genomskas.
+*            - size : Antalet heltal i fltet.
+*            - value: Vrdet som ska skas efter.
+********************************************************************************/
+__attribute__((target("avx2")))
+static size_t find_avx2(const int* data,
+                        const size_t size,
+                        const int value)
+{
+   const __m256i target = _mm256_set1_epi32(value);
+   size_t i = 0;
+
+   for (; i + 8 <= size; i += 8)
+   {
+      const __m256i match = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(data + i)), target);
+      const int mask = _mm256_movemask_ps(_mm256_castsi256_ps(match));
+      if (mask) return i + (size_t)__builtin_ctz((unsigned)mask);
+   }
+
+   return i + find_scalar(data + i, size - i, value);
+}
+
+/********************************************************************************
+* find_avx512: Version av int_simd_find fr AVX-512, sexton heltal per
+*              iteration.
+*
+*              - data : Pekare till fltet som ska genomskas.
+*              - size : Antalet heltal i fltet.
+*              - value: Vrdet som ska skas efter.
+********************************************************************************/
+__attribute__((target("avx512f")))
+static size_t find_avx512(const int* data,
+                          const size_t size,
+                          const int value)
+{
+   const __m512i target = _mm512_set1_epi32(value);
+   size_t i = 0;
+
+   for (; i + 16 <= size; i += 16)
+   {
+      const __mmask16 match = _mm512_cmpeq_epi32_mask(_mm512_loadu_si512((const void*)(data + i)), target);
+      if (match) return i + (size_t)__builtin_ctz((unsigned)match);
+   }
+
+   return i + find_scalar(data + i, size - i, value);
+}
+
+#endif /* INT_SIMD_X86 */
+
+/********************************************************************************
+* install: Stter samtliga krnors funktionspekare till versionerna fr
+*          angiven instruktionsuppsttning.
+*
+*          - isa: Instruktionsuppsttningen (INT_SIMD_*).
+********************************************************************************/
+static void install(const int isa)
+{
+   assign_impl = assign_scalar;
+   sum_impl = sum_scalar;
+   minmax_impl = minmax_scalar_kernel;
+   count_eq_impl = count_eq_scalar;
+   count_range_impl = count_range_scalar;
+   find_impl = find_scalar;
+
+#if INT_SIMD_X86
+   if (isa == INT_SIMD_SSE2)
+   {
+      assign_impl = assign_sse2;
+      sum_impl = sum_sse2;
+      minmax_impl = minmax_sse2;
+      count_eq_impl = count_eq_sse2;
+      count_range_impl = count_range_sse2;
+      find_impl = find_sse2;
+   }
+   else if (isa == INT_SIMD_AVX2)
+   {
+      assign_impl = assign_avx2;
+      sum_impl = sum_avx2;
+      minmax_impl = minmax_avx2;
+      count_eq_impl = count_eq_avx2;
+      count_range_impl = count_range_avx2;
+      find_impl = find_avx2;
+   }
+   else if (isa == INT_SIMD_AVX512)
+   {
+      assign_impl = assign_avx512;
+      sum_impl = sum_avx512;
+      minmax_impl = minmax_avx512;
+      count_eq_impl = count_eq_avx512;
+      count_range_impl = count_range_avx512;
+      find_impl = find_avx512;
+   }
+#endif
+
+   current_isa = isa;
+   return;
+}
+
+/********************************************************************************
+* resolve: Vljer krnornas versioner efter den bsta instruktionsuppsttning
+*          som processorn stder. Anropas exakt en gng via pthread_once frn
+*          varje publik funktion, s att valet aldrig grs samtidigt av flera
+*          trdar och r synligt fr samtliga trdar innan ngon krna anropas.
+********************************************************************************/
+static void resolve(void)
+{
+   install(int_simd_best());
+   return;
+}
+
+/********************************************************************************
+* int_simd_best: Returnerar den bsta instruktionsuppsttningen som aktuell
+*                processor stder, dvs. ngon av konstanterna INT_SIMD_*.
+*                Stdet avlses via instruktionen cpuid, dr ven std frn
+*                operativsystemet fr de bredare registren kontrolleras.
+********************************************************************************/
+int int_simd_best(void)
+{
+#if INT_SIMD_X86
+   __builtin_cpu_init();
+   if (__builtin_cpu_supports("avx512f")) return INT_SIMD_AVX512;
+   if (__builtin_cpu_supports("avx2")) return INT_SIMD_AVX2;
+   if (__builtin_cpu_supports("sse2")) return INT_SIMD_SSE2;
+#endif
+   return INT_SIMD_SCALAR;
+}
+
+/********************************************************************************
+* int_simd_isa: Returnerar den instruktionsuppsttning som krnorna anvnder
+*               fr nrvarande, dvs. ngon av konstanterna INT_SIMD_*.
+********************************************************************************/
+int int_simd_isa(void)
+{
+   pthread_once(&resolved, resolve);
+   return current_isa;
+}
+
+/********************************************************************************
+* int_simd_isa_name: Returnerar namnet p angiven instruktionsuppsttning som
+*                    en strng, exempelvis "avx2".
+*
+*                    - isa: Instruktionsuppsttningen (INT_SIMD_*).
+********************************************************************************/
+const char* int_simd_isa_name(const int isa)
+{
+   static const char* names[] = { "scalar", "sse2", "avx2", "avx512" };
+   return isa >= INT_SIMD_SCALAR && isa <= INT_SIMD_AVX512 ? names[isa] : "unknown";
+}
+
+/********************************************************************************
+* int_simd_select: Vljer angiven instruktionsuppsttning fr samtliga krnor,
+*                  exempelvis fr jmfrelser mellan versionerna. Vid lyckat
+*                  val returneras 0. Om processorn inte stder angiven
+*                  instruktionsuppsttning returneras felkod 1 och nuvarande
+*                  val bibehlls.
+*
+*                  - isa: Instruktionsuppsttningen (INT_SIMD_*).
+********************************************************************************/
+int int_simd_select(const int isa)
+{
+   if (isa < INT_SIMD_SCALAR || isa > int_simd_best()) return 1;
+   pthread_once(&resolved, resolve);
+   install(isa);
+   return 0;
+}
+
+/********************************************************************************
+* int_simd_assign: Tilldelar angivet flt en aritmetisk talfljd, dr
+*                  data[i] = start + i * step. Vid verslag sker
+*                  tvkomplementsomslag, dvs. resultatet r detsamma som
+*                  om talen rknades fram ett i taget via num += step.
+*
+*                  - data : Pekare till fltet som ska tilldelas.
+*                  - size : Antalet heltal som ska tilldelas.
+*                  - start: Startvrde fr talfljden.
+*                  - step : Stegvrde, dvs. differensen mellan varje tal.
+********************************************************************************/
+void int_simd_assign(int* data,
+                     const size_t size,
+                     const int start,
+                     const int step)
+{
+   pthread_once(&resolved, resolve);
+   assign_impl(data, size, start, step);
+   return;
+}
+
+/********************************************************************************
+* int_simd_sum: Returnerar summan av samtliga heltal i angivet flt, berknad
+*               med 64-bitars ackumulatorer s att summan inte slr ver.
+*
+*               - data: Pekare till fltet som ska summeras.
+*               - size: Antalet heltal i fltet.
+********************************************************************************/
+long long int_simd_sum(const int* data,
+                       const size_t size)
+{
+   pthread_once(&resolved, resolve);
+   return sum_impl(data, size);
+}
+
+/********************************************************************************
+* int_simd_minmax: Tilldelar angivna variabler minsta respektive strsta
+*                  vrdet i angivet flt. Vid lyckad skning returneras 0.
+*                  Om fltet r tomt returneras felkod 1 och variablerna
+*                  lmnas ofrndrade.
+*
+*                  - data: Pekare till fltet som ska genomskas.
+*                  - size: Antalet heltal i fltet.
+*                  - min : Pekare till variabel fr minsta vrdet.
+*                  - max : Pekare till variabel fr strsta vrdet.
+********************************************************************************/
+int int_simd_minmax(const int* data,
+                    const size_t size,
+                    int* min,
+                    int* max)
+{
+   pthread_once(&resolved, resolve);
+   if (size == 0) return 1;
+   minmax_impl(data, size, min, max);
+   return 0;
+}
+
+/********************************************************************************
+* int_simd_count_eq: Returnerar antalet heltal i angivet flt som r lika med
+*                    angivet vrde.
+*
+*                    - data : Pekare till fltet som ska genomskas.
+*                    - size : Antalet heltal i fltet.
+*                    - value: Vrdet som ska rknas.
+********************************************************************************/
+size_t int_simd_count_eq(const int* data,
+                         const size_t size,
+                         const int value)
+{
+   pthread_once(&resolved, resolve);
+   return count_eq_impl(data, size, value);
+}
+
+/********************************************************************************
+* int_simd_count_range: Returnerar antalet heltal i angivet flt som ligger i
+*                       det slutna intervallet [low, high]. Om low verstiger
+*                       high r intervallet tomt och 0 returneras.
+*
+*                       - data: Pekare till fltet som ska genomskas.
+*                       - size: Antalet heltal i fltet.
+*                       - low : Intervallets undre grns (inklusive).
+*                       - high: Intervallets vre grns (inklusive).
+********************************************************************************/
+size_t int_simd_count_range(const int* data,
+                            const size_t size,
+                            const int low,
+                            const int high)
+{
+   pthread_once(&resolved, resolve);
+   if (low > high) return 0;
+   return count_range_impl(data, size, low, high);
+}
+
+/********************************************************************************
+* int_simd_find: Returnerar index fr frsta heltalet i angivet flt som r
+*                lika med angivet vrde. Om vrdet saknas returneras size.
+*
+*                - data : Pekare till fltet som ska genomskas.
+*                - size : Antalet heltal i fltet.
+*                - value: Vrdet som ska skas efter.
+********************************************************************************/
+size_t int_simd_find(const int* data,
+                     const size_t size,
+                     const int value)
+{
+   pthread_once(&resolved, resolve);
+   return find_impl(data, size, value);
+}
\ No newline at end of file
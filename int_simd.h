@@ -0,0 +1,145 @@
+/********************************************************************************
+* int_simd.h: Innehller vektoriserade krnor (SIMD) fr operationer p flt
+*             med heltal, exempelvis tilldelning, summering och skning.
+*             Varje krna finns i en skalr version samt i versioner fr
+*             instruktionsuppsttningarna SSE2, AVX2 och AVX-512 p
+*             x86-processorer. Den bsta versionen som processorn
+*             stder vljs en gng vid frsta anropet via cpuid, varefter
+*             anropen gr direkt till vald version via en funktionspekare.
+*             Valet sker via pthread_once, s att krnorna kan anropas
+*             frn flera trdar samtidigt redan frn frsta anropet.
+*             P andra plattformar anvnds den skalra versionen.
+********************************************************************************/
+#ifndef INT_SIMD_H_
+#define INT_SIMD_H_
+
+/* Inkluderingsdirektiv: */
+#include <stddef.h> /* Innehller size_t. */
+
+/********************************************************************************
+* Instruktionsuppsttningar som krnorna finns implementerade fr:
+*
+* - INT_SIMD_SCALAR: Portabel skalr version, ett heltal per iteration.
+* - INT_SIMD_SSE2  : 128-bitars register, fyra heltal per iteration.
+* - INT_SIMD_AVX2  : 256-bitars register, tta heltal per iteration.
+* - INT_SIMD_AVX512: 512-bitars register, sexton heltal per iteration.
+********************************************************************************/
+#define INT_SIMD_SCALAR 0
+#define INT_SIMD_SSE2   1
+#define INT_SIMD_AVX2   2
+#define INT_SIMD_AVX512 3
+
+/********************************************************************************
+* int_simd_best: Returnerar den bsta instruktionsuppsttningen som aktuell
+*                processor stder, dvs. ngon av konstanterna INT_SIMD_*.
+********************************************************************************/
+int int_simd_best(void);
+
+/********************************************************************************
+* int_simd_isa: Returnerar den instruktionsuppsttning som krnorna anvnder
+*               fr nrvarande, dvs. ngon av konstanterna INT_SIMD_*.
+********************************************************************************/
+int int_simd_isa(void);
+
+/********************************************************************************
+* int_simd_isa_name: Returnerar namnet p angiven instruktionsuppsttning som
+*                    en strng, exempelvis "avx2".
+*
+*                    - isa: Instruktionsuppsttningen (INT_SIMD_*).
+********************************************************************************/
+const char* int_simd_isa_name(const int isa);
+
+/********************************************************************************
+* int_simd_select: Vljer angiven instruktionsuppsttning fr samtliga krnor,
+*                  exempelvis fr jmfrelser mellan versionerna. Vid lyckat
+*                  val returneras 0. Om processorn inte stder angiven
+*                  instruktionsuppsttning returneras felkod 1 och nuvarande
+*                  val bibehlls. Funktionen fr inte anropas medan andra
+*                  trdar anropar krnorna.
+*
+*                  - isa: Instruktionsuppsttningen (INT_SIMD_*).
+********************************************************************************/
+int int_simd_select(const int isa);
+
+/********************************************************************************
+* int_simd_assign: Tilldelar angivet flt en aritmetisk talfljd, dr
+*                  data[i] = start + i * step. Vid verslag sker
+*                  tvkomplementsomslag, dvs. resultatet r detsamma som
+*                  om talen rknades fram ett i taget via num += step.
+*
+*                  - data : Pekare till fltet som ska tilldelas.
+*                  - size : Antalet heltal som ska tilldelas.
+*                  - start: Startvrde fr talfljden.
+*                  - step : Stegvrde, dvs. differensen mellan varje tal.
+********************************************************************************/
+void int_simd_assign(int* data,
+                     const size_t size,
+                     const int start,
+                     const int step);
+
+/********************************************************************************
+* int_simd_sum: Returnerar summan av samtliga heltal i angivet flt, berknad
+*               med 64-bitars ackumulatorer s att summan inte slr ver.
+*
+*               - data: Pekare till fltet som ska summeras.
+*               - size: Antalet heltal i fltet.
+********************************************************************************/
+long long int_simd_sum(const int* data,
+                       const size_t size);
+
+/********************************************************************************
+* int_simd_minmax: Tilldelar angivna variabler minsta respektive strsta
+*                  vrdet i angivet flt. Vid lyckad skning returneras 0.
+*                  Om fltet r tomt returneras felkod 1 och variablerna
+*                  lmnas ofrndrade.
+*
+*                  - data: Pekare till fltet som ska genomskas.
+*                  - size: Antalet heltal i fltet.
+*                  - min : Pekare till variabel fr minsta vrdet.
+*                  - max : Pekare till variabel fr strsta vrdet.
+********************************************************************************/
+int int_simd_minmax(const int* data,
+                    const size_t size,
+                    int* min,
+                    int* max);
+
+/********************************************************************************
+* int_simd_count_eq: Returnerar antalet heltal i angivet flt som r lika med
+*                    angivet vrde.
+*
+*                    - data : Pekare till fltet som ska genomskas.
+*                    - size : Antalet heltal i fltet.
+*                    - value: Vrdet som ska rknas.
+********************************************************************************/
+size_t int_simd_count_eq(const int* data,
+                         const size_t size,
+                         const int value);
+
+/********************************************************************************
+* int_simd_count_range: Returnerar antalet heltal i angivet flt som ligger i
+*                       det slutna intervallet [low, high]. Om low verstiger
+*                       high r intervallet tomt och 0 returneras.
+*
+*                       - data: Pekare till fltet som ska genomskas.
+*                       - size: Antalet heltal i fltet.
+*                       - low : Intervallets undre grns (inklusive).
+*                       - high: Intervallets vre grns (inklusive).
+********************************************************************************/
+size_t int_simd_count_range(const int* data,
+                            const size_t size,
+                            const int low,
+                            const int high);
+
+/********************************************************************************
+* int_simd_find: Returnerar index fr frsta heltalet i angivet flt som r
+*                lika med angivet vrde. Om vrdet saknas returneras size.
+*
+*                - data : Pekare till fltet som ska genomskas.
+*                - size : Antalet heltal i fltet.
+*                - value: Vrdet som ska skas efter.
+********************************************************************************/
+size_t int_simd_find(const int* data,
+                     const size_t size,
+                     const int value);
+
+#endif /* INT_SIMD_H_ */
\ No newline at end of file
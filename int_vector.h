@@ -2,6 +2,11 @@
 * int_vector.h: Innehller funktionalitet fr lagring samt utskrift av 
 *               dynamiska arrayer innehllande heltal via strukten int_vector
 *               samt associerade funktioner.
+*
+*               Strukten och funktionerna genereras via mallen i
+*               vector_template.h, som ven anvnds fr vektorer med andra
+*               elementtyper, se vector_family.h. Fr int sker tilldelning,
+*               summering och skning vektoriserat via int_simd.h.
 ********************************************************************************/
 #ifndef INT_VECTOR_H_
 #define INT_VECTOR_H_
@@ -10,148 +15,18 @@
 #include <stdio.h>  /* Innehller printf, FILE* med mera. */
 #include <stdlib.h> /* Innehller malloc, realloc och free. */
 
-/********************************************************************************
-* int_vector: Strukt fr dynamiska arrayer (vektorer) innehllande heltal.
-********************************************************************************/
-struct int_vector
-{
-   int* data;   /* Pekare till det dynamiska fltet (arrayen). */
-   size_t size; /* Vektorns storlek, dvs. antalet heltal den rymmer. */
-};
-
-/********************************************************************************
-* int_vector_init: Initierar ny tom dynamisk vektor.
-* 
-*                  - self: Pekare till den vektor som ska initieras.
-********************************************************************************/
-static inline void int_vector_init(struct int_vector* self)
-{
-   self->data = 0;
-   self->size = 0;
-   return;
-}
-
-/********************************************************************************
-* int_vector_clear: Tmmer angiven dynamisk vektor.
-*
-*                   - self: Pekare till den vektor som ska tmmas.
-********************************************************************************/
-static inline void int_vector_clear(struct int_vector* self)
-{
-   free(self->data);
-   int_vector_init(self);
-   return;
-}
-
-/********************************************************************************
-* int_vector_new: Returnerar en pekare till en ny dynamiskt allokerad vektor,
-*                 som initieras till tom vid start. Om minnesallokeringen
-*                 misslyckas returneras null.
-********************************************************************************/
-static inline struct int_vector* int_vector_new(void)
-{
-   struct int_vector* self = (struct int_vector*)malloc(sizeof(struct int_vector));
-   if (!self) return 0;
-   int_vector_init(self);
-   return self;
-}
-
-/********************************************************************************
-* int_vector_delete: Raderar angiven dynamiskt allokerad vektor och stter
-*                    vektorpekaren till null.
-* 
-*                    - self: Adressen till vektorpekaren.
-********************************************************************************/
-static inline void int_vector_delete(struct int_vector** self)
-{
-   int_vector_clear(*self);
-   free(*self);
-   *self = 0;
-   return;
-}
-
-/********************************************************************************
-* int_vector_begin: Returnerar adressen till frsta elementet i angiven vektor.
-*                   Om vektorn r tom returneras null.
-* 
-*                   - self: Pekare till vektorn.
-********************************************************************************/
-static inline int* int_vector_begin(const struct int_vector* self)
-{
-   return self->data;
-}
-
-/********************************************************************************
-* int_vector_end: Returnerar adressen efter sista elementet i angiven vektor.
-*                 Om vektorn r tom returneras null.
-*
-*                 - self: Pekare till vektorn.
-********************************************************************************/
-static inline int* int_vector_end(const struct int_vector* self)
-{
-   return self->data + self->size;
-}
-
-/********************************************************************************
-* int_vector_last: Returnerar adressen till sista elementet i angiven vektor.
-*                  Om vektorn r tom returneras null.
-*
-*                  - self: Pekare till vektorn.
-********************************************************************************/
-static inline int* int_vector_last(const struct int_vector* self)
-{
-   return self->size > 0 ? int_vector_end(self) - 1 : 0;
-}
-
-/********************************************************************************
-* int_vector_resize: ndrar storleken p angiven dynamisk vektor. Vid lyckad
-*                    minnesallokering returneras 0, annars returneras felkod 1.
-*
-*                    - self: Pekare till den vektor vars storlek ska ndras.
-*                    - size: Vektorns storlek efter omallokeringen.
-********************************************************************************/
-int int_vector_resize(struct int_vector* self,
-                      const size_t size);
-
-/********************************************************************************
-* int_vector_push: Lgger till ett nytt heltal lngst bak i angiven vektor.
-*                  Om minnesallokeringen lyckas s returneras 0, annars felkod 1.
-*
-*                  - self: Pekare till vektorn som ska tilldelas det nya talet.
-*                  - num : Det nya tal som ska lggas till.
-********************************************************************************/
-int int_vector_push(struct int_vector* self,
-                    const int num);
-
-/********************************************************************************
-* int_vector_pop: Tar bort sista heltalet i angiven vektor. Om minnesallokeringen 
-*                 lyckas s returneras 0, annars felkod 1.
-*
-*                 - self: Pekare till vektorn vars sista heltal ska tas bort.
-********************************************************************************/
-int int_vector_pop(struct int_vector* self);
+#include "allocator.h"
+#include "int_vector_stats.h"
 
 /********************************************************************************
-* int_vector_assign: Tilldelar heltal till angiven vektor med godtyckligt 
-*                    start- och stegvrde.
-*
-*                    - self     : Pekare till vektorn som ska tilldelas.
-*                    - start_val: Startvrde fr tilldelningen.
-*                    - step_val : Stegvrde, dvs. differensen mellan varje tal.
-********************************************************************************/
-void int_vector_assign(struct int_vector* self,
-                       const int start_val,
-                       const int step_val);
-
-/********************************************************************************
-* int_vector_print: Skriver ut heltal lagrade i angiven vektor via godtycklig
-*                   utstrm, dr standardutenheten stdout anvnds som default
-*                   fr utskrift i terminalen.
-*
-*                   - self   : Pekare till vektorn som ska tilldelas.
-*                   - ostream: Pekare till godtycklig utstrm (default = stdout).
+* int_vector: Strukt fr dynamiska arrayer (vektorer) innehllande heltal av
+*             typen int, med en inbyggd buffert fr INT_VECTOR_SMALL_CAPACITY
+*             heltal. Summan returneras som ett 64-bitars tal.
 ********************************************************************************/
-void int_vector_print(const struct int_vector* self,
-                      FILE* ostream);
+#define VECTOR_NAME int_vector
+#define VECTOR_TYPE int
+#define VECTOR_SUM_TYPE long long
+#define VECTOR_SMALL_CAPACITY INT_VECTOR_SMALL_CAPACITY
+#include "vector_template.h"
 
 #endif /* INT_VECTOR_H_ */
\ No newline at end of file
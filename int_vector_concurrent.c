@@ -0,0 +1,217 @@
+/********************************************************************************
+* int_vector_concurrent.c: Innehller definitioner av associerade funktioner
+*                          fr strukten int_vector_concurrent.
+********************************************************************************/
+#include "int_vector_concurrent.h"
+
+#include <stdint.h> /* Innehller SIZE_MAX och uintptr_t. */
+#include <string.h> /* Innehller memcpy. */
+
+/********************************************************************************
+* FIRST_SIZE: Antalet heltal som ryms i den frsta hinken.
+********************************************************************************/
+#define FIRST_SIZE ((size_t)1 << INT_VECTOR_CONCURRENT_FIRST_BITS)
+
+/********************************************************************************
+* bucket_size: Returnerar antalet heltal som ryms i angiven hink.
+*
+*              - bucket: Hinkens index.
+********************************************************************************/
+static inline size_t bucket_size(const size_t bucket)
+{
+   return FIRST_SIZE << bucket;
+}
+
+/********************************************************************************
+* locate: Berknar vilken hink samt vilken position i hinken som angivet index
+*         motsvarar. Eftersom hink k brjar p index FIRST_SIZE * (2^k - 1)
+*         ger tvlogaritmen av index + FIRST_SIZE hinkens nummer, och
+*         terstoden positionen i hinken.
+*
+*         - index : Heltalets index i vektorn.
+*         - bucket: Pekare till variabeln som tilldelas hinkens index.
+*         - offset: Pekare till variabeln som tilldelas positionen i hinken.
+********************************************************************************/
+static inline void locate(const size_t index,
+                          size_t* bucket,
+                          size_t* offset)
+{
+   const size_t position = index + FIRST_SIZE;
+   const size_t log2 =
+      sizeof(unsigned long long) * 8 - 1 - (size_t)__builtin_clzll(position);
+   *bucket = log2 - INT_VECTOR_CONCURRENT_FIRST_BITS;
+   *offset = position - ((size_t)1 << log2);
+   return;
+}
+
+/********************************************************************************
+* bucket_get: Returnerar pekare till angiven hink och allokerar denna om den
+*             saknas. Den nya hinken installeras via en atomisk jmfrelse,
+*             och om en annan trd hann installera en hink frst frigrs den
+*             nya hinken och den installerade returneras i stllet. Vid
+*             misslyckad minnesallokering returneras null.
+*
+*             - self  : Pekare till vektorn.
+*             - bucket: Hinkens index.
+********************************************************************************/
+static int* bucket_get(struct int_vector_concurrent* self,
+                       const size_t bucket)
+{
+   int* data = (int*)atomic_load_explicit(&self->buckets[bucket], memory_order_acquire);
+   uintptr_t expected = 0;
+
+   if (data) return data;
+   if (bucket_size(bucket) > SIZE_MAX / sizeof(int)) return 0;
+   data = (int*)malloc(sizeof(int) * bucket_size(bucket));
+   if (!data) return 0;
+
+   if (atomic_compare_exchange_strong_explicit(&self->buckets[bucket], &expected,
+                                               (uintptr_t)data,
+                                               memory_order_acq_rel,
+                                               memory_order_acquire))
+   {
+      INT_VECTOR_STATS_ALLOC(sizeof(int) * bucket_size(bucket));
+      return data;
+   }
+
+   free(data);
+   return (int*)expected;
+}
+
+/********************************************************************************
+* int_vector_concurrent_init: Initierar ny tom vektor.
+*
+*                             - self: Pekare till vektorn som ska initieras.
+********************************************************************************/
+void int_vector_concurrent_init(struct int_vector_concurrent* self)
+{
+   atomic_init(&self->size, 0);
+   atomic_init(&self->failed, 0);
+
+   for (size_t i = 0; i < INT_VECTOR_CONCURRENT_BUCKETS; ++i)
+   {
+      atomic_init(&self->buckets[i], 0);
+   }
+   return;
+}
+
+/********************************************************************************
+* int_vector_concurrent_clear: Frigr samtliga hinkar i angiven vektor och
+*                              nollstller dess storlek.
+*
+*                              - self: Pekare till vektorn som ska tmmas.
+********************************************************************************/
+void int_vector_concurrent_clear(struct int_vector_concurrent* self)
+{
+   for (size_t i = 0; i < INT_VECTOR_CONCURRENT_BUCKETS; ++i)
+   {
+      int* data = (int*)atomic_load_explicit(&self->buckets[i], memory_order_relaxed);
+      if (!data) continue;
+      free(data);
+      INT_VECTOR_STATS_FREE(sizeof(int) * bucket_size(i));
+   }
+
+   int_vector_concurrent_init(self);
+   return;
+}
+
+/********************************************************************************
+* int_vector_concurrent_push: Lgger till ett heltal i angiven vektor p en
+*                             position som reserveras via atomisk addition.
+*
+*                             - self : Pekare till vektorn.
+*                             - value: Heltalet som ska lggas till.
+********************************************************************************/
+int int_vector_concurrent_push(struct int_vector_concurrent* self,
+                               const int value)
+{
+   const size_t index = atomic_fetch_add_explicit(&self->size, 1, memory_order_relaxed);
+   size_t bucket, offset;
+   int* data = 0;
+
+   locate(index, &bucket, &offset);
+   data = bucket_get(self, bucket);
+
+   if (!data)
+   {
+      atomic_store_explicit(&self->failed, 1, memory_order_relaxed);
+      return 1;
+   }
+
+   data[offset] = value;
+   return 0;
+}
+
+/********************************************************************************
+* int_vector_concurrent_append: Lgger till angivet antal heltal i angiven
+*                               vektor p positioner som reserveras via en
+*                               atomisk addition. Heltalen kopieras hink fr
+*                               hink, eftersom de reserverade positionerna
+*                               kan strcka sig ver flera hinkar.
+*
+*                               - self : Pekare till vektorn.
+*                               - data : Pekare till fltet med heltalen.
+*                               - count: Antalet heltal som ska lggas till.
+********************************************************************************/
+int int_vector_concurrent_append(struct int_vector_concurrent* self,
+                                 const int* data,
+                                 const size_t count)
+{
+   size_t index = atomic_fetch_add_explicit(&self->size, count, memory_order_relaxed);
+   size_t remaining = count;
+
+   while (remaining > 0)
+   {
+      size_t bucket, offset, n;
+      int* dst = 0;
+
+      locate(index, &bucket, &offset);
+      dst = bucket_get(self, bucket);
+
+      if (!dst)
+      {
+         atomic_store_explicit(&self->failed, 1, memory_order_relaxed);
+         return 1;
+      }
+
+      n = bucket_size(bucket) - offset;
+      if (n > remaining) n = remaining;
+      memcpy(dst + offset, data, sizeof(int) * n);
+
+      data += n;
+      index += n;
+      remaining -= n;
+   }
+
+   return 0;
+}
+
+/********************************************************************************
+* int_vector_concurrent_freeze: Flyttar samtliga heltal i angiven vektor till
+*                               angiven mlvektor hink fr hink, varefter den
+*                               samtidiga vektorn tms.
+*
+*                               - self: Pekare till vektorn som ska frysas.
+*                               - dst : Pekare till mlvektorn.
+********************************************************************************/
+int int_vector_concurrent_freeze(struct int_vector_concurrent* self,
+                                 struct int_vector* dst)
+{
+   const size_t size = atomic_load_explicit(&self->size, memory_order_relaxed);
+   size_t copied = 0;
+
+   if (atomic_load_explicit(&self->failed, memory_order_relaxed)) return 1;
+   if (int_vector_resize(dst, size)) return 1;
+
+   for (size_t i = 0; copied < size; ++i)
+   {
+      const int* data = (const int*)atomic_load_explicit(&self->buckets[i], memory_order_relaxed);
+      size_t n = bucket_size(i);
+      if (n > size - copied) n = size - copied;
+      memcpy(dst->data + copied, data, sizeof(int) * n);
+      copied += n;
+   }
+
+   int_vector_concurrent_clear(self);
+   return 0;
+}
\ No newline at end of file
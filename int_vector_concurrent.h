@@ -0,0 +1,159 @@
+/********************************************************************************
+* int_vector_concurrent.h: Innehller strukten int_vector_concurrent, en vektor
+*                          som flera trdar kan lgga till heltal i samtidigt
+*                          utan ls, samt associerade funktioner.
+*
+*                          Varje pushoperation reserverar sin position via en
+*                          atomisk addition av storleken, varefter heltalet
+*                          skrivs direkt p reserverad position. Heltalen
+*                          lagras i segment (hinkar) vars storlekar r
+*                          tvpotenser, dr hink k rymmer dubbelt s mnga
+*                          heltal som hink k - 1. Eftersom befintliga hinkar
+*                          aldrig omallokeras flyttas inga heltal nr
+*                          vektorn vxer. En ny hink allokeras av den trd
+*                          som frst behver den och installeras via en
+*                          atomisk jmfrelse, dr en trd som frlorar
+*                          kapplpningen frigr sin hink och anvnder den
+*                          installerade.
+*
+*                          Nr samtliga skrivande trdar r klara (exempelvis
+*                          efter pthread_join) kan vektorn frysas via
+*                          int_vector_concurrent_freeze, vilket flyttar
+*                          heltalen till en sammanhngande int_vector i
+*                          samma ordning som de reserverades.
+*
+*                          Eftersom samtliga trdar delar storleken blir
+*                          denna en flaskhals vid mycket mnga trdar. Trdar
+*                          som lgger till mnga heltal br drfr hellre
+*                          lgga till dem i omgngar via
+*                          int_vector_concurrent_append, som endast krver
+*                          en atomisk operation per omgng.
+********************************************************************************/
+#ifndef INT_VECTOR_CONCURRENT_H_
+#define INT_VECTOR_CONCURRENT_H_
+
+/* Inkluderingsdirektiv: */
+#include <stdatomic.h> /* Innehller atomic_size_t med mera. */
+
+#include "int_vector.h"
+
+/********************************************************************************
+* INT_VECTOR_CONCURRENT_FIRST_BITS: Tvlogaritmen av antalet heltal som ryms
+*                                   i den frsta hinken.
+********************************************************************************/
+#ifndef INT_VECTOR_CONCURRENT_FIRST_BITS
+#define INT_VECTOR_CONCURRENT_FIRST_BITS 10
+#endif
+
+/********************************************************************************
+* INT_VECTOR_CONCURRENT_BUCKETS: Antalet hinkar, vilket rcker fr att
+*                                samtliga index som ryms i size_t ska kunna
+*                                adresseras.
+********************************************************************************/
+#define INT_VECTOR_CONCURRENT_BUCKETS \
+   (sizeof(size_t) * 8 - INT_VECTOR_CONCURRENT_FIRST_BITS)
+
+/********************************************************************************
+* INT_VECTOR_CONCURRENT_CACHE_LINE: Storleken p en cachelinje i byte, som
+*                                   storleken placeras ensam p s att
+*                                   skrivningar till denna inte tvingar ut
+*                                   hinkpekarna ur vriga krnors cacheminnen.
+********************************************************************************/
+#define INT_VECTOR_CONCURRENT_CACHE_LINE 64
+
+/********************************************************************************
+* int_vector_concurrent: Strukt fr en vektor som flera trdar kan lgga till
+*                        heltal i samtidigt. Strukten fr inte kopieras via
+*                        tilldelning.
+********************************************************************************/
+struct int_vector_concurrent
+{
+   atomic_size_t size; /* Antalet reserverade positioner. */
+   char padding[INT_VECTOR_CONCURRENT_CACHE_LINE - sizeof(atomic_size_t)];
+   atomic_uintptr_t buckets[INT_VECTOR_CONCURRENT_BUCKETS]; /* Hinkarnas adresser. */
+   atomic_int failed;  /* Indikerar ifall ngon hink inte kunde allokeras. */
+};
+
+/********************************************************************************
+* int_vector_concurrent_init: Initierar ny tom vektor. Ingen hink allokeras
+*                             frrn frsta heltalet lggs till.
+*
+*                             - self: Pekare till vektorn som ska initieras.
+********************************************************************************/
+void int_vector_concurrent_init(struct int_vector_concurrent* self);
+
+/********************************************************************************
+* int_vector_concurrent_clear: Frigr samtliga hinkar i angiven vektor och
+*                              nollstller dess storlek. Fr endast anropas
+*                              nr inga andra trdar anvnder vektorn.
+*
+*                              - self: Pekare till vektorn som ska tmmas.
+********************************************************************************/
+void int_vector_concurrent_clear(struct int_vector_concurrent* self);
+
+/********************************************************************************
+* int_vector_concurrent_size: Returnerar antalet reserverade positioner i
+*                             angiven vektor. Medan andra trdar lgger till
+*                             heltal kan positioner vara reserverade utan att
+*                             motsvarande heltal har skrivits nnu.
+*
+*                             - self: Pekare till vektorn.
+********************************************************************************/
+static inline size_t int_vector_concurrent_size(struct int_vector_concurrent* self)
+{
+   return atomic_load_explicit(&self->size, memory_order_relaxed);
+}
+
+/********************************************************************************
+* int_vector_concurrent_push: Lgger till ett heltal i angiven vektor. Kan
+*                             anropas frn flera trdar samtidigt. Vid lyckad
+*                             minnesallokering returneras 0. Annars returneras
+*                             felkod 1, varvid den reserverade positionen gr
+*                             frlorad och en efterfljande frysning
+*                             misslyckas.
+*
+*                             - self : Pekare till vektorn.
+*                             - value: Heltalet som ska lggas till.
+********************************************************************************/
+int int_vector_concurrent_push(struct int_vector_concurrent* self,
+                               const int value);
+
+/********************************************************************************
+* int_vector_concurrent_append: Lgger till angivet antal heltal frn angivet
+*                               flt i angiven vektor, dr samtliga positioner
+*                               reserveras via en enda atomisk operation s
+*                               att heltalen hamnar i fljd. Kan anropas frn
+*                               flera trdar samtidigt. Vid lyckad
+*                               minnesallokering returneras 0, annars
+*                               returneras felkod 1 enligt
+*                               int_vector_concurrent_push.
+*
+*                               - self : Pekare till vektorn.
+*                               - data : Pekare till fltet med heltalen.
+*                               - count: Antalet heltal som ska lggas till.
+********************************************************************************/
+int int_vector_concurrent_append(struct int_vector_concurrent* self,
+                                 const int* data,
+                                 const size_t count);
+
+/********************************************************************************
+* int_vector_concurrent_freeze: Flyttar samtliga heltal i angiven vektor till
+*                               angiven mlvektor, vars tidigare innehll
+*                               erstts, i den ordning positionerna
+*                               reserverades. Drefter tms den samtidiga
+*                               vektorn. Fr endast anropas nr samtliga
+*                               skrivande trdar r klara och deras
+*                               skrivningar r synliga fr anropande trd,
+*                               exempelvis efter pthread_join. Vid lyckad
+*                               frysning returneras 0. Om ngon pushoperation
+*                               har misslyckats eller om mlvektorn inte kan
+*                               allokeras returneras felkod 1, varvid
+*                               mlvektorn lmnas intakt.
+*
+*                               - self: Pekare till vektorn som ska frysas.
+*                               - dst : Pekare till mlvektorn.
+********************************************************************************/
+int int_vector_concurrent_freeze(struct int_vector_concurrent* self,
+                                 struct int_vector* dst);
+
+#endif /* INT_VECTOR_CONCURRENT_H_ */
\ No newline at end of file
@@ -0,0 +1,460 @@
+/********************************************************************************
+* int_vector_dump.c: Innehller definitioner av flertrdad utskrift av
+*                    mycket stora vektorer.
+********************************************************************************/
+#define _POSIX_C_SOURCE 200809L /* Krvs fr sysconf, pwrite, fseeko och ftello. */
+#include "int_vector_dump.h"
+#include "int_format.h"
+
+#include <errno.h>    /* Innehller errno och EINTR. */
+#include <fcntl.h>    /* Innehller fcntl och O_APPEND. */
+#include <pthread.h>  /* Innehller pthread_create och pthread_join. */
+#include <sys/stat.h> /* Innehller fstat och S_ISREG. */
+#include <unistd.h>   /* Innehller sysconf och pwrite. */
+
+/********************************************************************************
+* dump_task: Strukt fr en trds andel av en utskrift, dvs. ett segment av
+*            vektorn, trdens buffert samt, vid skrivning via pwrite,
+*            segmentets position i filen.
+********************************************************************************/
+struct dump_task
+{
+   const int* data; /* Pekare till vektorns heltal. */
+   size_t begin;    /* Index fr segmentets frsta heltal. */
+   size_t end;      /* Index efter segmentets sista heltal. */
+   char* buffer;    /* Trdens buffert fr en del. */
+   size_t length;   /* Antalet formaterade tecken. */
+   int fd;          /* Filens fildeskriptor vid skrivning via pwrite. */
+   off_t offset;    /* Segmentets position i filen vid skrivning via pwrite. */
+   int error;       /* Indikerar ifall ett skrivfel har uppsttt. */
+};
+
+/* Statiska variabler: */
+static size_t dump_threads = 0; /* Hgsta antal trdar, 0 = antalet krnor. */
+
+/********************************************************************************
+* format_task: Formaterar angiven trds segment, hgst en del, till trdens
+*              buffert. Anvnds som trdfunktion vid skrivning i tur och
+*              ordning.
+*
+*              - arg: Pekare till trdens dump_task.
+********************************************************************************/
+static void* format_task(void* arg)
+{
+   struct dump_task* self = (struct dump_task*)arg;
+   self->length = int_format_lines(self->buffer, self->data + self->begin,
+                                   self->end - self->begin);
+   return 0;
+}
+
+/********************************************************************************
+* length_task: Berknar antalet tecken som angiven trds segment upptar vid
+*              utskrift, utan att heltalen formateras. Anvnds som
+*              trdfunktion vid skrivning via pwrite.
+*
+*              - arg: Pekare till trdens dump_task.
+********************************************************************************/
+static void* length_task(void* arg)
+{
+   struct dump_task* self = (struct dump_task*)arg;
+   self->length = int_format_lines_length(self->data + self->begin,
+                                          self->end - self->begin);
+   return 0;
+}
+
+/********************************************************************************
+* write_at: Skriver angivna tecken i sin helhet till angiven position i
+*           angiven fil via pwrite. Vid lyckad skrivning returneras 0, annars
+*           felkod 1.
+*
+*           - fd    : Filens fildeskriptor.
+*           - s     : Pekare till tecknen som ska skrivas.
+*           - length: Antalet tecken som ska skrivas.
+*           - offset: Positionen i filen.
+********************************************************************************/
+static int write_at(const int fd,
+                    const char* s,
+                    size_t length,
+                    off_t offset)
+{
+   while (length > 0)
+   {
+      const ssize_t written = pwrite(fd, s, length, offset);
+
+      if (written < 0)
+      {
+         if (errno == EINTR) continue;
+         return 1;
+      }
+
+      s += written;
+      length -= (size_t)written;
+      offset += (off_t)written;
+   }
+
+   return 0;
+}
+
+/********************************************************************************
+* pwrite_task: Formaterar angiven trds segment en del i taget till trdens
+*              buffert och skriver varje del via pwrite p sin position i
+*              filen. Efter ett skrivfel avbryts segmentet. Anvnds som
+*              trdfunktion vid skrivning via pwrite.
+*
+*              - arg: Pekare till trdens dump_task.
+********************************************************************************/
+static void* pwrite_task(void* arg)
+{
+   struct dump_task* self = (struct dump_task*)arg;
+   off_t offset = self->offset;
+
+   for (size_t i = self->begin; i < self->end && !self->error; i += INT_VECTOR_DUMP_CHUNK)
+   {
+      const size_t count = self->end - i < INT_VECTOR_DUMP_CHUNK ? self->end - i : INT_VECTOR_DUMP_CHUNK;
+      const size_t length = int_format_lines(self->buffer, self->data + i, count);
+
+      self->error = write_at(self->fd, self->buffer, length, offset);
+      offset += (off_t)length;
+   }
+
+   return 0;
+}
+
+/********************************************************************************
+* start_tasks: Startar angiven trdfunktion fr samtliga uppgifter i nya
+*              trdar. Uppgifter vars trd inte kan skapas krs i stllet
+*              av join_tasks.
+*
+*              - tasks   : Pekare till fltet med uppgifter.
+*              - count   : Antalet uppgifter.
+*              - function: Trdfunktionen som ska kras.
+*              - threads : Pekare till flt fr trdarnas identiteter.
+*              - started : Pekare till flt som indikerar startade trdar.
+********************************************************************************/
+static void start_tasks(struct dump_task* tasks,
+                        const size_t count,
+                        void* (*function)(void*),
+                        pthread_t* threads,
+                        int* started)
+{
+   for (size_t i = 0; i < count; ++i)
+   {
+      started[i] = pthread_create(&threads[i], 0, function, &tasks[i]) == 0;
+   }
+
+   return;
+}
+
+/********************************************************************************
+* join_tasks: Vntar tills samtliga uppgifter som har startats via
+*             start_tasks r klara, dr uppgifter vars trd inte kunde
+*             skapas krs i anropande trd.
+*
+*             - tasks   : Pekare till fltet med uppgifter.
+*             - count   : Antalet uppgifter.
+*             - function: Trdfunktionen.
+*             - threads : Pekare till flt med trdarnas identiteter.
+*             - started : Pekare till flt som indikerar startade trdar.
+********************************************************************************/
+static void join_tasks(struct dump_task* tasks,
+                       const size_t count,
+                       void* (*function)(void*),
+                       pthread_t* threads,
+                       const int* started)
+{
+   for (size_t i = 0; i < count; ++i)
+   {
+      if (started[i]) pthread_join(threads[i], 0);
+      else function(&tasks[i]);
+   }
+
+   return;
+}
+
+/********************************************************************************
+* run_tasks: Kr angiven trdfunktion fr samtliga uppgifter, dr den frsta
+*            uppgiften krs i anropande trd och vriga i nya trdar.
+*
+*            - tasks   : Pekare till fltet med uppgifter.
+*            - count   : Antalet uppgifter.
+*            - function: Trdfunktionen som ska kras.
+*            - threads : Pekare till flt fr trdarnas identiteter.
+*            - started : Pekare till flt som indikerar startade trdar.
+********************************************************************************/
+static void run_tasks(struct dump_task* tasks,
+                      const size_t count,
+                      void* (*function)(void*),
+                      pthread_t* threads,
+                      int* started)
+{
+   start_tasks(tasks + 1, count - 1, function, threads + 1, started + 1);
+   function(&tasks[0]);
+   join_tasks(tasks + 1, count - 1, function, threads + 1, started + 1);
+   return;
+}
+
+/********************************************************************************
+* setup_round: Tilldelar angivna uppgifter en del var med brjan p angiven
+*              del och returnerar antalet uppgifter som fick en del.
+*
+*              - tasks : Pekare till omgngens uppgifter.
+*              - count : Antalet uppgifter i omgngen.
+*              - data  : Pekare till vektorns heltal.
+*              - size  : Antalet heltal i vektorn.
+*              - chunk : Index fr omgngens frsta del.
+********************************************************************************/
+static size_t setup_round(struct dump_task* tasks,
+                          const size_t count,
+                          const int* data,
+                          const size_t size,
+                          const size_t chunk)
+{
+   size_t used = 0;
+
+   while (used < count && (chunk + used) * INT_VECTOR_DUMP_CHUNK < size)
+   {
+      const size_t begin = (chunk + used) * INT_VECTOR_DUMP_CHUNK;
+      tasks[used].data = data;
+      tasks[used].begin = begin;
+      tasks[used].end = size - begin < INT_VECTOR_DUMP_CHUNK ? size : begin + INT_VECTOR_DUMP_CHUNK;
+      used++;
+   }
+
+   return used;
+}
+
+/********************************************************************************
+* print_ordered: Skriver ut angivna heltal via angiven utstrm i tur och
+*                ordning, en omgng om en del per trd i taget. Medan en
+*                omgng skrivs ut formaterar trdarna nsta omgng till den
+*                andra halvan av buffertarna. Vid lyckad utskrift returneras
+*                0, annars felkod 1.
+*
+*                - tasks  : Pekare till 2 * threads uppgifter med buffertar.
+*                - threads: Antalet trdar per omgng.
+*                - data   : Pekare till vektorns heltal.
+*                - size   : Antalet heltal i vektorn.
+*                - ids    : Pekare till flt fr 2 * threads identiteter.
+*                - started: Pekare till flt fr 2 * threads indikatorer.
+*                - ostream: Pekare till utstrmmen.
+********************************************************************************/
+static int print_ordered(struct dump_task* tasks,
+                         const size_t threads,
+                         const int* data,
+                         const size_t size,
+                         pthread_t* ids,
+                         int* started,
+                         FILE* ostream)
+{
+   static const char header[] = INT_FORMAT_SEPARATOR "\n";
+   static const char footer[] = INT_FORMAT_SEPARATOR "\n\n";
+   size_t chunk = 0;
+   size_t current = 0;
+   size_t used = setup_round(tasks, threads, data, size, chunk);
+   int status = fwrite(header, 1, sizeof(header) - 1, ostream) != sizeof(header) - 1;
+
+   start_tasks(tasks, used, format_task, ids, started);
+
+   while (used > 0)
+   {
+      struct dump_task* round = tasks + current * threads;
+      const size_t next = current ^ 1;
+      size_t next_used;
+
+      join_tasks(round, used, format_task, ids + current * threads, started + current * threads);
+      chunk += used;
+      next_used = status ? 0 : setup_round(tasks + next * threads, threads, data, size, chunk);
+      start_tasks(tasks + next * threads, next_used, format_task,
+                  ids + next * threads, started + next * threads);
+
+      for (size_t t = 0; t < used && !status; ++t)
+      {
+         status = fwrite(round[t].buffer, 1, round[t].length, ostream) != round[t].length;
+      }
+
+      current = next;
+      used = next_used;
+   }
+
+   if (!status) status = fwrite(footer, 1, sizeof(footer) - 1, ostream) != sizeof(footer) - 1;
+   return status;
+}
+
+/********************************************************************************
+* print_positioned: Skriver ut angivna heltal till angiven fil frn
+*                   utstrmmens aktuella position via pwrite. Antalet tecken
+*                   per trds segment berknas frst, varefter segmentens
+*                   positioner erhlls via en prefixsumma och trdarna
+*                   formaterar och skriver sina segment samtidigt. Drefter
+*                   flyttas utstrmmens position till utskriftens slut. Vid
+*                   lyckad utskrift returneras 0, annars felkod 1.
+*
+*                   - tasks  : Pekare till threads uppgifter med buffertar.
+*                   - threads: Antalet trdar.
+*                   - data   : Pekare till vektorns heltal.
+*                   - size   : Antalet heltal i vektorn.
+*                   - ids    : Pekare till flt fr threads identiteter.
+*                   - started: Pekare till flt fr threads indikatorer.
+*                   - ostream: Pekare till utstrmmen.
+*                   - fd     : Filens fildeskriptor.
+*                   - start  : Utstrmmens aktuella position.
+********************************************************************************/
+static int print_positioned(struct dump_task* tasks,
+                            const size_t threads,
+                            const int* data,
+                            const size_t size,
+                            pthread_t* ids,
+                            int* started,
+                            FILE* ostream,
+                            const int fd,
+                            const off_t start)
+{
+   static const char header[] = INT_FORMAT_SEPARATOR "\n";
+   static const char footer[] = INT_FORMAT_SEPARATOR "\n\n";
+   off_t offset = start + (off_t)(sizeof(header) - 1);
+   int status;
+
+   for (size_t t = 0; t < threads; ++t)
+   {
+      tasks[t].data = data;
+      tasks[t].begin = size / threads * t;
+      tasks[t].end = t + 1 < threads ? size / threads * (t + 1) : size;
+      tasks[t].fd = fd;
+      tasks[t].error = 0;
+   }
+
+   run_tasks(tasks, threads, length_task, ids, started);
+
+   for (size_t t = 0; t < threads; ++t)
+   {
+      tasks[t].offset = offset;
+      offset += (off_t)tasks[t].length;
+   }
+
+   status = write_at(fd, header, sizeof(header) - 1, start);
+   if (!status) run_tasks(tasks, threads, pwrite_task, ids, started);
+
+   for (size_t t = 0; t < threads; ++t)
+   {
+      if (tasks[t].error) status = 1;
+   }
+
+   if (!status) status = write_at(fd, footer, sizeof(footer) - 1, offset);
+   offset += (off_t)(sizeof(footer) - 1);
+   return fseeko(ostream, status ? start : offset, SEEK_SET) != 0 || status;
+}
+
+/********************************************************************************
+* positioned_start: Returnerar utstrmmens aktuella position om utskriften
+*                   kan ske via pwrite, dvs. om utstrmmen r en vanlig fil
+*                   som inte r ppnad fr tillgg, annars -1.
+*
+*                   - ostream: Pekare till utstrmmen.
+*                   - fd     : Utstrmmens fildeskriptor.
+********************************************************************************/
+static off_t positioned_start(FILE* ostream,
+                              const int fd)
+{
+   struct stat info;
+   const int flags = fd < 0 ? -1 : fcntl(fd, F_GETFL);
+
+   if (flags == -1 || (flags & O_APPEND)) return -1;
+   if (fstat(fd, &info) != 0 || !S_ISREG(info.st_mode)) return -1;
+   return ftello(ostream);
+}
+
+/********************************************************************************
+* int_vector_set_dump_threads: Stter det hgsta antalet trdar som anvnds
+*                              vid utskrift via int_vector_print_parallel.
+*
+*                              - threads: Det nya antalet trdar.
+********************************************************************************/
+void int_vector_set_dump_threads(const size_t threads)
+{
+   dump_threads = threads;
+   return;
+}
+
+/********************************************************************************
+* int_vector_dump_threads: Returnerar det hgsta antalet trdar som anvnds
+*                          vid utskrift via int_vector_print_parallel.
+********************************************************************************/
+size_t int_vector_dump_threads(void)
+{
+   if (dump_threads == 0)
+   {
+      const long cores = sysconf(_SC_NPROCESSORS_ONLN);
+      return cores > 0 ? (size_t)cores : 1;
+   }
+
+   return dump_threads;
+}
+
+/********************************************************************************
+* int_vector_print_parallel: Skriver ut heltalen i angiven vektor via angiven
+*                            utstrm med samma format som int_vector_print,
+*                            dr formateringen delas upp p flera trdar.
+*                            Antalet trdar begrnsas till antalet delar.
+*
+*                            - self   : Pekare till vektorn som ska skrivas ut.
+*                            - ostream: Pekare till utstrmmen (default = stdout).
+********************************************************************************/
+int int_vector_print_parallel(const struct int_vector* self,
+                              FILE* ostream)
+{
+   const size_t chunks = (self->size + INT_VECTOR_DUMP_CHUNK - 1) / INT_VECTOR_DUMP_CHUNK;
+   const size_t buffer_size = INT_VECTOR_DUMP_CHUNK * INT_FORMAT_MAX_LINE;
+   size_t threads = int_vector_dump_threads();
+   size_t count;
+   struct dump_task* tasks;
+   pthread_t* ids;
+   int* started;
+   char* memory;
+   off_t start;
+   int fd;
+   int status;
+
+   if (!ostream) ostream = stdout;
+   if (threads > chunks) threads = chunks;
+   if (threads < 2) return int_format_print(self->data, self->size, ostream, 0, 0);
+   if (fflush(ostream) != 0) return 1;
+
+   fd = fileno(ostream);
+   start = positioned_start(ostream, fd);
+   count = start >= 0 ? threads : 2 * threads;
+
+   tasks = (struct dump_task*)malloc(sizeof(struct dump_task) * count);
+   ids = (pthread_t*)malloc(sizeof(pthread_t) * count);
+   started = (int*)malloc(sizeof(int) * count);
+   memory = (char*)malloc(buffer_size * count);
+
+   if (!tasks || !ids || !started || !memory)
+   {
+      free(tasks);
+      free(ids);
+      free(started);
+      free(memory);
+      return 1;
+   }
+
+   for (size_t t = 0; t < count; ++t)
+   {
+      tasks[t].buffer = memory + buffer_size * t;
+   }
+
+   if (start >= 0)
+   {
+      status = print_positioned(tasks, threads, self->data, self->size,
+                                ids, started, ostream, fd, start);
+   }
+   else
+   {
+      status = print_ordered(tasks, threads, self->data, self->size, ids, started, ostream);
+   }
+
+   free(tasks);
+   free(ids);
+   free(started);
+   free(memory);
+   return status;
+}
\ No newline at end of file
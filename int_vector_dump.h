@@ -0,0 +1,74 @@
+/********************************************************************************
+* int_vector_dump.h: Innehller flertrdad utskrift av mycket stora vektorer.
+*
+*                    Vid utskrift via int_vector_print formateras samtliga
+*                    heltal av en enda trd, vilket begrnsar
+*                    genomstrmningen fr vektorer med miljarder heltal
+*                    lngt under diskens bandbredd. Via
+*                    int_vector_print_parallel delas vektorn i stllet upp
+*                    i delar om INT_VECTOR_DUMP_CHUNK heltal, som formateras
+*                    av flera trdar samtidigt. Utskriften blir byte fr
+*                    byte lika med int_vector_print, inklusive
+*                    avgrnsningsrader.
+*
+*                    Om utstrmmen r en vanlig fil berknas frst antalet
+*                    tecken per trds andel av vektorn utan formatering,
+*                    varefter varje trd formaterar sin andel och skriver
+*                    den direkt via pwrite p sin berknade position i
+*                    filen. vriga utstrmmar, exempelvis terminalen eller
+*                    en pipe, skrivs i tur och ordning, dr trdarna
+*                    formaterar nsta omgng delar medan fregende omgng
+*                    skrivs ut.
+********************************************************************************/
+#ifndef INT_VECTOR_DUMP_H_
+#define INT_VECTOR_DUMP_H_
+
+/* Inkluderingsdirektiv: */
+#include "int_vector.h"
+
+/********************************************************************************
+* INT_VECTOR_DUMP_CHUNK: Antalet heltal per del, som formateras till en egen
+*                        buffert om INT_VECTOR_DUMP_CHUNK * INT_FORMAT_MAX_LINE
+*                        byte. Vektorer med frre n tv delar skrivs ut av
+*                        en enda trd.
+********************************************************************************/
+#ifndef INT_VECTOR_DUMP_CHUNK
+#define INT_VECTOR_DUMP_CHUNK 65536
+#endif
+
+/********************************************************************************
+* int_vector_set_dump_threads: Stter det hgsta antalet trdar som anvnds
+*                              vid utskrift via int_vector_print_parallel,
+*                              dr 0 innebr antalet tillgngliga
+*                              processorkrnor (default).
+*
+*                              - threads: Det nya antalet trdar.
+********************************************************************************/
+void int_vector_set_dump_threads(const size_t threads);
+
+/********************************************************************************
+* int_vector_dump_threads: Returnerar det hgsta antalet trdar som anvnds
+*                          vid utskrift via int_vector_print_parallel, dr
+*                          0 har ersatts med antalet tillgngliga
+*                          processorkrnor.
+********************************************************************************/
+size_t int_vector_dump_threads(void);
+
+/********************************************************************************
+* int_vector_print_parallel: Skriver ut heltalen i angiven vektor via angiven
+*                            utstrm med samma format som int_vector_print,
+*                            dr formateringen delas upp p flera trdar.
+*                            Vid en vanlig fil skrivs utskriften frn
+*                            utstrmmens aktuella position, varefter
+*                            positionen flyttas till utskriftens slut. Vid
+*                            lyckad utskrift returneras 0. Om ett skrivfel
+*                            uppstr eller om minnesallokeringen fr
+*                            buffertarna misslyckas returneras felkod 1.
+*
+*                            - self   : Pekare till vektorn som ska skrivas ut.
+*                            - ostream: Pekare till utstrmmen (default = stdout).
+********************************************************************************/
+int int_vector_print_parallel(const struct int_vector* self,
+                              FILE* ostream);
+
+#endif /* INT_VECTOR_DUMP_H_ */
\ No newline at end of file
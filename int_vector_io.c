@@ -0,0 +1,746 @@
+/********************************************************************************
+* int_vector_io.c: Innehller definitioner av funktioner fr inlsning av
+*                  vektorer frn text samt fr det binra filformatet.
+********************************************************************************/
+#define _POSIX_C_SOURCE 200809L /* Krvs fr mmap, open med mera. */
+#include "int_vector_io.h"
+#include "int_format.h"
+
+#include <fcntl.h>    /* Innehller open. */
+#include <limits.h>   /* Innehller INT_MAX. */
+#include <stdint.h>   /* Innehller heltalstyper med fast storlek. */
+#include <string.h>   /* Innehller memchr, memcmp, memcpy och memmove. */
+#include <sys/mman.h> /* Innehller mmap och munmap. */
+#include <sys/stat.h> /* Innehller fstat. */
+#include <unistd.h>   /* Innehller close. */
+
+/********************************************************************************
+* INT_VECTOR_READER_BATCH: Antalet heltal som samlas innan de lggs till i
+*                          vektorn via ett anrop till int_vector_append.
+********************************************************************************/
+#define INT_VECTOR_READER_BATCH 4096
+
+/********************************************************************************
+* Storlekar och kontrollvrden fr det binra filformatet:
+*
+* - INT_VECTOR_FILE_HEADER  : Filhuvudets storlek i byte.
+* - INT_VECTOR_RECORD_HEADER: Storleken p varje posts huvud i byte.
+* - INT_VECTOR_BYTE_ORDER   : Vrde fr kontroll av byteordning.
+********************************************************************************/
+#define INT_VECTOR_FILE_HEADER   16
+#define INT_VECTOR_RECORD_HEADER 16
+#define INT_VECTOR_BYTE_ORDER    0x01020304u
+
+/********************************************************************************
+* last_newline: Returnerar adressen efter sista radbrytningen i angivet
+*               intervall. Om intervallet saknar radbrytning returneras null.
+*
+*               - begin: Adressen till intervallets frsta tecken.
+*               - end  : Adressen efter intervallets sista tecken.
+********************************************************************************/
+static const char* last_newline(const char* begin,
+                                const char* end)
+{
+   while (end > begin)
+   {
+      if (end[-1] == '\n') return end;
+      --end;
+   }
+
+   return 0;
+}
+
+/********************************************************************************
+* separator_end: Returnerar adressen efter angiven rad om raden utgr en
+*                avgrnsningsrad, annars returneras null. Raden mste
+*                avslutas med en radbrytning fre angiven grns.
+*
+*                - line : Adressen till radens frsta tecken.
+*                - limit: Adressen efter sista kompletta raden i bufferten.
+********************************************************************************/
+static const char* separator_end(const char* line,
+                                 const char* limit)
+{
+   static const char separator[] = INT_FORMAT_SEPARATOR;
+   const char* newline = (const char*)memchr(line, '\n', (size_t)(limit - line));
+   size_t length = (size_t)(newline - line);
+
+   if (length > 0 && line[length - 1] == '\r') length--;
+   if (length != sizeof(separator) - 1 || memcmp(line, separator, length)) return 0;
+   return newline + 1;
+}
+
+/********************************************************************************
+* reader_fill: Skerstller att minst en komplett rad finns tillgnglig frn
+*              lsarens aktuella position och returnerar adressen efter sista
+*              kompletta raden i bufferten. Vid behov flyttas terstende
+*              data till buffertens brjan, varefter bufferten fylls p frn
+*              instrmmen. En avslutande rad utan radbrytning kopieras till
+*              svansbufferten och kompletteras med en radbrytning, s att
+*              varje rad kan tolkas utan grnskontroller per tecken. En
+*              buffert som r mindre n INT_VECTOR_READER_BUFFER frdubblas
+*              fre varje pfyllning, s att antalet byte som lses in i
+*              frvg str i proportion till vektorns storlek.
+*
+*              Null returneras om indata har tagit slut eller om en rad inte
+*              ryms i bufferten, dr det senare fallet kan identifieras via
+*              att det finns data kvar.
+*
+*              - self: Pekare till lsaren.
+********************************************************************************/
+static const char* reader_fill(struct int_vector_reader* self)
+{
+   const char* limit = last_newline(self->pos, self->end);
+
+   while (!limit && !self->eof)
+   {
+      const size_t rest = (size_t)(self->end - self->pos);
+      size_t count;
+
+      if (self->capacity < INT_VECTOR_READER_BUFFER)
+      {
+         const size_t offset = (size_t)(self->pos - self->buffer);
+         const size_t capacity = self->capacity * 2 < INT_VECTOR_READER_BUFFER ?
+                                 self->capacity * 2 : INT_VECTOR_READER_BUFFER;
+         char* buffer = (char*)realloc(self->buffer, capacity);
+
+         if (buffer)
+         {
+            self->buffer = buffer;
+            self->capacity = capacity;
+            self->pos = buffer + offset;
+            self->end = self->pos + rest;
+         }
+      }
+
+      if (rest == self->capacity) return 0;
+
+      memmove(self->buffer, self->pos, rest);
+      count = fread(self->buffer + rest, 1, self->capacity - rest, self->istream);
+      self->pos = self->buffer;
+      self->end = self->buffer + rest + count;
+      if (count == 0) self->eof = 1;
+      limit = last_newline(self->buffer + rest, self->end);
+   }
+
+   if (!limit && self->pos < self->end && !self->in_tail)
+   {
+      const size_t rest = (size_t)(self->end - self->pos);
+      if (rest >= sizeof(self->tail)) return 0;
+
+      memcpy(self->tail, self->pos, rest);
+      self->tail[rest] = '\n';
+      self->pos = self->tail;
+      self->end = self->tail + rest + 1;
+      self->in_tail = 1;
+      limit = self->end;
+   }
+
+   return limit;
+}
+
+/********************************************************************************
+* reader_open: Initierar angiven lsare fr inlsning frn angiven instrm
+*              med en buffert av angiven storlek. Vid lyckad
+*              minnesallokering av bufferten returneras 0, annars felkod 1.
+*
+*              - self    : Pekare till lsaren som ska initieras.
+*              - istream : Pekare till instrmmen som ska lsas.
+*              - capacity: Buffertens ursprungliga storlek i byte.
+********************************************************************************/
+static int reader_open(struct int_vector_reader* self,
+                       FILE* istream,
+                       const size_t capacity)
+{
+   self->buffer = (char*)malloc(capacity);
+   if (!self->buffer) return 1;
+   self->capacity = capacity;
+   self->istream = istream;
+   self->pos = self->buffer;
+   self->end = self->buffer;
+   self->line = 1;
+   self->error_line = 0;
+   self->eof = 0;
+   self->in_tail = 0;
+   return 0;
+}
+
+/********************************************************************************
+* int_vector_reader_init: Initierar angiven lsare fr inlsning frn angiven
+*                         instrm. Vid lyckad minnesallokering av bufferten
+*                         returneras 0, annars felkod 1.
+*
+*                         - self   : Pekare till lsaren som ska initieras.
+*                         - istream: Pekare till instrmmen som ska lsas.
+********************************************************************************/
+int int_vector_reader_init(struct int_vector_reader* self,
+                           FILE* istream)
+{
+   return reader_open(self, istream, INT_VECTOR_READER_BUFFER);
+}
+
+/********************************************************************************
+* int_vector_reader_init_buffer: Initierar angiven lsare fr inlsning frn
+*                                angiven buffert i minnet, som inte kopieras
+*                                och drmed mste finnas kvar under
+*                                inlsningen.
+*
+*                                - self  : Pekare till lsaren.
+*                                - buffer: Pekare till bufferten med text.
+*                                - size  : Buffertens storlek i byte.
+********************************************************************************/
+void int_vector_reader_init_buffer(struct int_vector_reader* self,
+                                   const char* buffer,
+                                   const size_t size)
+{
+   self->istream = 0;
+   self->buffer = 0;
+   self->capacity = 0;
+   self->pos = buffer;
+   self->end = buffer + size;
+   self->line = 1;
+   self->error_line = 0;
+   self->eof = 1;
+   self->in_tail = 0;
+   return;
+}
+
+/********************************************************************************
+* int_vector_reader_clear: Frigr minne allokerat fr angiven lsare. Indata
+*                          som har lsts in till bufferten men nnu inte
+*                          tolkats gr frlorad.
+*
+*                          - self: Pekare till lsaren som ska tmmas.
+********************************************************************************/
+void int_vector_reader_clear(struct int_vector_reader* self)
+{
+   free(self->buffer);
+   self->buffer = 0;
+   self->pos = 0;
+   self->end = 0;
+   return;
+}
+
+/********************************************************************************
+* int_vector_reader_next: Lser in nsta vektor frn angiven lsare, dr
+*                         tidigare innehll i vektorn erstts. Tomma rader
+*                         mellan vektorerna ignoreras. Returnerar ngon av
+*                         returkoderna INT_VECTOR_LOAD_*. Vid felaktig indata
+*                         lagras radnumret fr felet i lsarens flt
+*                         error_line.
+*
+*                         Varje rad tolkas utan grnskontroller per tecken,
+*                         eftersom reader_fill garanterar att raden avslutas
+*                         med en radbrytning, som avbryter sifferloopen.
+*
+*                         - self  : Pekare till lsaren.
+*                         - vector: Pekare till vektorn som ska tilldelas.
+********************************************************************************/
+int int_vector_reader_next(struct int_vector_reader* self,
+                           struct int_vector* vector)
+{
+   int batch[INT_VECTOR_READER_BATCH];
+   size_t count = 0;
+   size_t line = self->line;
+   const char* p = self->pos;
+   const char* limit = p;
+
+   self->error_line = 0;
+   if (vector->borrowed) return INT_VECTOR_LOAD_ERROR;
+
+   for (;;)
+   {
+      if (p == limit)
+      {
+         self->pos = p;
+         limit = reader_fill(self);
+         p = self->pos;
+
+         if (!limit)
+         {
+            self->line = line;
+            if (p < self->end) break;
+            return self->istream && ferror(self->istream) ?
+               INT_VECTOR_LOAD_ERROR : INT_VECTOR_LOAD_END;
+         }
+      }
+
+      if (*p == '\n') p++;
+      else if (*p == '\r' && p[1] == '\n') p += 2;
+      else break;
+      line++;
+   }
+
+   if (!limit || !(p = separator_end(p, limit)))
+   {
+      self->error_line = self->line = line;
+      return INT_VECTOR_LOAD_SYNTAX;
+   }
+
+   line++;
+   int_vector_erase_range(vector, 0, vector->size);
+
+   for (;;)
+   {
+      int negative;
+      const char* digits;
+      const char* q;
+      unsigned long long value = 0;
+      unsigned digit;
+
+      if (p == limit)
+      {
+         self->pos = p;
+         limit = reader_fill(self);
+         p = self->pos;
+
+         if (!limit)
+         {
+            if (self->istream && ferror(self->istream))
+            {
+               self->line = line;
+               return INT_VECTOR_LOAD_ERROR;
+            }
+
+            break;
+         }
+      }
+
+      negative = *p == '-';
+      digits = p + negative;
+      q = digits;
+
+      while ((digit = (unsigned)(unsigned char)*q - '0') < 10)
+      {
+         value = value * 10 + digit;
+         ++q;
+      }
+
+      if (q == digits)
+      {
+         const char* next = negative ? separator_end(p, limit) : 0;
+         if (!next) break;
+         p = next;
+         line++;
+
+         if (count > 0 && int_vector_append(vector, batch, count))
+         {
+            self->pos = p;
+            self->line = line;
+            return INT_VECTOR_LOAD_ERROR;
+         }
+
+         self->pos = p;
+         self->line = line;
+         return INT_VECTOR_LOAD_OK;
+      }
+
+      /* Negativa tal fr vara hgst INT_MAX + 1, dvs. INT_MIN, och negeras
+         som long long, s att konverteringen till int alltid r exakt. */
+      if (q - digits > 10) break;
+      if (negative ? value > (unsigned long long)INT_MAX + 1 : value > (unsigned long long)INT_MAX) break;
+      if (*q == '\r') ++q;
+      if (*q != '\n') break;
+
+      batch[count++] = negative ? (int)-(long long)value : (int)value;
+      p = q + 1;
+      line++;
+
+      if (count == INT_VECTOR_READER_BATCH)
+      {
+         if (int_vector_append(vector, batch, count))
+         {
+            self->pos = p;
+            self->line = line;
+            return INT_VECTOR_LOAD_ERROR;
+         }
+
+         count = 0;
+      }
+   }
+
+   self->pos = p;
+   self->error_line = self->line = line;
+   return INT_VECTOR_LOAD_SYNTAX;
+}
+
+/********************************************************************************
+* int_vector_load: Lser in nsta vektor frn angiven instrm, dr tidigare
+*                  innehll i vektorn erstts. Data som lsts in i frvg
+*                  efter vektorn spolas tillbaka via fseek, s att nsta
+*                  anrop fortstter med efterfljande vektor. Om fseek
+*                  misslyckas, exempelvis fr ett rr, returneras
+*                  INT_VECTOR_LOAD_ERROR. Returnerar ngon av
+*                  returkoderna INT_VECTOR_LOAD_*.
+*
+*                  - self      : Pekare till vektorn som ska tilldelas.
+*                  - istream   : Pekare till instrmmen som ska lsas.
+*                  - error_line: Pekare till variabel som tilldelas radnumret
+*                                vid felaktig indata (eller null).
+********************************************************************************/
+int int_vector_load(struct int_vector* self,
+                    FILE* istream,
+                    size_t* error_line)
+{
+   struct int_vector_reader reader;
+   int status;
+
+   if (reader_open(&reader, istream, INT_VECTOR_LOAD_BUFFER)) return INT_VECTOR_LOAD_ERROR;
+   status = int_vector_reader_next(&reader, self);
+   if (error_line) *error_line = reader.error_line;
+
+   /* Tomma rader efter vektorn ignoreras nd av nsta anrop och behver
+      drmed inte spolas tillbaka. vrig data som inte kan spolas tillbaka
+      skulle dremot tyst g frlorad, varvid nsta anrop felaktigt skulle
+      rapportera slut p indata. */
+   while (reader.pos < reader.end && *reader.pos == '\n') reader.pos++;
+
+   if (status == INT_VECTOR_LOAD_OK && !reader.in_tail && reader.end > reader.pos &&
+       fseek(istream, -(long)(reader.end - reader.pos), SEEK_CUR))
+   {
+      status = INT_VECTOR_LOAD_ERROR;
+   }
+
+   int_vector_reader_clear(&reader);
+   return status;
+}
+
+/********************************************************************************
+* int_vector_load_buffer: Lser in frsta vektorn frn angiven buffert i
+*                         minnet, dr tidigare innehll i vektorn erstts.
+*                         Returnerar ngon av returkoderna INT_VECTOR_LOAD_*.
+*
+*                         - self      : Pekare till vektorn som ska tilldelas.
+*                         - buffer    : Pekare till bufferten med text.
+*                         - size      : Buffertens storlek i byte.
+*                         - error_line: Pekare till variabel som tilldelas
+*                                       radnumret vid felaktig indata
+*                                       (eller null).
+********************************************************************************/
+int int_vector_load_buffer(struct int_vector* self,
+                           const char* buffer,
+                           const size_t size,
+                           size_t* error_line)
+{
+   struct int_vector_reader reader;
+   int status;
+
+   int_vector_reader_init_buffer(&reader, buffer, size);
+   status = int_vector_reader_next(&reader, self);
+   if (error_line) *error_line = reader.error_line;
+   return status;
+}
+
+/********************************************************************************
+* is_little_endian: Indikerar ifall aktuell plattform lagrar heltal i little
+*                   endian, vilket krvs fr minnesmappning utan kopiering.
+********************************************************************************/
+static int is_little_endian(void)
+{
+   const uint32_t probe = 1;
+   return *(const unsigned char*)&probe == 1;
+}
+
+/********************************************************************************
+* store_u32: Lagrar angivet 32-bitars tal i little endian p angiven adress.
+*
+*            - s  : Adressen som talet ska lagras p.
+*            - num: Talet som ska lagras.
+********************************************************************************/
+static void store_u32(unsigned char* s,
+                      const uint32_t num)
+{
+   for (int i = 0; i < 4; ++i) s[i] = (unsigned char)(num >> (8 * i));
+   return;
+}
+
+/********************************************************************************
+* store_u64: Lagrar angivet 64-bitars tal i little endian p angiven adress.
+*
+*            - s  : Adressen som talet ska lagras p.
+*            - num: Talet som ska lagras.
+********************************************************************************/
+static void store_u64(unsigned char* s,
+                      const uint64_t num)
+{
+   for (int i = 0; i < 8; ++i) s[i] = (unsigned char)(num >> (8 * i));
+   return;
+}
+
+/********************************************************************************
+* load_u32: Returnerar 32-bitars talet lagrat i little endian p angiven adress.
+*
+*           - s: Adressen som talet r lagrat p.
+********************************************************************************/
+static uint32_t load_u32(const unsigned char* s)
+{
+   uint32_t num = 0;
+   for (int i = 3; i >= 0; --i) num = (num << 8) | s[i];
+   return num;
+}
+
+/********************************************************************************
+* load_u64: Returnerar 64-bitars talet lagrat i little endian p angiven adress.
+*
+*           - s: Adressen som talet r lagrat p.
+********************************************************************************/
+static uint64_t load_u64(const unsigned char* s)
+{
+   uint64_t num = 0;
+   for (int i = 7; i >= 0; --i) num = (num << 8) | s[i];
+   return num;
+}
+
+/********************************************************************************
+* checksum: Returnerar kontrollsumman fr angivna heltal, berknad enligt
+*           Fletchers algoritm ver 32-bitars ord. Summan beror endast p
+*           heltalens vrden och drmed inte p plattformens byteordning.
+*
+*           - data: Pekare till fltet med heltal.
+*           - size: Antalet heltal.
+********************************************************************************/
+static uint64_t checksum(const int* data,
+                         const size_t size)
+{
+   uint32_t sum1 = 0, sum2 = 0;
+
+   for (size_t i = 0; i < size; ++i)
+   {
+      sum1 += (uint32_t)data[i];
+      sum2 += sum1;
+   }
+
+   return ((uint64_t)sum2 << 32) | sum1;
+}
+
+/********************************************************************************
+* padded_bytes: Returnerar antalet byte som angivet antal heltal upptar i det
+*               binra filformatet, utfyllt till en multipel av 8 byte.
+*
+*               - size: Antalet heltal.
+********************************************************************************/
+static inline uint64_t padded_bytes(const uint64_t size)
+{
+   return (size * 4 + 7) & ~(uint64_t)7;
+}
+
+/********************************************************************************
+* record_at: Returnerar offset i byte till posten p angivet index i angiven
+*            mappning genom att g igenom posterna frn brjan.
+*
+*            - self : Pekare till mappningen.
+*            - index: Postens index.
+********************************************************************************/
+static size_t record_at(const struct int_vector_mapping* self,
+                        const size_t index)
+{
+   size_t offset = INT_VECTOR_FILE_HEADER;
+
+   for (size_t i = 0; i < index; ++i)
+   {
+      offset += INT_VECTOR_RECORD_HEADER + (size_t)padded_bytes(load_u64(self->address + offset));
+   }
+
+   return offset;
+}
+
+/********************************************************************************
+* int_vector_save_binary: Skriver angivna vektorer till angiven utstrm i det
+*                         binra filformatet. Vid lyckad skrivning returneras
+*                         0, annars felkod 1.
+*
+*                         - vectors: Pekare till fltet med vektorer.
+*                         - count  : Antalet vektorer som ska skrivas.
+*                         - ostream: Pekare till utstrmmen, som br vara
+*                                    ppnad i binrt lge ("wb").
+********************************************************************************/
+int int_vector_save_binary(const struct int_vector* vectors,
+                           const size_t count,
+                           FILE* ostream)
+{
+   static const unsigned char padding[8] = { 0 };
+   unsigned char header[INT_VECTOR_FILE_HEADER];
+   if (count > UINT32_MAX) return 1;
+
+   memcpy(header, "IVEC", 4);
+   store_u32(header + 4, INT_VECTOR_BINARY_VERSION);
+   store_u32(header + 8, INT_VECTOR_BYTE_ORDER);
+   store_u32(header + 12, (uint32_t)count);
+   if (fwrite(header, 1, sizeof(header), ostream) != sizeof(header)) return 1;
+
+   for (size_t i = 0; i < count; ++i)
+   {
+      const struct int_vector* v = vectors + i;
+      unsigned char record[INT_VECTOR_RECORD_HEADER];
+      const size_t pad = (size_t)(padded_bytes(v->size) - (uint64_t)v->size * 4);
+
+      store_u64(record, v->size);
+      store_u64(record + 8, checksum(v->data, v->size));
+      if (fwrite(record, 1, sizeof(record), ostream) != sizeof(record)) return 1;
+
+      if (is_little_endian())
+      {
+         if (v->size > 0 && fwrite(v->data, sizeof(int), v->size, ostream) != v->size) return 1;
+      }
+      else
+      {
+         unsigned char buffer[4096];
+
+         for (size_t j = 0; j < v->size; j += sizeof(buffer) / 4)
+         {
+            const size_t n = v->size - j < sizeof(buffer) / 4 ? v->size - j : sizeof(buffer) / 4;
+            for (size_t k = 0; k < n; ++k) store_u32(buffer + 4 * k, (uint32_t)v->data[j + k]);
+            if (fwrite(buffer, 4, n, ostream) != n) return 1;
+         }
+      }
+
+      if (pad > 0 && fwrite(padding, 1, pad, ostream) != pad) return 1;
+   }
+
+   return 0;
+}
+
+/********************************************************************************
+* int_vector_open_mapped: Minnesmappar angiven binr fil fr lsning.
+*                         Filhuvudet samt samtliga posters storlek kontrolleras,
+*                         men inte kontrollsummorna, s att ppningen gr fort
+*                         ven fr stora filer, se int_vector_mapping_verify.
+*                         Ingen data kopieras och inget minne allokeras p
+*                         heapen. Stds endast p plattformar med little endian.
+*                         Vid lyckad mappning returneras 0, annars felkod 1.
+*
+*                         - self: Pekare till mappningen som ska initieras.
+*                         - path: Skvgen till filen som ska ppnas.
+********************************************************************************/
+int int_vector_open_mapped(struct int_vector_mapping* self,
+                           const char* path)
+{
+   struct stat info;
+   void* address;
+   size_t offset = INT_VECTOR_FILE_HEADER;
+   const int fd = open(path, O_RDONLY);
+
+   self->address = 0;
+   self->length = 0;
+   self->count = 0;
+
+   if (fd < 0) return 1;
+
+   if (!is_little_endian() || fstat(fd, &info) || info.st_size < INT_VECTOR_FILE_HEADER ||
+       (uint64_t)info.st_size > SIZE_MAX)
+   {
+      close(fd);
+      return 1;
+   }
+
+   address = mmap(0, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+   close(fd);
+   if (address == MAP_FAILED) return 1;
+
+   self->address = (const unsigned char*)address;
+   self->length = (size_t)info.st_size;
+
+   if (memcmp(self->address, "IVEC", 4) ||
+       load_u32(self->address + 4) != INT_VECTOR_BINARY_VERSION ||
+       load_u32(self->address + 8) != INT_VECTOR_BYTE_ORDER)
+   {
+      int_vector_close_mapped(self);
+      return 1;
+   }
+
+   self->count = load_u32(self->address + 12);
+
+   for (size_t i = 0; i < self->count; ++i)
+   {
+      uint64_t size;
+
+      if (self->length - offset < INT_VECTOR_RECORD_HEADER)
+      {
+         int_vector_close_mapped(self);
+         return 1;
+      }
+
+      size = load_u64(self->address + offset);
+      offset += INT_VECTOR_RECORD_HEADER;
+
+      if (size > (self->length - offset) / 4 || padded_bytes(size) > self->length - offset)
+      {
+         int_vector_close_mapped(self);
+         return 1;
+      }
+
+      offset += (size_t)padded_bytes(size);
+   }
+
+   return 0;
+}
+
+/********************************************************************************
+* int_vector_mapping_get: Tilldelar angiven vektor den vektor som lagras p
+*                         angivet index i mappningen. Vektorns data pekar
+*                         direkt in i mappningen och utgr lnat minne, som
+*                         endast fr lsas och som blir ogiltigt nr
+*                         mappningen stngs. Posterna gs igenom frn brjan,
+*                         vilket ger linjr tid i index. Vid lyckad hmtning
+*                         returneras 0, annars felkod 1.
+*
+*                         - self  : Pekare till mappningen.
+*                         - index : Vektorns index i filen.
+*                         - vector: Pekare till vektorn som ska tilldelas.
+********************************************************************************/
+int int_vector_mapping_get(const struct int_vector_mapping* self,
+                           const size_t index,
+                           struct int_vector* vector)
+{
+   size_t offset;
+   if (index >= self->count) return 1;
+
+   offset = record_at(self, index);
+   int_vector_init(vector);
+   vector->size = (size_t)load_u64(self->address + offset);
+   if (vector->size > 0)
+   {
+      vector->data = (int*)(self->address + offset + INT_VECTOR_RECORD_HEADER);
+      vector->borrowed = 1;
+      vector->capacity = 0;
+   }
+   return 0;
+}
+
+/********************************************************************************
+* int_vector_mapping_verify: Kontrollerar kontrollsummorna fr samtliga
+*                            vektorer i angiven mappning. Om samtliga
+*                            kontrollsummor stmmer returneras 0, annars
+*                            felkod 1.
+*
+*                            - self: Pekare till mappningen.
+********************************************************************************/
+int int_vector_mapping_verify(const struct int_vector_mapping* self)
+{
+   size_t offset = INT_VECTOR_FILE_HEADER;
+
+   for (size_t i = 0; i < self->count; ++i)
+   {
+      const uint64_t size = load_u64(self->address + offset);
+      const int* data = (const int*)(self->address + offset + INT_VECTOR_RECORD_HEADER);
+      if (checksum(data, (size_t)size) != load_u64(self->address + offset + 8)) return 1;
+      offset += INT_VECTOR_RECORD_HEADER + (size_t)padded_bytes(size);
+   }
+
+   return 0;
+}
+
+/********************************************************************************
+* int_vector_close_mapped: Stnger angiven mappning, varefter vektorer
+*                          hmtade frn mappningen inte lngre fr anvndas.
+*
+*                          - self: Pekare till mappningen som ska stngas.
+********************************************************************************/
+void int_vector_close_mapped(struct int_vector_mapping* self)
+{
+   if (self->address) munmap((void*)self->address, self->length);
+   self->address = 0;
+   self->length = 0;
+   self->count = 0;
+   return;
+}
\ No newline at end of file
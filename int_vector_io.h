@@ -0,0 +1,256 @@
+/********************************************************************************
+* int_vector_io.h: Innehller funktionalitet fr inlsning av vektorer frn
+*                  text i det format som int_vector_print skriver ut, dvs.
+*                  ett heltal per rad omgivet av avgrnsningsrader. Flera
+*                  vektorer kan lsas in efter varandra frn samma instrm.
+*
+*                  Indata lses blockvis till en buffert av fast storlek och
+*                  heltalen samlas i omgngar innan de lggs till i vektorn,
+*                  vilket innebr att godtyckligt stora filer kan lsas in
+*                  med konstant extra minne utver vektorn sjlv.
+*
+*                  Dessutom finns ett kompakt binrt filformat, som kan
+*                  minnesmappas s att vektorernas data pekar direkt in i
+*                  filen utan kopiering. Filformatet bestr av ett filhuvud
+*                  fljt av en post per vektor, dr samtliga flt lagras
+*                  i little endian:
+*
+*                  Filhuvud (16 byte):
+*                  - magic       : Tecknen "IVEC".
+*                  - version     : Formatets version (INT_VECTOR_BINARY_VERSION).
+*                  - byte_order  : Vrdet 0x01020304 fr kontroll av byteordning.
+*                  - vector_count: Antalet vektorer i filen.
+*
+*                  Post per vektor (16 byte + data):
+*                  - size    : Antalet heltal i vektorn (64 bitar).
+*                  - checksum: Kontrollsumma fr vektorns data (64 bitar).
+*                  - data    : Heltalen som 32-bitars heltal, utfyllda med
+*                              nollor till en multipel av 8 byte.
+********************************************************************************/
+#ifndef INT_VECTOR_IO_H_
+#define INT_VECTOR_IO_H_
+
+/* Inkluderingsdirektiv: */
+#include "int_vector.h"
+
+/********************************************************************************
+* INT_VECTOR_READER_BUFFER: Strsta storlek i byte p bufferten som indata
+*                           lses in till vid inlsning frn en instrm.
+********************************************************************************/
+#ifndef INT_VECTOR_READER_BUFFER
+#define INT_VECTOR_READER_BUFFER 1048576
+#endif
+
+/********************************************************************************
+* INT_VECTOR_LOAD_BUFFER: Ursprunglig storlek i byte p bufferten vid
+*                         inlsning via int_vector_load. Bufferten frdubblas
+*                         vid varje pfyllning upp till
+*                         INT_VECTOR_READER_BUFFER, s att sm vektorer inte
+*                         lses in och spolas tillbaka i block om 1 MiB,
+*                         medan stora vektorer fortfarande lses i stora block.
+********************************************************************************/
+#ifndef INT_VECTOR_LOAD_BUFFER
+#define INT_VECTOR_LOAD_BUFFER 4096
+#endif
+
+/********************************************************************************
+* Returkoder vid inlsning av vektorer:
+*
+* - INT_VECTOR_LOAD_OK    : En vektor lstes in.
+* - INT_VECTOR_LOAD_END   : Indata tog slut innan ytterligare en vektor hittades.
+* - INT_VECTOR_LOAD_SYNTAX: Felaktig indata, dr radnumret fr felet anges.
+* - INT_VECTOR_LOAD_ERROR : Lsfel eller misslyckad minnesallokering.
+********************************************************************************/
+#define INT_VECTOR_LOAD_OK     0
+#define INT_VECTOR_LOAD_END    1
+#define INT_VECTOR_LOAD_SYNTAX 2
+#define INT_VECTOR_LOAD_ERROR  3
+
+/********************************************************************************
+* INT_VECTOR_BINARY_VERSION: Aktuell version av det binra filformatet.
+********************************************************************************/
+#define INT_VECTOR_BINARY_VERSION 1
+
+/********************************************************************************
+* int_vector_reader: Strukt fr inlsning av en eller flera vektorer efter
+*                    varandra, antingen frn en instrm eller frn minnet.
+********************************************************************************/
+struct int_vector_reader
+{
+   FILE* istream;     /* Instrm som lses blockvis, null vid lsning frn minnet. */
+   char* buffer;      /* Buffert fr inlst data, null vid lsning frn minnet. */
+   size_t capacity;   /* Buffertens storlek i byte. */
+   const char* pos;   /* Adressen till nsta tecken som ska tolkas. */
+   const char* end;   /* Adressen efter sista tillgngliga tecknet. */
+   size_t line;       /* Radnumret fr nsta rad som ska tolkas (1 - N). */
+   size_t error_line; /* Radnumret fr senaste felaktiga rad, annars 0. */
+   int eof;           /* Indikerar att all indata har lsts in. */
+   int in_tail;       /* Indikerar att sista raden tolkas frn svansbufferten. */
+   char tail[128];    /* Svansbuffert fr en avslutande rad utan radbrytning. */
+};
+
+/********************************************************************************
+* int_vector_mapping: Strukt fr en minnesmappad binr fil innehllande en
+*                     eller flera vektorer.
+********************************************************************************/
+struct int_vector_mapping
+{
+   const unsigned char* address; /* Adressen till den mappade filen. */
+   size_t length;                /* Den mappade filens storlek i byte. */
+   size_t count;                 /* Antalet vektorer i filen. */
+};
+
+/********************************************************************************
+* int_vector_reader_init: Initierar angiven lsare fr inlsning frn angiven
+*                         instrm. Vid lyckad minnesallokering av bufferten
+*                         returneras 0, annars felkod 1.
+*
+*                         - self   : Pekare till lsaren som ska initieras.
+*                         - istream: Pekare till instrmmen som ska lsas.
+********************************************************************************/
+int int_vector_reader_init(struct int_vector_reader* self,
+                           FILE* istream);
+
+/********************************************************************************
+* int_vector_reader_init_buffer: Initierar angiven lsare fr inlsning frn
+*                                angiven buffert i minnet, som inte kopieras
+*                                och drmed mste finnas kvar under
+*                                inlsningen.
+*
+*                                - self  : Pekare till lsaren.
+*                                - buffer: Pekare till bufferten med text.
+*                                - size  : Buffertens storlek i byte.
+********************************************************************************/
+void int_vector_reader_init_buffer(struct int_vector_reader* self,
+                                   const char* buffer,
+                                   const size_t size);
+
+/********************************************************************************
+* int_vector_reader_clear: Frigr minne allokerat fr angiven lsare. Indata
+*                          som har lsts in till bufferten men nnu inte
+*                          tolkats gr frlorad.
+*
+*                          - self: Pekare till lsaren som ska tmmas.
+********************************************************************************/
+void int_vector_reader_clear(struct int_vector_reader* self);
+
+/********************************************************************************
+* int_vector_reader_next: Lser in nsta vektor frn angiven lsare, dr
+*                         tidigare innehll i vektorn erstts. Tomma rader
+*                         mellan vektorerna ignoreras. Returnerar ngon av
+*                         returkoderna INT_VECTOR_LOAD_*. Vid felaktig indata
+*                         lagras radnumret fr felet i lsarens flt
+*                         error_line.
+*
+*                         - self  : Pekare till lsaren.
+*                         - vector: Pekare till vektorn som ska tilldelas.
+********************************************************************************/
+int int_vector_reader_next(struct int_vector_reader* self,
+                           struct int_vector* vector);
+
+/********************************************************************************
+* int_vector_load: Lser in nsta vektor frn angiven instrm, dr tidigare
+*                  innehll i vektorn erstts. Data som lsts in i frvg
+*                  efter vektorn spolas tillbaka via fseek, s att nsta
+*                  anrop fortstter med efterfljande vektor. Om instrmmen
+*                  inte stder fseek, exempelvis ett rr, och data har lsts
+*                  in efter vektorn returneras INT_VECTOR_LOAD_ERROR,
+*                  eftersom efterfljande vektorer annars skulle g
+*                  frlorade. Fr sdana instrmmar br i stllet en
+*                  int_vector_reader anvndas. Returnerar ngon av
+*                  returkoderna INT_VECTOR_LOAD_*.
+*
+*                  - self      : Pekare till vektorn som ska tilldelas.
+*                  - istream   : Pekare till instrmmen som ska lsas.
+*                  - error_line: Pekare till variabel som tilldelas radnumret
+*                                vid felaktig indata (eller null).
+********************************************************************************/
+int int_vector_load(struct int_vector* self,
+                    FILE* istream,
+                    size_t* error_line);
+
+/********************************************************************************
+* int_vector_load_buffer: Lser in frsta vektorn frn angiven buffert i
+*                         minnet, dr tidigare innehll i vektorn erstts.
+*                         Returnerar ngon av returkoderna INT_VECTOR_LOAD_*.
+*
+*                         - self      : Pekare till vektorn som ska tilldelas.
+*                         - buffer    : Pekare till bufferten med text.
+*                         - size      : Buffertens storlek i byte.
+*                         - error_line: Pekare till variabel som tilldelas
+*                                       radnumret vid felaktig indata
+*                                       (eller null).
+********************************************************************************/
+int int_vector_load_buffer(struct int_vector* self,
+                           const char* buffer,
+                           const size_t size,
+                           size_t* error_line);
+
+/********************************************************************************
+* int_vector_save_binary: Skriver angivna vektorer till angiven utstrm i det
+*                         binra filformatet. Vid lyckad skrivning returneras
+*                         0, annars felkod 1.
+*
+*                         - vectors: Pekare till fltet med vektorer.
+*                         - count  : Antalet vektorer som ska skrivas.
+*                         - ostream: Pekare till utstrmmen, som br vara
+*                                    ppnad i binrt lge ("wb").
+********************************************************************************/
+int int_vector_save_binary(const struct int_vector* vectors,
+                           const size_t count,
+                           FILE* ostream);
+
+/********************************************************************************
+* int_vector_open_mapped: Minnesmappar angiven binr fil fr lsning.
+*                         Filhuvudet samt samtliga posters storlek kontrolleras,
+*                         men inte kontrollsummorna, s att ppningen gr fort
+*                         ven fr stora filer, se int_vector_mapping_verify.
+*                         Ingen data kopieras och inget minne allokeras p
+*                         heapen. Stds endast p plattformar med little endian.
+*                         Vid lyckad mappning returneras 0, annars felkod 1.
+*
+*                         - self: Pekare till mappningen som ska initieras.
+*                         - path: Skvgen till filen som ska ppnas.
+********************************************************************************/
+int int_vector_open_mapped(struct int_vector_mapping* self,
+                           const char* path);
+
+/********************************************************************************
+* int_vector_mapping_get: Tilldelar angiven vektor den vektor som lagras p
+*                         angivet index i mappningen. Vektorns data pekar
+*                         direkt in i mappningen och utgr lnat minne, som
+*                         endast fr lsas och som blir ogiltigt nr
+*                         mappningen stngs. Vektorn markeras som lnad, se
+*                         int_vector_is_borrowed, s att funktioner som
+*                         ndrar den returnerar felkod 1 tills den slpps via
+*                         int_vector_clear. Posterna gs igenom frn brjan,
+*                         vilket ger linjr tid i index. Vid lyckad hmtning
+*                         returneras 0, annars felkod 1.
+*
+*                         - self  : Pekare till mappningen.
+*                         - index : Vektorns index i filen.
+*                         - vector: Pekare till vektorn som ska tilldelas.
+********************************************************************************/
+int int_vector_mapping_get(const struct int_vector_mapping* self,
+                           const size_t index,
+                           struct int_vector* vector);
+
+/********************************************************************************
+* int_vector_mapping_verify: Kontrollerar kontrollsummorna fr samtliga
+*                            vektorer i angiven mappning. Om samtliga
+*                            kontrollsummor stmmer returneras 0, annars
+*                            felkod 1.
+*
+*                            - self: Pekare till mappningen.
+********************************************************************************/
+int int_vector_mapping_verify(const struct int_vector_mapping* self);
+
+/********************************************************************************
+* int_vector_close_mapped: Stnger angiven mappning, varefter vektorer
+*                          hmtade frn mappningen inte lngre fr anvndas.
+*
+*                          - self: Pekare till mappningen som ska stngas.
+********************************************************************************/
+void int_vector_close_mapped(struct int_vector_mapping* self);
+
+#endif /* INT_VECTOR_IO_H_ */
\ No newline at end of file
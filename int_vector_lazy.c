@@ -0,0 +1,369 @@
+/********************************************************************************
+* int_vector_lazy.c: Innehller definitioner av associerade funktioner fr
+*                    strukten int_vector_lazy.
+********************************************************************************/
+#include "int_vector_lazy.h"
+#include "int_format.h"
+
+#include <limits.h> /* Innehller INT_MIN, INT_MAX och UINT_MAX. */
+#include <stdint.h> /* Innehller SIZE_MAX. */
+
+/********************************************************************************
+* floor_div: Returnerar kvoten av angivna tal avrundad nedt.
+*
+*            - a: Tljaren.
+*            - b: Nmnaren, som mste verstiga 0.
+********************************************************************************/
+static inline long long floor_div(const long long a,
+                                  const long long b)
+{
+   return a >= 0 ? a / b : -((-a + b - 1) / b);
+}
+
+/********************************************************************************
+* progression_wraps: Indikerar ifall talfljden i angiven lat vektor slr ver,
+*                    dvs. om ngot element inte ryms i en int utan
+*                    tvkomplementsomslag. D berknas summa, min/max,
+*                    rkning och skning genom att talfljden genomlps.
+*
+*                    - self: Pekare till den lata vektorn.
+********************************************************************************/
+static int progression_wraps(const struct int_vector_lazy* self)
+{
+   const long long step = self->step < 0 ? -(long long)self->step : self->step;
+   long long last;
+
+   if (self->size <= 1 || step == 0) return 0;
+   if (self->size - 1 > (size_t)UINT_MAX / (size_t)step) return 1;
+
+   last = (long long)self->start + (long long)(self->size - 1) * self->step;
+   return last < INT_MIN || last > INT_MAX;
+}
+
+/********************************************************************************
+* int_vector_lazy_assign: Tilldelar angiven vektor en aritmetisk talfljd.
+*
+*                         - self     : Pekare till vektorn som ska tilldelas.
+*                         - size     : Talfljdens lngd.
+*                         - start_val: Startvrde fr talfljden.
+*                         - step_val : Stegvrde fr talfljden.
+********************************************************************************/
+void int_vector_lazy_assign(struct int_vector_lazy* self,
+                            const size_t size,
+                            const int start_val,
+                            const int step_val)
+{
+   int_vector_clear(&self->vector);
+   self->size = size;
+   self->start = start_val;
+   self->step = step_val;
+   self->lazy = 1;
+   return;
+}
+
+/********************************************************************************
+* int_vector_lazy_materialize: Skriver talfljden i angiven vektor till dess
+*                              int_vector via int_vector_assign.
+*
+*                              - self: Pekare till vektorn.
+********************************************************************************/
+int int_vector_lazy_materialize(struct int_vector_lazy* self)
+{
+   if (!self->lazy) return 0;
+   if (int_vector_resize(&self->vector, self->size)) return 1;
+   int_vector_assign(&self->vector, self->start, self->step);
+   self->lazy = 0;
+   return 0;
+}
+
+/********************************************************************************
+* int_vector_lazy_vector: Returnerar en pekare till angiven vektors element
+*                         som en int_vector efter materialisering.
+*
+*                         - self: Pekare till vektorn.
+********************************************************************************/
+struct int_vector* int_vector_lazy_vector(struct int_vector_lazy* self)
+{
+   return int_vector_lazy_materialize(self) ? 0 : &self->vector;
+}
+
+/********************************************************************************
+* int_vector_lazy_set: Tilldelar elementet p angivet index angivet vrde.
+*
+*                      - self : Pekare till vektorn.
+*                      - index: Elementets index.
+*                      - value: Elementets nya vrde.
+********************************************************************************/
+int int_vector_lazy_set(struct int_vector_lazy* self,
+                        const size_t index,
+                        const int value)
+{
+   if (index >= int_vector_lazy_size(self)) return 1;
+   if (self->lazy && int_vector_lazy_at(self, index) == value) return 0;
+   if (int_vector_lazy_materialize(self)) return 1;
+   self->vector.data[index] = value;
+   return 0;
+}
+
+/********************************************************************************
+* int_vector_lazy_push: Lgger till ett element lngst bak i angiven vektor.
+*
+*                       - self : Pekare till vektorn.
+*                       - value: Elementet som ska lggas till.
+********************************************************************************/
+int int_vector_lazy_push(struct int_vector_lazy* self,
+                         const int value)
+{
+   if (self->lazy && self->size < SIZE_MAX && int_vector_lazy_at(self, self->size) == value)
+   {
+      self->size++;
+      return 0;
+   }
+
+   if (int_vector_lazy_materialize(self)) return 1;
+   return int_vector_push(&self->vector, value);
+}
+
+/********************************************************************************
+* int_vector_lazy_pop: Tar bort sista elementet i angiven vektor.
+*
+*                      - self: Pekare till vektorn.
+********************************************************************************/
+int int_vector_lazy_pop(struct int_vector_lazy* self)
+{
+   if (!self->lazy) return int_vector_pop(&self->vector);
+   if (self->size > 0) self->size--;
+   return 0;
+}
+
+/********************************************************************************
+* int_vector_lazy_resize: ndrar storleken p angiven vektor.
+*
+*                         - self: Pekare till vektorn.
+*                         - size: Vektorns nya storlek.
+********************************************************************************/
+int int_vector_lazy_resize(struct int_vector_lazy* self,
+                           const size_t size)
+{
+   if (!self->lazy) return int_vector_resize(&self->vector, size);
+   self->size = size;
+   return 0;
+}
+
+/********************************************************************************
+* int_vector_lazy_sum: Returnerar summan av samtliga element i angiven vektor.
+*                      Fr en lat vektor som inte slr ver och har hgst
+*                      2^31 element berknas summan som n * start plus
+*                      step * n * (n - 1) / 2, dr varken produkterna eller
+*                      summan kan sl ver, annars genomlps talfljden.
+*
+*                      - self: Pekare till vektorn.
+********************************************************************************/
+long long int_vector_lazy_sum(const struct int_vector_lazy* self)
+{
+   long long sum = 0;
+   unsigned value;
+
+   if (!self->lazy) return int_vector_sum(&self->vector);
+
+   if (!progression_wraps(self) && self->size <= ((size_t)1 << 31))
+   {
+      const long long n = (long long)self->size;
+      return n * self->start + (long long)self->step * (n * (n - 1) / 2);
+   }
+
+   value = (unsigned)self->start;
+
+   for (size_t i = 0; i < self->size; ++i)
+   {
+      sum += (int)value;
+      value += (unsigned)self->step;
+   }
+
+   return sum;
+}
+
+/********************************************************************************
+* int_vector_lazy_minmax: Tilldelar angivna variabler minsta respektive
+*                         strsta element i angiven vektor. En lat vektor som
+*                         inte slr ver har sina extremvrden i ndpunkterna.
+*
+*                         - self: Pekare till vektorn.
+*                         - min : Pekare till variabel fr minsta elementet.
+*                         - max : Pekare till variabel fr strsta elementet.
+********************************************************************************/
+int int_vector_lazy_minmax(const struct int_vector_lazy* self,
+                           int* min,
+                           int* max)
+{
+   int low, high;
+
+   if (!self->lazy) return int_vector_minmax(&self->vector, min, max);
+   if (self->size == 0) return 1;
+
+   if (!progression_wraps(self))
+   {
+      const int last = int_vector_lazy_at(self, self->size - 1);
+      low = self->step < 0 ? last : self->start;
+      high = self->step < 0 ? self->start : last;
+   }
+   else
+   {
+      low = high = self->start;
+
+      for (size_t i = 1; i < self->size; ++i)
+      {
+         const int value = int_vector_lazy_at(self, i);
+         if (value < low) low = value;
+         if (value > high) high = value;
+      }
+   }
+
+   *min = low;
+   *max = high;
+   return 0;
+}
+
+/********************************************************************************
+* int_vector_lazy_count_range: Returnerar antalet element i angiven vektor som
+*                              ligger i det slutna intervallet [low, high].
+*                              Fr en lat vektor som inte slr ver berknas
+*                              det frsta och sista index vars vrde ligger i
+*                              intervallet via division.
+*
+*                              - self: Pekare till vektorn.
+*                              - low : Intervallets undre grns (inklusive).
+*                              - high: Intervallets vre grns (inklusive).
+********************************************************************************/
+size_t int_vector_lazy_count_range(const struct int_vector_lazy* self,
+                                   const int low,
+                                   const int high)
+{
+   if (!self->lazy) return int_vector_count_range(&self->vector, low, high);
+   if (low > high || self->size == 0) return 0;
+
+   if (!progression_wraps(self))
+   {
+      const long long step = self->step < 0 ? -(long long)self->step : self->step;
+      long long first, last;
+
+      if (step == 0) return self->start >= low && self->start <= high ? self->size : 0;
+
+      if (self->step > 0)
+      {
+         first = -floor_div(-((long long)low - self->start), step);
+         last = floor_div((long long)high - self->start, step);
+      }
+      else
+      {
+         first = -floor_div(-((long long)self->start - high), step);
+         last = floor_div((long long)self->start - low, step);
+      }
+
+      if (first < 0) first = 0;
+      if (last > (long long)self->size - 1) last = (long long)self->size - 1;
+      return last < first ? 0 : (size_t)(last - first + 1);
+   }
+   else
+   {
+      size_t count = 0;
+
+      for (size_t i = 0; i < self->size; ++i)
+      {
+         const int value = int_vector_lazy_at(self, i);
+         count += value >= low && value <= high;
+      }
+
+      return count;
+   }
+}
+
+/********************************************************************************
+* int_vector_lazy_find: Returnerar index fr frsta elementet i angiven vektor
+*                       som r lika med angivet vrde, annars vektorns
+*                       storlek. Fr en lat vektor som inte slr ver
+*                       berknas indexet via division.
+*
+*                       - self : Pekare till vektorn.
+*                       - value: Vrdet som ska skas efter.
+********************************************************************************/
+size_t int_vector_lazy_find(const struct int_vector_lazy* self,
+                            const int value)
+{
+   if (!self->lazy)
+   {
+      const int* match = int_vector_find(&self->vector, value);
+      return match ? (size_t)(match - self->vector.data) : self->vector.size;
+   }
+
+   if (self->size == 0) return 0;
+
+   if (!progression_wraps(self))
+   {
+      const long long difference = (long long)value - self->start;
+      long long index;
+
+      if (self->step == 0) return difference == 0 ? 0 : self->size;
+      if (difference % self->step != 0) return self->size;
+
+      index = difference / self->step;
+      return index >= 0 && index < (long long)self->size ? (size_t)index : self->size;
+   }
+
+   for (size_t i = 0; i < self->size; ++i)
+   {
+      if (int_vector_lazy_at(self, i) == value) return i;
+   }
+
+   return self->size;
+}
+
+/********************************************************************************
+* format_progression: Formaterar angivet antal element frn angivet index i
+*                     talfljden i en lat vektor, se int_format_range_fn.
+*
+*                     - s      : Pekare till bufferten som ska tilldelas tecknen.
+*                     - context: Pekare till den lata vektorn.
+*                     - first  : Index fr det frsta elementet.
+*                     - count  : Antalet element som ska formateras.
+********************************************************************************/
+static size_t format_progression(char* s,
+                                 const void* context,
+                                 const size_t first,
+                                 const size_t count)
+{
+   const struct int_vector_lazy* self = (const struct int_vector_lazy*)context;
+   unsigned value = (unsigned)int_vector_lazy_at(self, first);
+   char* p = s;
+
+   for (size_t i = 0; i < count; ++i)
+   {
+      p += int_format(p, (int)value);
+      *p++ = '\n';
+      value += (unsigned)self->step;
+   }
+
+   return (size_t)(p - s);
+}
+
+/********************************************************************************
+* int_vector_lazy_print: Skriver ut elementen i angiven vektor via angiven
+*                        utstrm med samma format som int_vector_print.
+*
+*                        - self   : Pekare till vektorn som ska skrivas ut.
+*                        - ostream: Pekare till godtycklig utstrm (default = stdout).
+********************************************************************************/
+void int_vector_lazy_print(const struct int_vector_lazy* self,
+                           FILE* ostream)
+{
+   if (!self->lazy)
+   {
+      int_vector_print(&self->vector, ostream);
+   }
+   else
+   {
+      int_format_print_range(self, self->size, INT_FORMAT_MAX_LINE,
+                             format_progression, ostream, 0, 0);
+   }
+   return;
+}
\ No newline at end of file
@@ -0,0 +1,250 @@
+/********************************************************************************
+* int_vector_lazy.h: Innehller strukten int_vector_lazy, en vektor som lagrar
+*                    en aritmetisk talfljd start, start + step,
+*                    start + 2 * step, ... via endast startvrde, stegvrde
+*                    och storlek, samt associerade funktioner.
+*
+*                    Mnga vektorer tilldelas via int_vector_assign och
+*                    lses eller skrivs sedan endast ut. En lat vektor
+*                    berknar i stllet varje element vid behov, vilket
+*                    innebr att lsning, utskrift, summering, min/max,
+*                    rkning och skning sker utan att talfljden lagras i
+*                    minnet. Summa, min/max, rkning och skning berknas
+*                    dessutom i konstant tid s lnge talfljden inte slr
+*                    ver, annars genomlps talfljden utan att lagras.
+*
+*                    Talfljden materialiseras, dvs. skrivs till den inbyggda
+*                    int_vector via int_vector_assign, frst vid den frsta
+*                    ndring som bryter talfljden, exempelvis tilldelning av
+*                    ett enskilt element. Pop, minskning av storleken samt
+*                    push av talfljdens nsta vrde bevarar talfljden och
+*                    materialiserar drfr inte vektorn. Elementens vrden r
+*                    identiska med int_vector_assigns, inklusive
+*                    tvkomplementsomslag vid verslag.
+********************************************************************************/
+#ifndef INT_VECTOR_LAZY_H_
+#define INT_VECTOR_LAZY_H_
+
+/* Inkluderingsdirektiv: */
+#include "int_vector.h"
+
+/********************************************************************************
+* int_vector_lazy: Strukt fr en vektor som antingen lagrar en aritmetisk
+*                  talfljd (lat) eller sina element i en int_vector
+*                  (materialiserad). Strukten fr inte kopieras via
+*                  tilldelning.
+********************************************************************************/
+struct int_vector_lazy
+{
+   struct int_vector vector; /* Elementen efter materialisering. */
+   size_t size;              /* Talfljdens lngd s lnge vektorn r lat. */
+   int start;                /* Talfljdens startvrde. */
+   int step;                 /* Talfljdens stegvrde. */
+   int lazy;                 /* Indikerar ifall vektorn lagrar en talfljd. */
+};
+
+/********************************************************************************
+* int_vector_lazy_init: Initierar ny tom materialiserad vektor.
+*
+*                       - self: Pekare till vektorn som ska initieras.
+********************************************************************************/
+static inline void int_vector_lazy_init(struct int_vector_lazy* self)
+{
+   int_vector_init(&self->vector);
+   self->size = 0;
+   self->start = 0;
+   self->step = 0;
+   self->lazy = 0;
+   return;
+}
+
+/********************************************************************************
+* int_vector_lazy_clear: Tmmer angiven vektor och frigr allokerat minne.
+*
+*                        - self: Pekare till vektorn som ska tmmas.
+********************************************************************************/
+static inline void int_vector_lazy_clear(struct int_vector_lazy* self)
+{
+   int_vector_clear(&self->vector);
+   int_vector_lazy_init(self);
+   return;
+}
+
+/********************************************************************************
+* int_vector_lazy_is_lazy: Indikerar ifall angiven vektor lagrar en talfljd,
+*                          dvs. nnu inte har materialiserats.
+*
+*                          - self: Pekare till vektorn.
+********************************************************************************/
+static inline int int_vector_lazy_is_lazy(const struct int_vector_lazy* self)
+{
+   return self->lazy;
+}
+
+/********************************************************************************
+* int_vector_lazy_size: Returnerar antalet element i angiven vektor.
+*
+*                       - self: Pekare till vektorn.
+********************************************************************************/
+static inline size_t int_vector_lazy_size(const struct int_vector_lazy* self)
+{
+   return self->lazy ? self->size : self->vector.size;
+}
+
+/********************************************************************************
+* int_vector_lazy_at: Returnerar elementet p angivet index i angiven vektor.
+*                     Indexet mste understiga vektorns storlek.
+*
+*                     - self : Pekare till vektorn.
+*                     - index: Elementets index.
+********************************************************************************/
+static inline int int_vector_lazy_at(const struct int_vector_lazy* self,
+                                     const size_t index)
+{
+   if (!self->lazy) return self->vector.data[index];
+   return (int)((unsigned)self->start + (unsigned)index * (unsigned)self->step);
+}
+
+/********************************************************************************
+* int_vector_lazy_assign: Tilldelar angiven vektor en aritmetisk talfljd med
+*                         angiven storlek, startvrde och stegvrde utan att
+*                         talfljden lagras. Tidigare element frigrs.
+*
+*                         - self     : Pekare till vektorn som ska tilldelas.
+*                         - size     : Talfljdens lngd.
+*                         - start_val: Startvrde fr talfljden.
+*                         - step_val : Stegvrde, dvs. differensen mellan
+*                                      varje element.
+********************************************************************************/
+void int_vector_lazy_assign(struct int_vector_lazy* self,
+                            const size_t size,
+                            const int start_val,
+                            const int step_val);
+
+/********************************************************************************
+* int_vector_lazy_materialize: Skriver talfljden i angiven vektor till dess
+*                              int_vector, om detta inte redan har skett. Vid
+*                              lyckad minnesallokering returneras 0, annars
+*                              returneras felkod 1 och vektorn lmnas lat.
+*
+*                              - self: Pekare till vektorn.
+********************************************************************************/
+int int_vector_lazy_materialize(struct int_vector_lazy* self);
+
+/********************************************************************************
+* int_vector_lazy_vector: Returnerar en pekare till angiven vektors element
+*                         som en int_vector, som kan ndras fritt, efter att
+*                         vektorn vid behov har materialiserats. Vid
+*                         misslyckad minnesallokering returneras null.
+*
+*                         - self: Pekare till vektorn.
+********************************************************************************/
+struct int_vector* int_vector_lazy_vector(struct int_vector_lazy* self);
+
+/********************************************************************************
+* int_vector_lazy_set: Tilldelar elementet p angivet index angivet vrde,
+*                      vilket materialiserar vektorn om vrdet bryter
+*                      talfljden. Vid lyckad tilldelning returneras 0. Om
+*                      indexet ligger utanfr vektorn eller
+*                      minnesallokeringen misslyckas returneras felkod 1.
+*
+*                      - self : Pekare till vektorn.
+*                      - index: Elementets index.
+*                      - value: Elementets nya vrde.
+********************************************************************************/
+int int_vector_lazy_set(struct int_vector_lazy* self,
+                        const size_t index,
+                        const int value);
+
+/********************************************************************************
+* int_vector_lazy_push: Lgger till ett element lngst bak i angiven vektor.
+*                       Om vektorn r lat och vrdet r talfljdens nsta
+*                       vrde frlngs talfljden, annars materialiseras
+*                       vektorn frst. Vid lyckad minnesallokering returneras
+*                       0, annars felkod 1.
+*
+*                       - self : Pekare till vektorn.
+*                       - value: Elementet som ska lggas till.
+********************************************************************************/
+int int_vector_lazy_push(struct int_vector_lazy* self,
+                         const int value);
+
+/********************************************************************************
+* int_vector_lazy_pop: Tar bort sista elementet i angiven vektor, dr en lat
+*                      vektor frblir lat. Returnerar alltid 0.
+*
+*                      - self: Pekare till vektorn.
+********************************************************************************/
+int int_vector_lazy_pop(struct int_vector_lazy* self);
+
+/********************************************************************************
+* int_vector_lazy_resize: ndrar storleken p angiven vektor. En lat vektor
+*                         frblir lat vid minskning och frlngs med
+*                         talfljdens vrden vid kning, s att resultatet
+*                         motsvarar int_vector_assign p hela vektorn. Vid
+*                         lyckad minnesallokering returneras 0, annars
+*                         felkod 1.
+*
+*                         - self: Pekare till vektorn.
+*                         - size: Vektorns nya storlek.
+********************************************************************************/
+int int_vector_lazy_resize(struct int_vector_lazy* self,
+                           const size_t size);
+
+/********************************************************************************
+* int_vector_lazy_sum: Returnerar summan av samtliga element i angiven vektor
+*                      som ett 64-bitars tal.
+*
+*                      - self: Pekare till vektorn.
+********************************************************************************/
+long long int_vector_lazy_sum(const struct int_vector_lazy* self);
+
+/********************************************************************************
+* int_vector_lazy_minmax: Tilldelar angivna variabler minsta respektive
+*                         strsta element i angiven vektor. Om vektorn r tom
+*                         returneras felkod 1 och variablerna lmnas
+*                         ofrndrade, annars returneras 0.
+*
+*                         - self: Pekare till vektorn.
+*                         - min : Pekare till variabel fr minsta elementet.
+*                         - max : Pekare till variabel fr strsta elementet.
+********************************************************************************/
+int int_vector_lazy_minmax(const struct int_vector_lazy* self,
+                           int* min,
+                           int* max);
+
+/********************************************************************************
+* int_vector_lazy_count_range: Returnerar antalet element i angiven vektor som
+*                              ligger i det slutna intervallet [low, high].
+*
+*                              - self: Pekare till vektorn.
+*                              - low : Intervallets undre grns (inklusive).
+*                              - high: Intervallets vre grns (inklusive).
+********************************************************************************/
+size_t int_vector_lazy_count_range(const struct int_vector_lazy* self,
+                                   const int low,
+                                   const int high);
+
+/********************************************************************************
+* int_vector_lazy_find: Returnerar index fr frsta elementet i angiven vektor
+*                       som r lika med angivet vrde. Om vrdet saknas
+*                       returneras vektorns storlek.
+*
+*                       - self : Pekare till vektorn.
+*                       - value: Vrdet som ska skas efter.
+********************************************************************************/
+size_t int_vector_lazy_find(const struct int_vector_lazy* self,
+                            const int value);
+
+/********************************************************************************
+* int_vector_lazy_print: Skriver ut elementen i angiven vektor via angiven
+*                        utstrm med samma format som int_vector_print, dr
+*                        en lat vektor formateras direkt frn talfljden.
+*
+*                        - self   : Pekare till vektorn som ska skrivas ut.
+*                        - ostream: Pekare till godtycklig utstrm (default = stdout).
+********************************************************************************/
+void int_vector_lazy_print(const struct int_vector_lazy* self,
+                           FILE* ostream);
+
+#endif /* INT_VECTOR_LAZY_H_ */
\ No newline at end of file
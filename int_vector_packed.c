@@ -0,0 +1,428 @@
+/********************************************************************************
+* int_vector_packed.c: Innehller definitioner av associerade funktioner fr
+*                      strukten int_vector_packed.
+********************************************************************************/
+#include "int_vector_packed.h"
+#include "int_format.h"
+
+/********************************************************************************
+* block_width: Returnerar bitbredden fr angivet block i angiven vektor.
+*
+*              - self : Pekare till den komprimerade vektorn.
+*              - block: Blockets index.
+********************************************************************************/
+static inline unsigned block_width(const struct int_vector_packed* self,
+                                   const size_t block)
+{
+   return (unsigned)((self->blocks[block + 1].offset - self->blocks[block].offset) /
+                     (INT_VECTOR_PACKED_BLOCK / 32));
+}
+
+/********************************************************************************
+* block_size: Returnerar antalet heltal i angivet block i angiven vektor.
+*
+*             - self : Pekare till den komprimerade vektorn.
+*             - block: Blockets index.
+********************************************************************************/
+static inline size_t block_size(const struct int_vector_packed* self,
+                                const size_t block)
+{
+   const size_t first = block * INT_VECTOR_PACKED_BLOCK;
+   return self->size - first < INT_VECTOR_PACKED_BLOCK ?
+          self->size - first : INT_VECTOR_PACKED_BLOCK;
+}
+
+/********************************************************************************
+* bits_of: Returnerar antalet bitar som krvs fr att lagra angivet tal.
+*
+*          - value: Talet som ska lagras.
+********************************************************************************/
+static inline unsigned bits_of(const uint32_t value)
+{
+   return value ? 32 - (unsigned)__builtin_clz(value) : 0;
+}
+
+/********************************************************************************
+* block_analyze: Berknar referensram och bitbredd fr angivet block, dr
+*                differenserna mellan efterfljande heltal berknas med
+*                tvkomplementsomslag och referensramen r den minsta
+*                differensen tolkad med tecken.
+*
+*                - data     : Pekare till blockets frsta heltal.
+*                - size     : Antalet heltal i blocket.
+*                - reference: Pekare till variabeln som tilldelas referensramen.
+********************************************************************************/
+static unsigned block_analyze(const int* data,
+                              const size_t size,
+                              int* reference)
+{
+   int low = 0;
+   uint32_t high = 0;
+
+   for (size_t i = 1; i < size; ++i)
+   {
+      const int delta = (int)((uint32_t)data[i] - (uint32_t)data[i - 1]);
+      if (i == 1 || delta < low) low = delta;
+   }
+
+   for (size_t i = 1; i < size; ++i)
+   {
+      const uint32_t value = (uint32_t)data[i] - (uint32_t)data[i - 1] - (uint32_t)low;
+      if (value > high) high = value;
+   }
+
+   *reference = low;
+   return bits_of(high);
+}
+
+/********************************************************************************
+* block_pack: Packar differenserna i angivet block med angiven bitbredd till
+*             angivna ord, som mste vara nollstllda. Position 0 i blocket
+*             lmnas tom, eftersom det frsta heltalet lagras i huvudet.
+*
+*             - data     : Pekare till blockets frsta heltal.
+*             - size     : Antalet heltal i blocket.
+*             - reference: Blockets referensram.
+*             - width    : Blockets bitbredd.
+*             - words    : Pekare till blockets frsta ord.
+********************************************************************************/
+static void block_pack(const int* data,
+                       const size_t size,
+                       const int reference,
+                       const unsigned width,
+                       uint32_t* words)
+{
+   if (width == 0) return;
+
+   for (size_t i = 1; i < size; ++i)
+   {
+      const uint32_t value = (uint32_t)data[i] - (uint32_t)data[i - 1] - (uint32_t)reference;
+      const size_t bit = i * width;
+      const unsigned shift = (unsigned)(bit & 31);
+
+      words[bit >> 5] |= value << shift;
+      if (shift + width > 32) words[(bit >> 5) + 1] |= value >> (32 - shift);
+   }
+
+   return;
+}
+
+/********************************************************************************
+* unpack: Packar upp angivet antal differenser med angiven bitbredd frn
+*         angivna ord och summerar dem lpande till heltal. Orden lses i
+*         fljd till en 64-bitars buffert, som alltid innehller minst ett
+*         helt vrde, vilket innebr att varje ord endast lses en gng och
+*         att inga skift eller index behver berknas per position.
+*
+*         - words    : Pekare till blockets frsta ord.
+*         - out      : Pekare till fltet som tilldelas heltalen.
+*         - size     : Antalet heltal som ska packas upp.
+*         - first    : Blockets frsta heltal.
+*         - reference: Blockets referensram.
+*         - width    : Blockets bitbredd.
+********************************************************************************/
+static inline void unpack(const uint32_t* words,
+                          int* out,
+                          const size_t size,
+                          const uint32_t first,
+                          const uint32_t reference,
+                          const unsigned width)
+{
+   const uint32_t mask = width == 32 ? 0xFFFFFFFFu : ((uint32_t)1 << width) - 1;
+   uint64_t buffer = (uint64_t)words[0] >> width;
+   unsigned bits = 32 - width;
+   uint32_t value = first;
+
+   out[0] = (int)first;
+   words++;
+
+   for (size_t i = 1; i < size; ++i)
+   {
+      if (bits < width)
+      {
+         buffer |= (uint64_t)*words++ << bits;
+         bits += 32;
+      }
+
+      value += ((uint32_t)buffer & mask) + reference;
+      buffer >>= width;
+      bits -= width;
+      out[i] = (int)value;
+   }
+
+   return;
+}
+
+/********************************************************************************
+* int_vector_packed_freeze: Komprimerar angivet flt till angiven vektor. I
+*                           ett frsta svep berknas varje blocks referensram
+*                           och bitbredd, och drmed blockens offset, varefter
+*                           exakt rtt antal ord allokeras och differenserna
+*                           packas i ett andra svep.
+*
+*                           - self: Pekare till den komprimerade vektorn.
+*                           - data: Pekare till fltet som ska komprimeras.
+*                           - size: Antalet heltal i fltet.
+********************************************************************************/
+int int_vector_packed_freeze(struct int_vector_packed* self,
+                             const int* data,
+                             const size_t size)
+{
+   const size_t count = (size + INT_VECTOR_PACKED_BLOCK - 1) / INT_VECTOR_PACKED_BLOCK;
+   size_t offset = 0;
+
+   int_vector_packed_clear(self);
+   self->blocks = (struct int_vector_packed_block*)
+      malloc(sizeof(struct int_vector_packed_block) * (count + 1));
+   if (!self->blocks) return 1;
+
+   for (size_t i = 0; i < count; ++i)
+   {
+      const int* block = data + i * INT_VECTOR_PACKED_BLOCK;
+      const size_t n = size - i * INT_VECTOR_PACKED_BLOCK < INT_VECTOR_PACKED_BLOCK ?
+                       size - i * INT_VECTOR_PACKED_BLOCK : INT_VECTOR_PACKED_BLOCK;
+      const unsigned width = block_analyze(block, n, &self->blocks[i].reference);
+
+      self->blocks[i].offset = offset;
+      self->blocks[i].first = block[0];
+      offset += (INT_VECTOR_PACKED_BLOCK / 32) * width;
+   }
+
+   self->blocks[count].offset = offset;
+   self->blocks[count].first = 0;
+   self->blocks[count].reference = 0;
+
+   /* Ett extra ord allokeras, s att allokeringen aldrig blir tom. */
+   self->words = (uint32_t*)calloc(offset + 1, sizeof(uint32_t));
+
+   if (!self->words)
+   {
+      int_vector_packed_clear(self);
+      return 1;
+   }
+
+   self->size = size;
+   self->count = count;
+
+   for (size_t i = 0; i < count; ++i)
+   {
+      block_pack(data + i * INT_VECTOR_PACKED_BLOCK, block_size(self, i),
+                 self->blocks[i].reference, block_width(self, i),
+                 self->words + self->blocks[i].offset);
+   }
+
+   return 0;
+}
+
+/********************************************************************************
+* int_vector_packed_decode: Packar upp angivet block till angivet flt. Om
+*                           blockets bitbredd r 0 r samtliga differenser
+*                           lika med referensramen och inga ord behver lsas.
+*
+*                           - self : Pekare till den komprimerade vektorn.
+*                           - block: Blockets index.
+*                           - out  : Pekare till fltet som ska tilldelas.
+********************************************************************************/
+size_t int_vector_packed_decode(const struct int_vector_packed* self,
+                                const size_t block,
+                                int* out)
+{
+   const struct int_vector_packed_block* header = self->blocks + block;
+   const size_t n = block_size(self, block);
+   const unsigned width = block_width(self, block);
+
+   if (width > 0)
+   {
+      unpack(self->words + header->offset, out, n, (uint32_t)header->first,
+             (uint32_t)header->reference, width);
+   }
+   else
+   {
+      uint32_t value = (uint32_t)header->first;
+      out[0] = header->first;
+
+      for (size_t i = 1; i < n; ++i)
+      {
+         value += (uint32_t)header->reference;
+         out[i] = (int)value;
+      }
+   }
+
+   return n;
+}
+
+/********************************************************************************
+* int_vector_packed_at: Returnerar heltalet p angivet index genom att packa
+*                       upp blockets brjan fram till och med indexet.
+*
+*                       - self : Pekare till den komprimerade vektorn.
+*                       - index: Heltalets index.
+********************************************************************************/
+int int_vector_packed_at(const struct int_vector_packed* self,
+                         const size_t index)
+{
+   const size_t block = index / INT_VECTOR_PACKED_BLOCK;
+   const size_t position = index % INT_VECTOR_PACKED_BLOCK;
+   const struct int_vector_packed_block* header = self->blocks + block;
+   const unsigned width = block_width(self, block);
+   int values[INT_VECTOR_PACKED_BLOCK];
+
+   if (width == 0)
+   {
+      return (int)((uint32_t)header->first + (uint32_t)position * (uint32_t)header->reference);
+   }
+
+   unpack(self->words + header->offset, values, position + 1, (uint32_t)header->first,
+          (uint32_t)header->reference, width);
+   return values[position];
+}
+
+/********************************************************************************
+* int_vector_packed_thaw: Packar upp samtliga heltal i angiven komprimerad
+*                         vektor direkt till angiven mlvektors flt.
+*
+*                         - self: Pekare till den komprimerade vektorn.
+*                         - dst : Pekare till mlvektorn.
+********************************************************************************/
+int int_vector_packed_thaw(const struct int_vector_packed* self,
+                           struct int_vector* dst)
+{
+   if (int_vector_resize(dst, self->size)) return 1;
+
+   for (size_t i = 0; i < self->count; ++i)
+   {
+      int_vector_packed_decode(self, i, dst->data + i * INT_VECTOR_PACKED_BLOCK);
+   }
+
+   return 0;
+}
+
+/********************************************************************************
+* int_vector_packed_sum: Returnerar summan av samtliga heltal i angiven
+*                        komprimerad vektor, som packas upp block fr block.
+*
+*                        - self: Pekare till den komprimerade vektorn.
+********************************************************************************/
+long long int_vector_packed_sum(const struct int_vector_packed* self)
+{
+   int values[INT_VECTOR_PACKED_BLOCK];
+   long long sum = 0;
+
+   for (size_t i = 0; i < self->count; ++i)
+   {
+      const size_t n = int_vector_packed_decode(self, i, values);
+      for (size_t j = 0; j < n; ++j) sum += values[j];
+   }
+
+   return sum;
+}
+
+/********************************************************************************
+* int_vector_packed_minmax: Tilldelar angivna variabler minsta respektive
+*                           strsta heltal i angiven komprimerad vektor.
+*
+*                           - self: Pekare till den komprimerade vektorn.
+*                           - min : Pekare till variabel fr minsta heltalet.
+*                           - max : Pekare till variabel fr strsta heltalet.
+********************************************************************************/
+int int_vector_packed_minmax(const struct int_vector_packed* self,
+                             int* min,
+                             int* max)
+{
+   int values[INT_VECTOR_PACKED_BLOCK];
+   int low, high;
+
+   if (self->size == 0) return 1;
+   low = high = self->blocks[0].first;
+
+   for (size_t i = 0; i < self->count; ++i)
+   {
+      const size_t n = int_vector_packed_decode(self, i, values);
+
+      for (size_t j = 0; j < n; ++j)
+      {
+         if (values[j] < low) low = values[j];
+         if (values[j] > high) high = values[j];
+      }
+   }
+
+   *min = low;
+   *max = high;
+   return 0;
+}
+
+/********************************************************************************
+* int_vector_packed_count_range: Returnerar antalet heltal i angiven
+*                                komprimerad vektor som ligger i det slutna
+*                                intervallet [low, high].
+*
+*                                - self: Pekare till den komprimerade vektorn.
+*                                - low : Intervallets undre grns (inklusive).
+*                                - high: Intervallets vre grns (inklusive).
+********************************************************************************/
+size_t int_vector_packed_count_range(const struct int_vector_packed* self,
+                                     const int low,
+                                     const int high)
+{
+   int values[INT_VECTOR_PACKED_BLOCK];
+   size_t count = 0;
+
+   for (size_t i = 0; i < self->count; ++i)
+   {
+      const size_t n = int_vector_packed_decode(self, i, values);
+      for (size_t j = 0; j < n; ++j) count += values[j] >= low && values[j] <= high;
+   }
+
+   return count;
+}
+
+/********************************************************************************
+* format_packed: Formaterar angivet antal heltal frn angivet index i en
+*                komprimerad vektor, se int_format_range_fn. Varje block som
+*                berrs packas upp till en lokal buffert, varefter den del
+*                som ligger inom intervallet formateras.
+*
+*                - s      : Pekare till bufferten som ska tilldelas tecknen.
+*                - context: Pekare till den komprimerade vektorn.
+*                - first  : Index fr det frsta heltalet.
+*                - count  : Antalet heltal som ska formateras.
+********************************************************************************/
+static size_t format_packed(char* s,
+                            const void* context,
+                            const size_t first,
+                            const size_t count)
+{
+   const struct int_vector_packed* self = (const struct int_vector_packed*)context;
+   int values[INT_VECTOR_PACKED_BLOCK];
+   size_t index = first;
+   char* p = s;
+
+   while (index < first + count)
+   {
+      const size_t block = index / INT_VECTOR_PACKED_BLOCK;
+      const size_t begin = index % INT_VECTOR_PACKED_BLOCK;
+      size_t end = int_vector_packed_decode(self, block, values);
+
+      if (end - begin > first + count - index) end = begin + (first + count - index);
+      p += int_format_lines(p, values + begin, end - begin);
+      index += end - begin;
+   }
+
+   return (size_t)(p - s);
+}
+
+/********************************************************************************
+* int_vector_packed_print: Skriver ut heltalen i angiven komprimerad vektor
+*                          via angiven utstrm med samma format som
+*                          int_vector_print.
+*
+*                          - self   : Pekare till den komprimerade vektorn.
+*                          - ostream: Pekare till godtycklig utstrm (default = stdout).
+********************************************************************************/
+void int_vector_packed_print(const struct int_vector_packed* self,
+                             FILE* ostream)
+{
+   int_format_print_range(self, self->size, INT_FORMAT_MAX_LINE,
+                          format_packed, ostream, 0, 0);
+   return;
+}
\ No newline at end of file
@@ -0,0 +1,218 @@
+/********************************************************************************
+* int_vector_packed.h: Innehller strukten int_vector_packed, en fryst
+*                      (skrivskyddad) komprimerad form av en vektor, samt
+*                      associerade funktioner.
+*
+*                      Heltalen delas in i block om INT_VECTOR_PACKED_BLOCK
+*                      heltal. I varje block lagras det frsta heltalet i
+*                      klartext, medan vriga lagras som differensen mot
+*                      fregende heltal (deltakodning). Frn differenserna
+*                      dras blockets minsta differens (referensram), varefter
+*                      resultaten packas med det minsta antal bitar som
+*                      rymmer blockets strsta vrde. Fr nstan monotona
+*                      data, exempelvis sorterade identiteter eller
+*                      tidsstmplar, blir differenserna sm och varje heltal
+*                      upptar drmed endast ngra f bitar i stllet fr 32.
+*
+*                      Differenserna berknas med tvkomplementsomslag, vilket
+*                      innebr att godtyckliga heltal kan packas utan
+*                      frlust. I vrsta fall upptar ett block 32 bitar per
+*                      heltal plus blockets huvud.
+*
+*                      Ett block packas upp i sin helhet i fljd via
+*                      int_vector_packed_decode, vilket anvnds fr
+*                      genomlpning vid summering, min/max, rkning, utskrift
+*                      och uppackning. Enskilda heltal kan lsas via
+*                      int_vector_packed_at, som endast packar upp brjan av
+*                      ett block.
+********************************************************************************/
+#ifndef INT_VECTOR_PACKED_H_
+#define INT_VECTOR_PACKED_H_
+
+/* Inkluderingsdirektiv: */
+#include <stdint.h> /* Innehller uint32_t. */
+
+#include "int_vector.h"
+
+/********************************************************************************
+* INT_VECTOR_PACKED_BLOCK: Antalet heltal per block. Eftersom antalet r en
+*                          multipel av 32 upptar ett block med bitbredd b
+*                          exakt 4 * b ord om 32 bitar.
+********************************************************************************/
+#define INT_VECTOR_PACKED_BLOCK 128
+
+/********************************************************************************
+* int_vector_packed_block: Strukt fr ett blocks huvud.
+********************************************************************************/
+struct int_vector_packed_block
+{
+   size_t offset; /* Index fr blockets frsta ord. */
+   int first;     /* Blockets frsta heltal. */
+   int reference; /* Blockets minsta differens (referensram). */
+};
+
+/********************************************************************************
+* int_vector_packed: Strukt fr en fryst komprimerad vektor. Blockens
+*                    bitbredd framgr av skillnaden mellan efterfljande
+*                    blocks offset, varfr ett extra huvud lagras efter
+*                    det sista blocket. Strukten fr inte kopieras via
+*                    tilldelning.
+********************************************************************************/
+struct int_vector_packed
+{
+   struct int_vector_packed_block* blocks; /* Blockens huvuden. */
+   uint32_t* words; /* De packade differenserna. */
+   size_t size;     /* Antalet heltal. */
+   size_t count;    /* Antalet block. */
+};
+
+/********************************************************************************
+* int_vector_packed_init: Initierar ny tom komprimerad vektor.
+*
+*                         - self: Pekare till vektorn som ska initieras.
+********************************************************************************/
+static inline void int_vector_packed_init(struct int_vector_packed* self)
+{
+   self->blocks = 0;
+   self->words = 0;
+   self->size = 0;
+   self->count = 0;
+   return;
+}
+
+/********************************************************************************
+* int_vector_packed_clear: Frigr minnet fr angiven komprimerad vektor.
+*
+*                          - self: Pekare till vektorn som ska tmmas.
+********************************************************************************/
+static inline void int_vector_packed_clear(struct int_vector_packed* self)
+{
+   free(self->blocks);
+   free(self->words);
+   int_vector_packed_init(self);
+   return;
+}
+
+/********************************************************************************
+* int_vector_packed_size: Returnerar antalet heltal i angiven vektor.
+*
+*                         - self: Pekare till vektorn.
+********************************************************************************/
+static inline size_t int_vector_packed_size(const struct int_vector_packed* self)
+{
+   return self->size;
+}
+
+/********************************************************************************
+* int_vector_packed_bytes: Returnerar antalet byte som angiven komprimerad
+*                          vektor upptar, exklusive sjlva strukten.
+*
+*                          - self: Pekare till vektorn.
+********************************************************************************/
+static inline size_t int_vector_packed_bytes(const struct int_vector_packed* self)
+{
+   if (!self->blocks) return 0;
+   return sizeof(struct int_vector_packed_block) * (self->count + 1) +
+          sizeof(uint32_t) * (self->blocks[self->count].offset + 1);
+}
+
+/********************************************************************************
+* int_vector_packed_freeze: Komprimerar angivet flt till angiven vektor,
+*                           vars tidigare innehll frigrs. Vid lyckad
+*                           minnesallokering returneras 0, annars returneras
+*                           felkod 1 och vektorn lmnas tom.
+*
+*                           - self: Pekare till den komprimerade vektorn.
+*                           - data: Pekare till fltet som ska komprimeras.
+*                           - size: Antalet heltal i fltet.
+********************************************************************************/
+int int_vector_packed_freeze(struct int_vector_packed* self,
+                             const int* data,
+                             const size_t size);
+
+/********************************************************************************
+* int_vector_packed_thaw: Packar upp samtliga heltal i angiven komprimerad
+*                         vektor till angiven mlvektor, vars tidigare
+*                         innehll erstts. Vid lyckad minnesallokering
+*                         returneras 0, annars returneras felkod 1 och
+*                         mlvektorn lmnas intakt.
+*
+*                         - self: Pekare till den komprimerade vektorn.
+*                         - dst : Pekare till mlvektorn.
+********************************************************************************/
+int int_vector_packed_thaw(const struct int_vector_packed* self,
+                           struct int_vector* dst);
+
+/********************************************************************************
+* int_vector_packed_decode: Packar upp angivet block till angivet flt och
+*                           returnerar antalet heltal i blocket, vilket
+*                           understiger INT_VECTOR_PACKED_BLOCK endast fr
+*                           det sista blocket. Fltet mste rymma samtliga
+*                           heltal i blocket.
+*
+*                           - self : Pekare till den komprimerade vektorn.
+*                           - block: Blockets index.
+*                           - out  : Pekare till fltet som ska tilldelas.
+********************************************************************************/
+size_t int_vector_packed_decode(const struct int_vector_packed* self,
+                                const size_t block,
+                                int* out);
+
+/********************************************************************************
+* int_vector_packed_at: Returnerar heltalet p angivet index, som mste
+*                       understiga vektorns storlek.
+*
+*                       - self : Pekare till den komprimerade vektorn.
+*                       - index: Heltalets index.
+********************************************************************************/
+int int_vector_packed_at(const struct int_vector_packed* self,
+                         const size_t index);
+
+/********************************************************************************
+* int_vector_packed_sum: Returnerar summan av samtliga heltal i angiven
+*                        komprimerad vektor som ett 64-bitars tal.
+*
+*                        - self: Pekare till den komprimerade vektorn.
+********************************************************************************/
+long long int_vector_packed_sum(const struct int_vector_packed* self);
+
+/********************************************************************************
+* int_vector_packed_minmax: Tilldelar angivna variabler minsta respektive
+*                           strsta heltal i angiven komprimerad vektor. Om
+*                           vektorn r tom returneras felkod 1 och
+*                           variablerna lmnas ofrndrade, annars 0.
+*
+*                           - self: Pekare till den komprimerade vektorn.
+*                           - min : Pekare till variabel fr minsta heltalet.
+*                           - max : Pekare till variabel fr strsta heltalet.
+********************************************************************************/
+int int_vector_packed_minmax(const struct int_vector_packed* self,
+                             int* min,
+                             int* max);
+
+/********************************************************************************
+* int_vector_packed_count_range: Returnerar antalet heltal i angiven
+*                                komprimerad vektor som ligger i det slutna
+*                                intervallet [low, high].
+*
+*                                - self: Pekare till den komprimerade vektorn.
+*                                - low : Intervallets undre grns (inklusive).
+*                                - high: Intervallets vre grns (inklusive).
+********************************************************************************/
+size_t int_vector_packed_count_range(const struct int_vector_packed* self,
+                                     const int low,
+                                     const int high);
+
+/********************************************************************************
+* int_vector_packed_print: Skriver ut heltalen i angiven komprimerad vektor
+*                          via angiven utstrm med samma format som
+*                          int_vector_print, dr blocken packas upp ett i
+*                          taget under formateringen.
+*
+*                          - self   : Pekare till den komprimerade vektorn.
+*                          - ostream: Pekare till godtycklig utstrm (default = stdout).
+********************************************************************************/
+void int_vector_packed_print(const struct int_vector_packed* self,
+                             FILE* ostream);
+
+#endif /* INT_VECTOR_PACKED_H_ */
\ No newline at end of file
@@ -0,0 +1,616 @@
+/********************************************************************************
+* int_vector_parallel.c: Innehller definitioner av trdpoolen samt de
+*                        flertrdade elementvisa operationerna.
+********************************************************************************/
+#define _POSIX_C_SOURCE 200809L /* Krvs fr sysconf och posix_memalign. */
+#include "int_vector_parallel.h"
+#include "int_simd.h"
+
+#include <pthread.h>   /* Innehller pthread_create, mutexar med mera. */
+#include <stdatomic.h> /* Innehller atomic_ullong med mera. */
+#include <stdint.h>    /* Innehller uintptr_t och UINT32_MAX. */
+#include <unistd.h>    /* Innehller sysconf. */
+
+/********************************************************************************
+* parallel_slot: Strukt fr en trds fljd av delar, dr index fr nsta del
+*                lagras i de vre 32 bitarna och index efter sista delen i
+*                de undre. garen tar delar framifrn och vriga trdar
+*                stjl bakifrn, bda via compare-and-swap. Varje fljd
+*                fyller en egen cachelinje.
+********************************************************************************/
+struct parallel_slot
+{
+   atomic_ullong range; /* Nsta del samt sista del + 1. */
+   char padding[INT_VECTOR_PARALLEL_CACHE_LINE - sizeof(atomic_ullong)];
+};
+
+/********************************************************************************
+* parallel_job: Strukt fr ett jobb, dvs. en vektor uppdelad i delar samt
+*               funktionen som anropas per del.
+********************************************************************************/
+struct parallel_job
+{
+   size_t size;    /* Antalet heltal i vektorn. */
+   size_t chunk;   /* Antalet heltal per del. */
+   size_t offset;  /* Antalet heltal fre vektorn p frsta cachelinjen. */
+   size_t chunks;  /* Antalet delar. */
+   size_t threads; /* Antalet deltagande trdar, inklusive anropande trd. */
+   void (*run)(void* task, const size_t chunk, const size_t first, const size_t last);
+   void* task;     /* Pekare till jobbets uppgift. */
+};
+
+/********************************************************************************
+* parallel_pool: Strukt fr trdpoolen, vars trdar vntar p att
+*                generationen ska rknas upp, varefter de deltar i aktuellt
+*                jobb om deras index understiger jobbets antal trdar.
+********************************************************************************/
+struct parallel_pool
+{
+   pthread_mutex_t submit;       /* Hlls av anropande trd under ett jobb. */
+   pthread_mutex_t lock;         /* Skyddar vriga flt. */
+   pthread_cond_t wake;          /* Signaleras vid nytt jobb eller avslut. */
+   pthread_cond_t done;          /* Signaleras nr sista trden r klar. */
+   pthread_t ids[INT_VECTOR_PARALLEL_MAX_THREADS];
+   size_t workers;               /* Antalet startade trdar i poolen. */
+   size_t finished;              /* Antalet trdar klara med aktuellt jobb. */
+   unsigned long generation;     /* Rknas upp vid varje nytt jobb. */
+   unsigned long spawned;        /* Generationen nr trdar senast startades. */
+   int stop;                     /* Indikerar att trdarna ska avslutas. */
+   const struct parallel_job* job;
+   struct parallel_slot* slots;  /* En fljd av delar per trd. */
+};
+
+/* Statiska variabler: */
+static size_t parallel_threads = 0; /* Hgsta antal trdar, 0 = antalet krnor. */
+static struct parallel_pool pool =
+{
+   PTHREAD_MUTEX_INITIALIZER, PTHREAD_MUTEX_INITIALIZER,
+   PTHREAD_COND_INITIALIZER, PTHREAD_COND_INITIALIZER,
+   { 0 }, 0, 0, 0, 0, 0, 0, 0
+};
+
+/********************************************************************************
+* pack: Returnerar en fljd av delar packad till ett 64-bitars tal.
+*
+*       - next: Index fr nsta del.
+*       - end : Index efter sista delen.
+********************************************************************************/
+static inline unsigned long long pack(const size_t next,
+                                      const size_t end)
+{
+   return (unsigned long long)next << 32 | (unsigned long long)end;
+}
+
+/********************************************************************************
+* take: Tar nsta del fr angiven trd, i frsta hand framifrn i trdens
+*       egen fljd och i andra hand bakifrn i vriga trdars fljder. Om
+*       samtliga fljder r tomma returneras 0, annars 1.
+*
+*       - job  : Pekare till jobbet.
+*       - self : Trdens index.
+*       - chunk: Pekare till variabel fr delens index.
+********************************************************************************/
+static int take(const struct parallel_job* job,
+                const size_t self,
+                size_t* chunk)
+{
+   atomic_ullong* own = &pool.slots[self].range;
+   unsigned long long range = atomic_load_explicit(own, memory_order_relaxed);
+   int contended = 1;
+
+   while ((size_t)(range >> 32) < (size_t)(range & UINT32_MAX))
+   {
+      if (atomic_compare_exchange_weak_explicit(own, &range, range + ((unsigned long long)1 << 32),
+                                                memory_order_relaxed, memory_order_relaxed))
+      {
+         *chunk = (size_t)(range >> 32);
+         return 1;
+      }
+   }
+
+   /* Fljderna krymper endast, s en genomskning utan konflikter dr
+      samtliga fljder r tomma innebr att inga delar terstr. */
+   while (contended)
+   {
+      contended = 0;
+
+      for (size_t i = 1; i < job->threads; ++i)
+      {
+         atomic_ullong* victim = &pool.slots[(self + i) % job->threads].range;
+         range = atomic_load_explicit(victim, memory_order_relaxed);
+
+         if ((size_t)(range >> 32) < (size_t)(range & UINT32_MAX))
+         {
+            if (atomic_compare_exchange_strong_explicit(victim, &range, range - 1,
+                                                        memory_order_relaxed,
+                                                        memory_order_relaxed))
+            {
+               *chunk = (size_t)(range & UINT32_MAX) - 1;
+               return 1;
+            }
+
+            contended = 1;
+         }
+      }
+   }
+
+   return 0;
+}
+
+/********************************************************************************
+* work: Bearbetar delar av angivet jobb i angiven trd tills inga delar
+*       terstr. Delarnas grnser lggs p hela cachelinjer rknat frn
+*       vektorns frsta cachelinje.
+*
+*       - job : Pekare till jobbet.
+*       - self: Trdens index.
+********************************************************************************/
+static void work(const struct parallel_job* job,
+                 const size_t self)
+{
+   size_t chunk;
+
+   while (take(job, self, &chunk))
+   {
+      const size_t first = chunk == 0 ? 0 : chunk * job->chunk - job->offset;
+      const size_t last = (chunk + 1) * job->chunk - job->offset;
+      job->run(job->task, chunk, first, last < job->size ? last : job->size);
+   }
+
+   return;
+}
+
+/********************************************************************************
+* worker: Trdfunktion fr trdpoolens trdar, som vntar p nya jobb och
+*         deltar i dem tills trdpoolen avslutas.
+*
+*         - arg: Trdens index, minst 1.
+********************************************************************************/
+static void* worker(void* arg)
+{
+   const size_t self = (size_t)(uintptr_t)arg;
+   unsigned long seen;
+
+   pthread_mutex_lock(&pool.lock);
+   seen = pool.spawned;
+
+   for (;;)
+   {
+      const struct parallel_job* job;
+
+      while (!pool.stop && pool.generation == seen)
+      {
+         pthread_cond_wait(&pool.wake, &pool.lock);
+      }
+
+      if (pool.stop) break;
+      seen = pool.generation;
+      job = pool.job;
+      if (!job || self >= job->threads) continue;
+
+      pthread_mutex_unlock(&pool.lock);
+      work(job, self);
+      pthread_mutex_lock(&pool.lock);
+
+      if (++pool.finished == job->threads - 1) pthread_cond_signal(&pool.done);
+   }
+
+   pthread_mutex_unlock(&pool.lock);
+   return 0;
+}
+
+/********************************************************************************
+* start_workers: Startar trdar i trdpoolen tills den innehller angivet
+*                antal trdar, dock hgst INT_VECTOR_PARALLEL_MAX_THREADS - 1.
+*                Returnerar antalet trdar i poolen, som understiger angivet
+*                antal om minnesallokeringen eller ngon trd inte kunde
+*                startas. Anropas med submit lst.
+*
+*                - count: nskat antal trdar i poolen.
+********************************************************************************/
+static size_t start_workers(const size_t count)
+{
+   if (!pool.slots)
+   {
+      void* memory;
+      if (posix_memalign(&memory, INT_VECTOR_PARALLEL_CACHE_LINE,
+                         sizeof(struct parallel_slot) * INT_VECTOR_PARALLEL_MAX_THREADS)) return 0;
+      pool.slots = (struct parallel_slot*)memory;
+   }
+
+   /* Generationen ndras inte medan submit r lst, s nya trdar deltar i
+      nsta jobb ven om de startar efter att det har brjat. */
+   pthread_mutex_lock(&pool.lock);
+   pool.spawned = pool.generation;
+   pthread_mutex_unlock(&pool.lock);
+
+   while (pool.workers < count && pool.workers + 1 < INT_VECTOR_PARALLEL_MAX_THREADS)
+   {
+      if (pthread_create(&pool.ids[pool.workers], 0, worker,
+                         (void*)(uintptr_t)(pool.workers + 1))) break;
+      pool.workers++;
+   }
+
+   return pool.workers;
+}
+
+/********************************************************************************
+* init_job: Delar upp angivet antal heltal med brjan p angiven adress i
+*           delar om hela cachelinjer, dr den frsta delen kortas av till
+*           vektorns frsta cachelinje, och returnerar antalet delar.
+*
+*           - job : Pekare till jobbet som ska initieras.
+*           - data: Adressen till vektorns frsta heltal.
+*           - size: Antalet heltal i vektorn.
+*           - run : Funktionen som anropas per del.
+*           - task: Pekare till jobbets uppgift.
+********************************************************************************/
+static size_t init_job(struct parallel_job* job,
+                       const int* data,
+                       const size_t size,
+                       void (*run)(void*, const size_t, const size_t, const size_t),
+                       void* task)
+{
+   job->size = size;
+   job->chunk = INT_VECTOR_PARALLEL_CHUNK;
+   job->offset = (size_t)((uintptr_t)data % INT_VECTOR_PARALLEL_CACHE_LINE) / sizeof(int);
+   job->run = run;
+   job->task = task;
+
+   while ((size + job->offset) / job->chunk >= UINT32_MAX) job->chunk *= 2;
+   job->chunks = (size + job->offset + job->chunk - 1) / job->chunk;
+   job->threads = 1;
+   return job->chunks;
+}
+
+/********************************************************************************
+* run_job: Anropar jobbets funktion fr varje del, frdelat p trdpoolens
+*          trdar. Om vektorn r kortare n INT_VECTOR_PARALLEL_MIN_SIZE, om
+*          trdpoolen redan kr ett jobb eller om trdarna inte kan startas
+*          anropas funktionen fr samtliga delar i anropande trd.
+*
+*          - job: Pekare till jobbet, initierat via init_job.
+********************************************************************************/
+static void run_job(struct parallel_job* job)
+{
+   size_t threads = int_vector_parallel_threads();
+   if (threads > job->chunks) threads = job->chunks;
+
+   if (job->size >= INT_VECTOR_PARALLEL_MIN_SIZE && threads > 1 &&
+       pthread_mutex_trylock(&pool.submit) == 0)
+   {
+      job->threads = start_workers(threads - 1) + 1;
+      if (job->threads > threads) job->threads = threads;
+      if (job->threads < 2) pthread_mutex_unlock(&pool.submit);
+   }
+
+   if (job->threads < 2)
+   {
+      for (size_t i = 0; i < job->chunks; ++i)
+      {
+         const size_t first = i == 0 ? 0 : i * job->chunk - job->offset;
+         const size_t last = (i + 1) * job->chunk - job->offset;
+         job->run(job->task, i, first, last < job->size ? last : job->size);
+      }
+      return;
+   }
+
+   for (size_t t = 0; t < job->threads; ++t)
+   {
+      atomic_store_explicit(&pool.slots[t].range,
+                            pack(job->chunks * t / job->threads,
+                                 job->chunks * (t + 1) / job->threads),
+                            memory_order_relaxed);
+   }
+
+   pthread_mutex_lock(&pool.lock);
+   pool.job = job;
+   pool.finished = 0;
+   pool.generation++;
+   pthread_cond_broadcast(&pool.wake);
+   pthread_mutex_unlock(&pool.lock);
+
+   work(job, 0);
+
+   pthread_mutex_lock(&pool.lock);
+   while (pool.finished < job->threads - 1) pthread_cond_wait(&pool.done, &pool.lock);
+   pool.job = 0;
+   pthread_mutex_unlock(&pool.lock);
+
+   pthread_mutex_unlock(&pool.submit);
+   return;
+}
+
+/********************************************************************************
+* transform_task: Strukt fr uppgiften vid int_vector_parallel_transform.
+********************************************************************************/
+struct transform_task
+{
+   int* dst;                          /* Pekare till mlvektorns heltal. */
+   const int* src;                    /* Pekare till kllvektorns heltal. */
+   int_vector_transform_fn transform; /* Funktionen som anropas per heltal. */
+   void* context;                     /* Sammanhang till funktionen. */
+};
+
+/********************************************************************************
+* run_transform: Transformerar heltalen i en del, se run_job.
+********************************************************************************/
+static void run_transform(void* arg,
+                          const size_t chunk,
+                          const size_t first,
+                          const size_t last)
+{
+   const struct transform_task* self = (const struct transform_task*)arg;
+   (void)chunk;
+
+   for (size_t i = first; i < last; ++i)
+   {
+      self->dst[i] = self->transform(self->src[i], self->context);
+   }
+
+   return;
+}
+
+/********************************************************************************
+* for_each_task: Strukt fr uppgiften vid int_vector_parallel_for_each.
+********************************************************************************/
+struct for_each_task
+{
+   int* data;                       /* Pekare till vektorns heltal. */
+   int_vector_for_each_fn for_each; /* Funktionen som anropas per heltal. */
+   void* context;                   /* Sammanhang till funktionen. */
+};
+
+/********************************************************************************
+* run_for_each: Anropar funktionen fr heltalen i en del, se run_job.
+********************************************************************************/
+static void run_for_each(void* arg,
+                         const size_t chunk,
+                         const size_t first,
+                         const size_t last)
+{
+   const struct for_each_task* self = (const struct for_each_task*)arg;
+   (void)chunk;
+
+   for (size_t i = first; i < last; ++i)
+   {
+      self->for_each(self->data + i, i, self->context);
+   }
+
+   return;
+}
+
+/********************************************************************************
+* reduce_task: Strukt fr uppgiften vid int_vector_parallel_reduce.
+********************************************************************************/
+struct reduce_task
+{
+   const int* data;             /* Pekare till vektorns heltal. */
+   long long init;              /* Startvrde fr varje del. */
+   int_vector_reduce_fn reduce; /* Funktionen som anropas per heltal. */
+   void* context;               /* Sammanhang till funktionen. */
+   long long* results;          /* Delresultat per del. */
+};
+
+/********************************************************************************
+* run_reduce: Reducerar heltalen i en del till delens delresultat, se run_job.
+********************************************************************************/
+static void run_reduce(void* arg,
+                       const size_t chunk,
+                       const size_t first,
+                       const size_t last)
+{
+   const struct reduce_task* self = (const struct reduce_task*)arg;
+   long long result = self->init;
+
+   for (size_t i = first; i < last; ++i)
+   {
+      result = self->reduce(result, self->data[i], self->context);
+   }
+
+   self->results[chunk] = result;
+   return;
+}
+
+/********************************************************************************
+* assign_task: Strukt fr uppgiften vid int_vector_parallel_assign.
+********************************************************************************/
+struct assign_task
+{
+   int* data;      /* Pekare till vektorns heltal. */
+   unsigned start; /* Startvrde, teckenlst fr tvkomplementsomslag. */
+   unsigned step;  /* Stegvrde, teckenlst fr tvkomplementsomslag. */
+};
+
+/********************************************************************************
+* run_assign: Tilldelar heltalen i en del via int_simd_assign med startvrdet
+*             fr delens frsta index, se run_job.
+********************************************************************************/
+static void run_assign(void* arg,
+                       const size_t chunk,
+                       const size_t first,
+                       const size_t last)
+{
+   const struct assign_task* self = (const struct assign_task*)arg;
+   (void)chunk;
+   int_simd_assign(self->data + first, last - first,
+                   (int)(self->start + self->step * (unsigned)first), (int)self->step);
+   return;
+}
+
+/********************************************************************************
+* int_vector_set_parallel_threads: Stter det hgsta antalet trdar som
+*                                  anvnds av trdpoolen.
+*
+*                                  - threads: Det nya antalet trdar.
+********************************************************************************/
+void int_vector_set_parallel_threads(const size_t threads)
+{
+   parallel_threads = threads;
+   return;
+}
+
+/********************************************************************************
+* int_vector_parallel_threads: Returnerar det hgsta antalet trdar som
+*                              anvnds av trdpoolen.
+********************************************************************************/
+size_t int_vector_parallel_threads(void)
+{
+   if (parallel_threads == 0)
+   {
+      const long cores = sysconf(_SC_NPROCESSORS_ONLN);
+      return cores > 0 ? (size_t)cores : 1;
+   }
+
+   return parallel_threads;
+}
+
+/********************************************************************************
+* int_vector_parallel_shutdown: Avslutar trdpoolens trdar och frigr dess
+*                               minne.
+********************************************************************************/
+void int_vector_parallel_shutdown(void)
+{
+   pthread_mutex_lock(&pool.submit);
+   pthread_mutex_lock(&pool.lock);
+   pool.stop = 1;
+   pthread_cond_broadcast(&pool.wake);
+   pthread_mutex_unlock(&pool.lock);
+
+   for (size_t i = 0; i < pool.workers; ++i)
+   {
+      pthread_join(pool.ids[i], 0);
+   }
+
+   free(pool.slots);
+   pool.slots = 0;
+   pool.workers = 0;
+   pool.stop = 0;
+   pthread_mutex_unlock(&pool.submit);
+   return;
+}
+
+/********************************************************************************
+* int_vector_parallel_transform: Tilldelar mlvektorn returvrdena frn
+*                                angiven funktion fr kllvektorns heltal.
+*
+*                                - dst      : Pekare till mlvektorn.
+*                                - src      : Pekare till kllvektorn.
+*                                - transform: Funktionen som anropas per heltal.
+*                                - context  : Sammanhang till funktionen.
+********************************************************************************/
+int int_vector_parallel_transform(struct int_vector* dst,
+                                  const struct int_vector* src,
+                                  int_vector_transform_fn transform,
+                                  void* context)
+{
+   struct parallel_job job;
+   struct transform_task task;
+   if (dst->borrowed) return 1;
+   if (dst != src && int_vector_resize(dst, src->size)) return 1;
+
+   task.dst = dst->data;
+   task.src = src->data;
+   task.transform = transform;
+   task.context = context;
+   init_job(&job, task.dst, dst->size, run_transform, &task);
+   run_job(&job);
+   return 0;
+}
+
+/********************************************************************************
+* int_vector_parallel_for_each: Anropar angiven funktion fr varje heltal i
+*                               angiven vektor.
+*
+*                               - self    : Pekare till vektorn.
+*                               - for_each: Funktionen som anropas per heltal.
+*                               - context : Sammanhang till funktionen.
+********************************************************************************/
+void int_vector_parallel_for_each(struct int_vector* self,
+                                  int_vector_for_each_fn for_each,
+                                  void* context)
+{
+   struct parallel_job job;
+   struct for_each_task task;
+   if (self->borrowed) return;
+   task.data = self->data;
+   task.for_each = for_each;
+   task.context = context;
+   init_job(&job, self->data, self->size, run_for_each, &task);
+   run_job(&job);
+   return;
+}
+
+/********************************************************************************
+* int_vector_parallel_reduce: Returnerar heltalen i angiven vektor
+*                             kombinerade till ett resultat. Om
+*                             minnesallokeringen fr delresultaten
+*                             misslyckas reduceras vektorn i anropande trd
+*                             som en enda del.
+*
+*                             - self   : Pekare till vektorn.
+*                             - init   : Startvrde fr varje del.
+*                             - reduce : Funktionen som anropas per heltal.
+*                             - combine: Funktionen som kombinerar delresultat.
+*                             - context: Sammanhang till funktionerna.
+********************************************************************************/
+long long int_vector_parallel_reduce(const struct int_vector* self,
+                                     const long long init,
+                                     int_vector_reduce_fn reduce,
+                                     int_vector_combine_fn combine,
+                                     void* context)
+{
+   struct parallel_job job;
+   struct reduce_task task;
+   const size_t chunks = init_job(&job, self->data, self->size, run_reduce, &task);
+   long long result = init;
+
+   task.data = self->data;
+   task.init = init;
+   task.reduce = reduce;
+   task.context = context;
+   task.results = (long long*)malloc(sizeof(long long) * chunks);
+
+   if (!task.results)
+   {
+      for (size_t i = 0; i < self->size; ++i)
+      {
+         result = reduce(result, self->data[i], context);
+      }
+      return result;
+   }
+
+   run_job(&job);
+
+   for (size_t i = 0; i < chunks; ++i)
+   {
+      result = i == 0 ? task.results[0] : combine(result, task.results[i], context);
+   }
+
+   free(task.results);
+   return result;
+}
+
+/********************************************************************************
+* int_vector_parallel_assign: Tilldelar heltal till angiven vektor p samma
+*                             stt som int_vector_assign, frdelat p flera
+*                             trdar.
+*
+*                             - self     : Pekare till vektorn som ska tilldelas.
+*                             - start_val: Startvrde fr tilldelningen.
+*                             - step_val : Stegvrde.
+********************************************************************************/
+void int_vector_parallel_assign(struct int_vector* self,
+                                const int start_val,
+                                const int step_val)
+{
+   struct parallel_job job;
+   struct assign_task task;
+   if (self->borrowed) return;
+   task.data = self->data;
+   task.start = (unsigned)start_val;
+   task.step = (unsigned)step_val;
+   init_job(&job, self->data, self->size, run_assign, &task);
+   run_job(&job);
+   return;
+}
\ No newline at end of file
@@ -0,0 +1,200 @@
+/********************************************************************************
+* int_vector_parallel.h: Innehller flertrdade elementvisa operationer p
+*                        vektorer via en inbyggd trdpool.
+*
+*                        Elementvisa operationer, ssom int_vector_assign,
+*                        krs annars av en enda trd ven fr vektorer med
+*                        hundratals miljoner heltal. Hr delas vektorn i
+*                        stllet upp i delar om INT_VECTOR_PARALLEL_CHUNK
+*                        heltal, vars grnser ligger p hela cachelinjer,
+*                        s att tv trdar aldrig skriver till samma
+*                        cachelinje. Varje trd tilldelas en fljd av delar
+*                        och tar delar framifrn i sin egen fljd. Nr den
+*                        egna fljden r slut stjls delar bakifrn i vriga
+*                        trdars fljder, s att trdar som blir klara
+*                        tidigt avlastar trdar med dyrare delar.
+*
+*                        Trdarna skapas vid frsta anropet och vntar
+*                        drefter p nya jobb, s att kostnaden fr att
+*                        starta trdar endast uppstr en gng. Anropande
+*                        trd deltar i varje jobb. Vektorer med frre n
+*                        INT_VECTOR_PARALLEL_MIN_SIZE heltal bearbetas
+*                        direkt i anropande trd, liksom anrop som grs
+*                        medan trdpoolen redan kr ett jobb, exempelvis
+*                        frn en annan trd eller frn en anropad funktion.
+*
+*                        Angivna funktioner anropas samtidigt frn flera
+*                        trdar, i godtycklig ordning mellan delarna, och
+*                        mste drmed tla samtidig tkomst till angivet
+*                        sammanhang.
+********************************************************************************/
+#ifndef INT_VECTOR_PARALLEL_H_
+#define INT_VECTOR_PARALLEL_H_
+
+/* Inkluderingsdirektiv: */
+#include "int_vector.h"
+
+/********************************************************************************
+* INT_VECTOR_PARALLEL_CHUNK: Antalet heltal per del, som mste vara en
+*                            multipel av antalet heltal per cachelinje.
+********************************************************************************/
+#ifndef INT_VECTOR_PARALLEL_CHUNK
+#define INT_VECTOR_PARALLEL_CHUNK 16384
+#endif
+
+/********************************************************************************
+* INT_VECTOR_PARALLEL_MIN_SIZE: Minsta antalet heltal som delas upp p flera
+*                               trdar. Kortare vektorer bearbetas i
+*                               anropande trd, s att kostnaden fr att
+*                               vcka trdarna inte verstiger vinsten.
+********************************************************************************/
+#ifndef INT_VECTOR_PARALLEL_MIN_SIZE
+#define INT_VECTOR_PARALLEL_MIN_SIZE 65536
+#endif
+
+/********************************************************************************
+* INT_VECTOR_PARALLEL_MAX_THREADS: Hgsta antalet trdar i trdpoolen,
+*                                  inklusive anropande trd.
+********************************************************************************/
+#ifndef INT_VECTOR_PARALLEL_MAX_THREADS
+#define INT_VECTOR_PARALLEL_MAX_THREADS 64
+#endif
+
+/********************************************************************************
+* INT_VECTOR_PARALLEL_CACHE_LINE: Storleken p en cachelinje i byte, som
+*                                 delarnas grnser samt trdarnas fljder
+*                                 av delar justeras efter.
+********************************************************************************/
+#ifndef INT_VECTOR_PARALLEL_CACHE_LINE
+#define INT_VECTOR_PARALLEL_CACHE_LINE 64
+#endif
+
+/********************************************************************************
+* int_vector_transform_fn: Pekare till en funktion som returnerar det nya
+*                          vrdet fr angivet heltal.
+********************************************************************************/
+typedef int (*int_vector_transform_fn)(const int num,
+                                       void* context);
+
+/********************************************************************************
+* int_vector_for_each_fn: Pekare till en funktion som anropas fr angivet
+*                         heltal och dess index i vektorn. Heltalet fr
+*                         ndras via pekaren.
+********************************************************************************/
+typedef void (*int_vector_for_each_fn)(int* num,
+                                       const size_t index,
+                                       void* context);
+
+/********************************************************************************
+* int_vector_reduce_fn: Pekare till en funktion som returnerar angivet
+*                       delresultat kombinerat med angivet heltal.
+********************************************************************************/
+typedef long long (*int_vector_reduce_fn)(const long long result,
+                                          const int num,
+                                          void* context);
+
+/********************************************************************************
+* int_vector_combine_fn: Pekare till en funktion som returnerar tv
+*                        delresultat kombinerade till ett.
+********************************************************************************/
+typedef long long (*int_vector_combine_fn)(const long long first,
+                                           const long long second,
+                                           void* context);
+
+/********************************************************************************
+* int_vector_set_parallel_threads: Stter det hgsta antalet trdar som
+*                                  anvnds av trdpoolen, dr 0 innebr
+*                                  antalet tillgngliga processorkrnor
+*                                  (default).
+*
+*                                  - threads: Det nya antalet trdar.
+********************************************************************************/
+void int_vector_set_parallel_threads(const size_t threads);
+
+/********************************************************************************
+* int_vector_parallel_threads: Returnerar det hgsta antalet trdar som
+*                              anvnds av trdpoolen, dr 0 har ersatts med
+*                              antalet tillgngliga processorkrnor.
+********************************************************************************/
+size_t int_vector_parallel_threads(void);
+
+/********************************************************************************
+* int_vector_parallel_shutdown: Avslutar trdpoolens trdar och frigr dess
+*                               minne. Trdpoolen startas p nytt vid nsta
+*                               anrop som delas upp p flera trdar.
+********************************************************************************/
+void int_vector_parallel_shutdown(void);
+
+/********************************************************************************
+* int_vector_parallel_transform: Tilldelar mlvektorn lika mnga heltal som
+*                                kllvektorn, dr varje heltal r
+*                                returvrdet frn angiven funktion fr
+*                                motsvarande heltal i kllvektorn.
+*                                Mlvektorn fr vara samma vektor som
+*                                kllvektorn. Vid lyckad minnesallokering
+*                                returneras 0. Om minnesallokeringen
+*                                misslyckas eller om mlvektorn har lnat
+*                                minne returneras felkod 1 och mlvektorn
+*                                lmnas intakt.
+*
+*                                - dst      : Pekare till mlvektorn.
+*                                - src      : Pekare till kllvektorn.
+*                                - transform: Funktionen som anropas per heltal.
+*                                - context  : Sammanhang till funktionen (eller null).
+********************************************************************************/
+int int_vector_parallel_transform(struct int_vector* dst,
+                                  const struct int_vector* src,
+                                  int_vector_transform_fn transform,
+                                  void* context);
+
+/********************************************************************************
+* int_vector_parallel_for_each: Anropar angiven funktion fr varje heltal i
+*                               angiven vektor.
+*
+*                               - self    : Pekare till vektorn.
+*                               - for_each: Funktionen som anropas per heltal.
+*                               - context : Sammanhang till funktionen (eller null).
+********************************************************************************/
+void int_vector_parallel_for_each(struct int_vector* self,
+                                  int_vector_for_each_fn for_each,
+                                  void* context);
+
+/********************************************************************************
+* int_vector_parallel_reduce: Returnerar heltalen i angiven vektor
+*                             kombinerade till ett resultat. Varje del
+*                             reduceras fr sig med brjan p angivet
+*                             startvrde, varefter delresultaten kombineras
+*                             i vektorns ordning. Resultatet r drmed
+*                             oberoende av antalet trdar, men startvrdet
+*                             mste vara neutralt fr kombinationen,
+*                             exempelvis 0 vid summering. Om vektorn r tom
+*                             returneras startvrdet.
+*
+*                             - self   : Pekare till vektorn.
+*                             - init   : Startvrde fr varje del.
+*                             - reduce : Funktionen som anropas per heltal.
+*                             - combine: Funktionen som kombinerar delresultat.
+*                             - context: Sammanhang till funktionerna (eller null).
+********************************************************************************/
+long long int_vector_parallel_reduce(const struct int_vector* self,
+                                     const long long init,
+                                     int_vector_reduce_fn reduce,
+                                     int_vector_combine_fn combine,
+                                     void* context);
+
+/********************************************************************************
+* int_vector_parallel_assign: Tilldelar heltal till angiven vektor p samma
+*                             stt som int_vector_assign, dr delarna
+*                             tilldelas av flera trdar. Resultatet r
+*                             bitexakt lika med int_vector_assign.
+*
+*                             - self     : Pekare till vektorn som ska tilldelas.
+*                             - start_val: Startvrde fr tilldelningen.
+*                             - step_val : Stegvrde, dvs. differensen mellan
+*                                          varje heltal.
+********************************************************************************/
+void int_vector_parallel_assign(struct int_vector* self,
+                                const int start_val,
+                                const int step_val);
+
+#endif /* INT_VECTOR_PARALLEL_H_ */
\ No newline at end of file
@@ -0,0 +1,135 @@
+/********************************************************************************
+* int_vector_shared.c: Innehller definitioner av associerade funktioner fr
+*                      strukten int_vector_shared.
+********************************************************************************/
+#include "int_vector_shared.h"
+
+/********************************************************************************
+* new_block: Returnerar en ny delad vektor med en gare, vars vektor r tom
+*            och anvnder angiven allokerare. Om minnesallokeringen
+*            misslyckas returneras null.
+*
+*            - allocator: Pekare till vektorns allokerare (null = malloc).
+********************************************************************************/
+static struct int_vector_shared_block* new_block(const struct allocator* allocator)
+{
+   struct int_vector_shared_block* block =
+      (struct int_vector_shared_block*)malloc(sizeof(struct int_vector_shared_block));
+   if (!block) return 0;
+   atomic_init(&block->references, 1);
+   int_vector_init_with(&block->vector, allocator);
+   return block;
+}
+
+/********************************************************************************
+* int_vector_share: Flyttar elementen i angiven vektor till en ny delad vektor.
+*
+*                   - self  : Pekare till referensen.
+*                   - vector: Pekare till vektorn vars element ska delas.
+********************************************************************************/
+int int_vector_share(struct int_vector_shared* self,
+                     struct int_vector* vector)
+{
+   struct int_vector_shared_block* block = new_block(vector->allocator);
+   if (!block) return 1;
+
+   if (int_vector_is_small(vector))
+   {
+      int_vector_append(&block->vector, vector->data, vector->size);
+   }
+   else
+   {
+      /* Lnat minne frblir lnat, s att det kopieras vid frsta ndringen. */
+      block->vector.data = vector->data;
+      block->vector.size = vector->size;
+      block->vector.capacity = vector->capacity;
+      block->vector.borrowed = vector->borrowed;
+   }
+
+   int_vector_init_with(vector, vector->allocator);
+   int_vector_shared_release(self);
+   self->block = block;
+   return 0;
+}
+
+/********************************************************************************
+* int_vector_shared_copy: Lter angiven referens dela angiven referens vektor.
+*
+*                         - dst: Pekare till referensen som ska dela vektorn.
+*                         - src: Pekare till referensen som ska kopieras.
+********************************************************************************/
+void int_vector_shared_copy(struct int_vector_shared* dst,
+                            const struct int_vector_shared* src)
+{
+   struct int_vector_shared_block* block = src->block;
+   if (block) atomic_fetch_add_explicit(&block->references, 1, memory_order_relaxed);
+   int_vector_shared_release(dst);
+   dst->block = block;
+   return;
+}
+
+/********************************************************************************
+* int_vector_shared_release: Slpper angiven referens vektor och frigr den
+*                            nr den sista garen har slppt den.
+*
+*                            - self: Pekare till referensen.
+********************************************************************************/
+void int_vector_shared_release(struct int_vector_shared* self)
+{
+   struct int_vector_shared_block* block = self->block;
+   self->block = 0;
+
+   if (block && atomic_fetch_sub_explicit(&block->references, 1, memory_order_acq_rel) == 1)
+   {
+      int_vector_clear(&block->vector);
+      free(block);
+   }
+
+   return;
+}
+
+/********************************************************************************
+* int_vector_shared_references: Returnerar antalet gare av angiven referens
+*                               vektor.
+*
+*                               - self: Pekare till referensen.
+********************************************************************************/
+size_t int_vector_shared_references(const struct int_vector_shared* self)
+{
+   if (!self->block) return 0;
+   return atomic_load_explicit(&self->block->references, memory_order_acquire);
+}
+
+/********************************************************************************
+* int_vector_shared_mut: Returnerar en pekare till angiven referens vektor fr
+*                        ndring, dr elementen frst kopieras om vektorn
+*                        delas med andra gare eller lagras i lnat minne.
+*
+*                        - self: Pekare till referensen.
+********************************************************************************/
+struct int_vector* int_vector_shared_mut(struct int_vector_shared* self)
+{
+   struct int_vector_shared_block* block = self->block;
+
+   if (!block)
+   {
+      if (!(self->block = new_block(0))) return 0;
+      return &self->block->vector;
+   }
+
+   /* Lnat minne, exempelvis en minnesmappad fil, kopieras ven utan andra
+      gare, eftersom det inte fr ndras. */
+   if (int_vector_shared_references(self) == 1 &&
+       !int_vector_is_borrowed(&block->vector)) return &block->vector;
+   if (!(block = new_block(self->block->vector.allocator))) return 0;
+
+   if (int_vector_append(&block->vector, self->block->vector.data, self->block->vector.size))
+   {
+      free(block);
+      return 0;
+   }
+
+   int_vector_shared_release(self);
+   self->block = block;
+   return &block->vector;
+}
\ No newline at end of file
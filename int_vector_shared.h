@@ -0,0 +1,151 @@
+/********************************************************************************
+* int_vector_shared.h: Innehller strukten int_vector_shared, en referens till
+*                      en vektor som delas mellan flera gare via
+*                      referensrkning och kopiering vid skrivning
+*                      (copy-on-write), samt associerade funktioner.
+*
+*                      Nr samma stora vektor lmnas till flera steg i ett
+*                      flde kopieras den i dag i sin helhet per steg. En
+*                      delad vektor kopieras i stllet i konstant tid via
+*                      int_vector_shared_copy, varvid endast en rknare
+*                      rknas upp. Samtliga gare lser samma element via
+*                      int_vector_shared_get eller int_vector_shared_view.
+*                      Frst nr en gare vill ndra vektorn via
+*                      int_vector_shared_mut kopieras elementen, och endast
+*                      om vektorn fortfarande delas med ngon annan gare.
+*
+*                      Referensrknaren uppdateras atomiskt, s att garna
+*                      kan finnas i olika trdar. En enskild
+*                      int_vector_shared fr dock inte anvndas av flera
+*                      trdar samtidigt.
+********************************************************************************/
+#ifndef INT_VECTOR_SHARED_H_
+#define INT_VECTOR_SHARED_H_
+
+/* Inkluderingsdirektiv: */
+#include <stdatomic.h> /* Innehller atomic_size_t. */
+
+#include "int_vector.h"
+#include "int_vector_view.h"
+
+/********************************************************************************
+* int_vector_shared_block: Strukt fr en delad vektor samt antalet gare.
+********************************************************************************/
+struct int_vector_shared_block
+{
+   atomic_size_t references; /* Antalet gare av vektorn. */
+   struct int_vector vector; /* Den delade vektorn. */
+};
+
+/********************************************************************************
+* int_vector_shared: Strukt fr en gares referens till en delad vektor. En
+*                    tom referens pekar inte p ngon vektor. Strukten fr
+*                    inte kopieras via tilldelning, utan via
+*                    int_vector_shared_copy.
+********************************************************************************/
+struct int_vector_shared
+{
+   struct int_vector_shared_block* block; /* Den delade vektorn (eller null). */
+};
+
+/********************************************************************************
+* int_vector_shared_init: Initierar ny tom referens.
+*
+*                         - self: Pekare till referensen som ska initieras.
+********************************************************************************/
+static inline void int_vector_shared_init(struct int_vector_shared* self)
+{
+   self->block = 0;
+   return;
+}
+
+/********************************************************************************
+* int_vector_share: Flyttar elementen i angiven vektor till en ny delad vektor
+*                   som angiven referens blir ensam gare av, varefter
+*                   vektorn tms. Element p heapen flyttas utan kopiering,
+*                   medan element i den inbyggda bufferten kopieras.
+*                   Lnat minne, se int_vector_is_borrowed, flyttas p
+*                   samma stt men frblir lnat, s att det mste finnas
+*                   kvar s lnge vektorn delas och kopieras vid frsta
+*                   anropet till int_vector_shared_mut.
+*                   Referensens tidigare vektor slpps. Vid lyckad
+*                   minnesallokering returneras 0, annars returneras felkod 1
+*                   och vektorn lmnas intakt.
+*
+*                   - self  : Pekare till referensen.
+*                   - vector: Pekare till vektorn vars element ska delas.
+********************************************************************************/
+int int_vector_share(struct int_vector_shared* self,
+                     struct int_vector* vector);
+
+/********************************************************************************
+* int_vector_shared_copy: Lter angiven referens dela angiven referens vektor
+*                         i konstant tid, utan att elementen kopieras.
+*                         Mlets tidigare vektor slpps.
+*
+*                         - dst: Pekare till referensen som ska dela vektorn.
+*                         - src: Pekare till referensen som ska kopieras.
+********************************************************************************/
+void int_vector_shared_copy(struct int_vector_shared* dst,
+                            const struct int_vector_shared* src);
+
+/********************************************************************************
+* int_vector_shared_release: Slpper angiven referens vektor, som frigrs nr
+*                            den sista garen har slppt den, varefter
+*                            referensen r tom.
+*
+*                            - self: Pekare till referensen.
+********************************************************************************/
+void int_vector_shared_release(struct int_vector_shared* self);
+
+/********************************************************************************
+* int_vector_shared_references: Returnerar antalet gare av angiven referens
+*                               vektor, eller 0 om referensen r tom.
+*
+*                               - self: Pekare till referensen.
+********************************************************************************/
+size_t int_vector_shared_references(const struct int_vector_shared* self);
+
+/********************************************************************************
+* int_vector_shared_get: Returnerar en skrivskyddad pekare till angiven
+*                        referens vektor fr lsning via befintliga
+*                        funktioner, exempelvis int_vector_sum, eller null om
+*                        referensen r tom. Elementen fr inte ndras via
+*                        pekaren.
+*
+*                        - self: Pekare till referensen.
+********************************************************************************/
+static inline const struct int_vector* int_vector_shared_get(const struct int_vector_shared* self)
+{
+   return self->block ? &self->block->vector : 0;
+}
+
+/********************************************************************************
+* int_vector_shared_view: Returnerar en vy av samtliga heltal i angiven
+*                         referens vektor, eller en tom vy om referensen r
+*                         tom.
+*
+*                         - self: Pekare till referensen.
+********************************************************************************/
+static inline struct int_vector_view int_vector_shared_view(const struct int_vector_shared* self)
+{
+   return self->block ? int_vector_view_of(&self->block->vector) : int_vector_view_array(0, 0);
+}
+
+/********************************************************************************
+* int_vector_shared_mut: Returnerar en pekare till angiven referens vektor fr
+*                        ndring. Om vektorn delas med andra gare kopieras
+*                        elementen frst till en ny vektor som referensen
+*                        blir ensam gare av, via samma allokerare, medan
+*                        vriga gare behller den ursprungliga. Detsamma
+*                        gller en vektor med lnat minne. En tom
+*                        referens tilldelas en ny tom vektor. Pekaren r
+*                        giltig tills referensen kopieras eller slpps. Om
+*                        minnesallokeringen misslyckas returneras null och
+*                        referensen lmnas intakt.
+*
+*                        - self: Pekare till referensen.
+********************************************************************************/
+struct int_vector* int_vector_shared_mut(struct int_vector_shared* self);
+
+#endif /* INT_VECTOR_SHARED_H_ */
\ No newline at end of file
@@ -0,0 +1,404 @@
+/********************************************************************************
+* int_vector_sort.c: Innehller definitioner av sortering av vektorer via
+*                    flertrdad radixsortering samt operationer p sorterade
+*                    vektorer.
+********************************************************************************/
+#define _POSIX_C_SOURCE 200809L /* Krvs fr sysconf. */
+#include "int_vector_sort.h"
+
+#include <pthread.h> /* Innehller pthread_create och pthread_join. */
+#include <stdint.h>  /* Innehller SIZE_MAX. */
+#include <string.h>  /* Innehller memcpy och memset. */
+#include <unistd.h>  /* Innehller sysconf. */
+
+/********************************************************************************
+* Parametrar fr radixsorteringen, dr heltalen sorteras i RADIX_PASSES pass
+* om hgst RADIX_BITS bitar per siffra, dvs. RADIX_BUCKETS hinkar per pass.
+********************************************************************************/
+#define RADIX_BITS    11
+#define RADIX_BUCKETS (1 << RADIX_BITS)
+#define RADIX_PASSES  3
+
+/********************************************************************************
+* sort_task: Strukt fr en trds andel av ett radixpass, dvs. ett segment av
+*            kllfltet samt trdens histogram, som efter histogramfasen
+*            erstts med trdens startpositioner i mlfltet per hink.
+********************************************************************************/
+struct sort_task
+{
+   const int* src;               /* Pekare till kllfltet. */
+   int* dst;                     /* Pekare till mlfltet. */
+   size_t begin;                 /* Index fr segmentets frsta heltal. */
+   size_t end;                   /* Index efter segmentets sista heltal. */
+   unsigned shift;               /* Antalet bitar som siffran skiftas. */
+   size_t count[RADIX_BUCKETS];  /* Antal per hink, sedan startpositioner. */
+};
+
+/* Statiska variabler: */
+static size_t sort_threads = 0; /* Hgsta antal trdar, 0 = antalet krnor. */
+
+/********************************************************************************
+* digit: Returnerar siffran fr angivet heltal i ett radixpass. Teckenbiten
+*        vnds, s att negativa tal sorteras fre positiva.
+*
+*        - num  : Heltalet.
+*        - shift: Antalet bitar som siffran skiftas.
+********************************************************************************/
+static inline size_t digit(const int num,
+                           const unsigned shift)
+{
+   return (((unsigned)num ^ 0x80000000u) >> shift) & (RADIX_BUCKETS - 1);
+}
+
+/********************************************************************************
+* insertion_sort: Sorterar angivet flt via insttningssortering, vilket gr
+*                 fortare n radixsortering fr korta flt.
+*
+*                 - data: Pekare till fltet som ska sorteras.
+*                 - size: Antalet heltal i fltet.
+********************************************************************************/
+static void insertion_sort(int* data,
+                           const size_t size)
+{
+   for (size_t i = 1; i < size; ++i)
+   {
+      const int num = data[i];
+      size_t j = i;
+
+      while (j > 0 && data[j - 1] > num)
+      {
+         data[j] = data[j - 1];
+         --j;
+      }
+
+      data[j] = num;
+   }
+
+   return;
+}
+
+/********************************************************************************
+* histogram_task: Rknar antalet heltal per hink i angiven trds segment.
+*                 Anvnds som trdfunktion.
+*
+*                 - arg: Pekare till trdens sort_task.
+********************************************************************************/
+static void* histogram_task(void* arg)
+{
+   struct sort_task* self = (struct sort_task*)arg;
+   memset(self->count, 0, sizeof(self->count));
+
+   for (size_t i = self->begin; i < self->end; ++i)
+   {
+      self->count[digit(self->src[i], self->shift)]++;
+   }
+
+   return 0;
+}
+
+/********************************************************************************
+* scatter_task: Flyttar heltalen i angiven trds segment till sina hinkar i
+*               mlfltet, med brjan p trdens startpositioner. Anvnds
+*               som trdfunktion.
+*
+*               - arg: Pekare till trdens sort_task.
+********************************************************************************/
+static void* scatter_task(void* arg)
+{
+   struct sort_task* self = (struct sort_task*)arg;
+
+   for (size_t i = self->begin; i < self->end; ++i)
+   {
+      const int num = self->src[i];
+      self->dst[self->count[digit(num, self->shift)]++] = num;
+   }
+
+   return 0;
+}
+
+/********************************************************************************
+* run_tasks: Kr angiven trdfunktion fr samtliga uppgifter, dr den frsta
+*            uppgiften krs i anropande trd och vriga i nya trdar. Om en
+*            trd inte kan skapas krs dess uppgift i anropande trd.
+*
+*            - tasks   : Pekare till fltet med uppgifter.
+*            - count   : Antalet uppgifter.
+*            - function: Trdfunktionen som ska kras.
+*            - threads : Pekare till flt fr trdarnas identiteter.
+*            - started : Pekare till flt som indikerar startade trdar.
+********************************************************************************/
+static void run_tasks(struct sort_task* tasks,
+                      const size_t count,
+                      void* (*function)(void*),
+                      pthread_t* threads,
+                      int* started)
+{
+   for (size_t i = 1; i < count; ++i)
+   {
+      started[i] = pthread_create(&threads[i], 0, function, &tasks[i]) == 0;
+   }
+
+   function(&tasks[0]);
+
+   for (size_t i = 1; i < count; ++i)
+   {
+      if (started[i]) pthread_join(threads[i], 0);
+      else function(&tasks[i]);
+   }
+
+   return;
+}
+
+/********************************************************************************
+* radix_sort: Sorterar angivet flt via LSD-radixsortering med angivet antal
+*             trdar, dr angivet extra flt anvnds som ml varannat pass.
+*             Vid lyckad sortering returneras 0. Om minnesallokeringen fr
+*             trdarnas uppgifter misslyckas returneras felkod 1 och fltet
+*             lmnas intakt.
+*
+*             - data   : Pekare till fltet som ska sorteras.
+*             - scratch: Pekare till ett extra flt av samma storlek.
+*             - size   : Antalet heltal i flten.
+*             - threads: Antalet trdar (minst 1).
+********************************************************************************/
+static int radix_sort(int* data,
+                      int* scratch,
+                      const size_t size,
+                      const size_t threads)
+{
+   struct sort_task* tasks = (struct sort_task*)malloc(sizeof(struct sort_task) * threads);
+   pthread_t* ids = (pthread_t*)malloc(sizeof(pthread_t) * threads);
+   int* started = (int*)malloc(sizeof(int) * threads);
+   const int* src = data;
+   int* dst = scratch;
+
+   if (!tasks || !ids || !started)
+   {
+      free(tasks);
+      free(ids);
+      free(started);
+      return 1;
+   }
+
+   for (unsigned pass = 0; pass < RADIX_PASSES; ++pass)
+   {
+      const unsigned shift = pass * RADIX_BITS;
+      size_t position = 0;
+      int skip = 0;
+
+      for (size_t t = 0; t < threads; ++t)
+      {
+         tasks[t].src = src;
+         tasks[t].dst = dst;
+         tasks[t].begin = size / threads * t;
+         tasks[t].end = t + 1 < threads ? size / threads * (t + 1) : size;
+         tasks[t].shift = shift;
+      }
+
+      run_tasks(tasks, threads, histogram_task, ids, started);
+
+      /* Startpositionerna lggs ut hink fr hink och inom varje hink trd
+         fr trd, vilket gr sorteringen stabil. */
+      for (size_t b = 0; b < RADIX_BUCKETS && !skip; ++b)
+      {
+         const size_t start = position;
+
+         for (size_t t = 0; t < threads; ++t)
+         {
+            const size_t count = tasks[t].count[b];
+            tasks[t].count[b] = position;
+            position += count;
+         }
+
+         skip = position - start == size;
+      }
+
+      if (skip) continue;
+      run_tasks(tasks, threads, scatter_task, ids, started);
+      src = dst;
+      dst = dst == scratch ? data : scratch;
+   }
+
+   if (src != data) memcpy(data, src, sizeof(int) * size);
+   free(tasks);
+   free(ids);
+   free(started);
+   return 0;
+}
+
+/********************************************************************************
+* int_vector_set_sort_threads: Stter det hgsta antalet trdar som anvnds
+*                              vid sortering, dr 0 innebr antalet
+*                              tillgngliga processorkrnor (default).
+*
+*                              - threads: Det nya antalet trdar.
+********************************************************************************/
+void int_vector_set_sort_threads(const size_t threads)
+{
+   sort_threads = threads;
+   return;
+}
+
+/********************************************************************************
+* int_vector_sort_threads: Returnerar det hgsta antalet trdar som anvnds
+*                          vid sortering, dr 0 har ersatts med antalet
+*                          tillgngliga processorkrnor.
+********************************************************************************/
+size_t int_vector_sort_threads(void)
+{
+   if (sort_threads == 0)
+   {
+      const long cores = sysconf(_SC_NPROCESSORS_ONLN);
+      return cores > 0 ? (size_t)cores : 1;
+   }
+
+   return sort_threads;
+}
+
+/********************************************************************************
+* int_vector_sort: Sorterar heltalen i angiven vektor i stigande ordning.
+*                  Sorteringen krver ett extra flt fr lika mnga heltal
+*                  som vektorn rymmer. Om ett sdant flt anges anvnds det,
+*                  annars allokeras fltet via vektorns allokerare under
+*                  sorteringen. Vid lyckad sortering returneras 0. Om
+*                  minnesallokeringen misslyckas returneras felkod 1 och
+*                  vektorn lmnas intakt.
+*
+*                  - self   : Pekare till vektorn som ska sorteras.
+*                  - scratch: Pekare till ett flt som rymmer minst lika
+*                             mnga heltal som vektorn (eller null).
+********************************************************************************/
+int int_vector_sort(struct int_vector* self,
+                    int* scratch)
+{
+   size_t threads = int_vector_sort_threads();
+   int* buffer = scratch;
+   int status;
+
+   if (self->borrowed) return 1;
+
+   if (self->size <= INT_VECTOR_SORT_INSERTION_LIMIT)
+   {
+      insertion_sort(self->data, self->size);
+      return 0;
+   }
+
+   if (!buffer)
+   {
+      buffer = (int*)allocator_alloc(self->allocator, sizeof(int) * self->size);
+      if (!buffer) return 1;
+      INT_VECTOR_STATS_ALLOC(sizeof(int) * self->size);
+   }
+
+   if (threads > self->size / INT_VECTOR_SORT_MIN_CHUNK)
+   {
+      threads = self->size / INT_VECTOR_SORT_MIN_CHUNK;
+   }
+
+   status = radix_sort(self->data, buffer, self->size, threads > 0 ? threads : 1);
+   if (!scratch)
+   {
+      allocator_free(self->allocator, buffer, sizeof(int) * self->size);
+      INT_VECTOR_STATS_FREE(sizeof(int) * self->size);
+   }
+   return status;
+}
+
+/********************************************************************************
+* int_vector_lower_bound: Returnerar index fr frsta heltalet i angiven
+*                         sorterad vektor som inte understiger angivet vrde,
+*                         dvs. den position dr vrdet kan infogas utan att
+*                         ordningen bryts. Om samtliga heltal understiger
+*                         vrdet returneras vektorns storlek.
+*
+*                         - self : Pekare till den sorterade vektorn.
+*                         - value: Vrdet som ska skas efter.
+********************************************************************************/
+size_t int_vector_lower_bound(const struct int_vector* self,
+                              const int value)
+{
+   size_t first = 0, length = self->size;
+
+   while (length > 0)
+   {
+      const size_t half = length / 2;
+
+      if (self->data[first + half] < value)
+      {
+         first += half + 1;
+         length -= half + 1;
+      }
+      else
+      {
+         length = half;
+      }
+   }
+
+   return first;
+}
+
+/********************************************************************************
+* int_vector_unique: Tar bort intilliggande dubbletter i angiven vektor, s
+*                    att en sorterad vektor endast innehller unika heltal.
+*                    Ordningen mellan kvarvarande heltal bibehlls och
+*                    kapaciteten minskas enligt samma lgvattenmrke som vid
+*                    popoperationer. Returnerar antalet borttagna heltal.
+*
+*                    - self: Pekare till vektorn.
+********************************************************************************/
+size_t int_vector_unique(struct int_vector* self)
+{
+   const size_t size = self->size;
+   size_t count = 1;
+
+   if (size < 2 || self->borrowed) return 0;
+
+   for (size_t i = 1; i < size; ++i)
+   {
+      if (self->data[i] != self->data[count - 1]) self->data[count++] = self->data[i];
+   }
+
+   int_vector_erase_range(self, count, size);
+   return size - count;
+}
+
+/********************************************************************************
+* int_vector_merge: Slr samman tv sorterade vektorer till en sorterad
+*                   vektor i linjr tid, dr tidigare innehll i mlvektorn
+*                   erstts. Vid lika heltal placeras heltalet frn den
+*                   frsta kllvektorn frst. Mlvektorn fr vara samma
+*                   vektor som ngon av kllvektorerna. Vid lyckad
+*                   minnesallokering returneras 0, annars returneras
+*                   felkod 1 och mlvektorn lmnas intakt.
+*
+*                   Sammanslagningen sker bakifrn, s att en kllvektor
+*                   som r samma vektor som mlvektorn ligger kvar i
+*                   brjan av mlvektorn efter storleksndringen och
+*                   skrivs ver frst efter att dess heltal har lsts.
+*
+*                   - dst   : Pekare till vektorn som ska tilldelas heltalen.
+*                   - first : Pekare till den frsta sorterade kllvektorn.
+*                   - second: Pekare till den andra sorterade kllvektorn.
+********************************************************************************/
+int int_vector_merge(struct int_vector* dst,
+                     const struct int_vector* first,
+                     const struct int_vector* second)
+{
+   size_t i = first->size, j = second->size;
+   const int* a;
+   const int* b;
+
+   if (i > SIZE_MAX - j || int_vector_resize(dst, i + j)) return 1;
+   a = first->data;
+   b = second->data;
+
+   while (j > 0)
+   {
+      int* last = dst->data + i + j - 1;
+      if (i > 0 && a[i - 1] > b[j - 1]) *last = a[--i];
+      else *last = b[--j];
+   }
+
+   if (dst != first) memcpy(dst->data, a, sizeof(int) * i);
+   return 0;
+}
\ No newline at end of file
@@ -0,0 +1,114 @@
+/********************************************************************************
+* int_vector_sort.h: Innehller sortering av vektorer samt operationer p
+*                    sorterade vektorer, ssom binrskning, borttagning av
+*                    dubbletter och sammanslagning.
+*
+*                    Sorteringen sker via LSD-radixsortering (least
+*                    significant digit first) i tre pass om 11, 11 och 10
+*                    bitar, dr varje pass bestr av en histogramfas och en
+*                    spridningsfas. Bda faserna kan delas upp p flera
+*                    trdar, dr varje trd hanterar ett eget segment av
+*                    vektorn. Pass dr samtliga heltal har samma siffra
+*                    hoppas ver. Sorteringen r stabil och krs i linjr
+*                    tid, men krver ett extra flt av samma storlek som
+*                    vektorn. Korta vektorer sorteras i stllet via
+*                    insttningssortering.
+********************************************************************************/
+#ifndef INT_VECTOR_SORT_H_
+#define INT_VECTOR_SORT_H_
+
+/* Inkluderingsdirektiv: */
+#include "int_vector.h"
+
+/********************************************************************************
+* INT_VECTOR_SORT_INSERTION_LIMIT: Strsta antalet heltal som sorteras via
+*                                  insttningssortering i stllet fr
+*                                  radixsortering.
+********************************************************************************/
+#ifndef INT_VECTOR_SORT_INSERTION_LIMIT
+#define INT_VECTOR_SORT_INSERTION_LIMIT 64
+#endif
+
+/********************************************************************************
+* INT_VECTOR_SORT_MIN_CHUNK: Minsta antalet heltal per trd vid sortering, s
+*                            att kostnaden fr att starta trdarna inte
+*                            verstiger vinsten fr korta vektorer.
+********************************************************************************/
+#ifndef INT_VECTOR_SORT_MIN_CHUNK
+#define INT_VECTOR_SORT_MIN_CHUNK 65536
+#endif
+
+/********************************************************************************
+* int_vector_set_sort_threads: Stter det hgsta antalet trdar som anvnds
+*                              vid sortering, dr 0 innebr antalet
+*                              tillgngliga processorkrnor (default).
+*
+*                              - threads: Det nya antalet trdar.
+********************************************************************************/
+void int_vector_set_sort_threads(const size_t threads);
+
+/********************************************************************************
+* int_vector_sort_threads: Returnerar det hgsta antalet trdar som anvnds
+*                          vid sortering, dr 0 har ersatts med antalet
+*                          tillgngliga processorkrnor.
+********************************************************************************/
+size_t int_vector_sort_threads(void);
+
+/********************************************************************************
+* int_vector_sort: Sorterar heltalen i angiven vektor i stigande ordning.
+*                  Sorteringen krver ett extra flt fr lika mnga heltal
+*                  som vektorn rymmer. Om ett sdant flt anges anvnds det,
+*                  annars allokeras fltet via vektorns allokerare under
+*                  sorteringen. Vid lyckad sortering returneras 0. Om
+*                  minnesallokeringen misslyckas eller om vektorn har lnat
+*                  minne returneras felkod 1 och vektorn lmnas intakt.
+*
+*                  - self   : Pekare till vektorn som ska sorteras.
+*                  - scratch: Pekare till ett flt som rymmer minst lika
+*                             mnga heltal som vektorn (eller null).
+********************************************************************************/
+int int_vector_sort(struct int_vector* self,
+                    int* scratch);
+
+/********************************************************************************
+* int_vector_lower_bound: Returnerar index fr frsta heltalet i angiven
+*                         sorterad vektor som inte understiger angivet vrde,
+*                         dvs. den position dr vrdet kan infogas utan att
+*                         ordningen bryts. Om samtliga heltal understiger
+*                         vrdet returneras vektorns storlek.
+*
+*                         - self : Pekare till den sorterade vektorn.
+*                         - value: Vrdet som ska skas efter.
+********************************************************************************/
+size_t int_vector_lower_bound(const struct int_vector* self,
+                              const int value);
+
+/********************************************************************************
+* int_vector_unique: Tar bort intilliggande dubbletter i angiven vektor, s
+*                    att en sorterad vektor endast innehller unika heltal.
+*                    Ordningen mellan kvarvarande heltal bibehlls och
+*                    kapaciteten minskas enligt samma lgvattenmrke som vid
+*                    popoperationer. Returnerar antalet borttagna heltal.
+*
+*                    - self: Pekare till vektorn.
+********************************************************************************/
+size_t int_vector_unique(struct int_vector* self);
+
+/********************************************************************************
+* int_vector_merge: Slr samman tv sorterade vektorer till en sorterad
+*                   vektor i linjr tid, dr tidigare innehll i mlvektorn
+*                   erstts. Vid lika heltal placeras heltalet frn den
+*                   frsta kllvektorn frst. Mlvektorn fr vara samma
+*                   vektor som ngon av kllvektorerna. Vid lyckad
+*                   minnesallokering returneras 0, annars returneras
+*                   felkod 1 och mlvektorn lmnas intakt.
+*
+*                   - dst   : Pekare till vektorn som ska tilldelas heltalen.
+*                   - first : Pekare till den frsta sorterade kllvektorn.
+*                   - second: Pekare till den andra sorterade kllvektorn.
+********************************************************************************/
+int int_vector_merge(struct int_vector* dst,
+                     const struct int_vector* first,
+                     const struct int_vector* second);
+
+#endif /* INT_VECTOR_SORT_H_ */
\ No newline at end of file
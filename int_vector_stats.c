@@ -0,0 +1,286 @@
+/********************************************************************************
+* int_vector_stats.c: Innehller definitioner av funktioner fr instrumentering
+*                     av minnesallokeringar fr strukten int_vector.
+********************************************************************************/
+#include "int_vector_stats.h"
+
+#include <string.h> /* Innehller memset. */
+
+#ifdef INT_VECTOR_STATS
+
+#include <stdatomic.h> /* Innehller atomic_size_t med mera. */
+
+/* Statiska variabler: */
+static atomic_size_t allocations;     /* Antalet nya allokeringar. */
+static atomic_size_t reallocations;   /* Antalet omallokeringar. */
+static atomic_size_t in_place;        /* Antalet omallokeringar p plats. */
+static atomic_size_t moved;           /* Antalet flyttade omallokeringar. */
+static atomic_size_t bytes_copied;    /* Antalet kopierade byte. */
+static atomic_size_t frees;           /* Antalet frigranden. */
+static atomic_size_t live_bytes;      /* Antalet levande byte. */
+static atomic_size_t peak_live_bytes; /* Hgsta antalet levande byte. */
+static atomic_size_t histogram[INT_VECTOR_STATS_BUCKETS]; /* Begrda storlekar. */
+
+/********************************************************************************
+* counter_add: kar angiven rknare med angivet vrde. Rknarna synkroniserar
+*              inget annat minne, varfr ingen ordning krvs.
+*
+*              - counter: Pekare till rknaren.
+*              - value  : Vrdet som ska adderas.
+********************************************************************************/
+static inline void counter_add(atomic_size_t* counter,
+                               const size_t value)
+{
+   atomic_fetch_add_explicit(counter, value, memory_order_relaxed);
+   return;
+}
+
+/********************************************************************************
+* counter_get: Returnerar nuvarande vrde fr angiven rknare.
+*
+*              - counter: Pekare till rknaren.
+********************************************************************************/
+static inline size_t counter_get(atomic_size_t* counter)
+{
+   return atomic_load_explicit(counter, memory_order_relaxed);
+}
+
+/********************************************************************************
+* bucket_of: Returnerar histogramfacket fr angivet antal byte, dvs. antalet
+*            gnger talet kan halveras innan det understiger 2. Storleken 0
+*            hamnar i fack 0.
+*
+*            - bytes: Begrt antal byte.
+********************************************************************************/
+static inline size_t bucket_of(size_t bytes)
+{
+   size_t bucket = 0;
+   while (bytes > 1 && bucket < INT_VECTOR_STATS_BUCKETS - 1)
+   {
+      bytes >>= 1;
+      bucket++;
+   }
+   return bucket;
+}
+
+/********************************************************************************
+* live_add: kar antalet levande byte med angivet antal och uppdaterar det
+*           hgsta antalet vid behov. Det hgsta antalet erstts endast om det
+*           understiger det nya vrdet, vilket upprepas tills ersttningen
+*           lyckas eller en annan trd har registrerat ett hgre vrde.
+*
+*           - bytes: Antalet nya levande byte.
+********************************************************************************/
+static void live_add(const size_t bytes)
+{
+   const size_t live =
+      atomic_fetch_add_explicit(&live_bytes, bytes, memory_order_relaxed) + bytes;
+   size_t peak = counter_get(&peak_live_bytes);
+
+   while (peak < live &&
+          !atomic_compare_exchange_weak_explicit(&peak_live_bytes, &peak, live,
+                                                 memory_order_relaxed,
+                                                 memory_order_relaxed));
+   return;
+}
+
+/********************************************************************************
+* int_vector_stats_on_alloc: Registrerar en ny allokering av angivet antal byte.
+*
+*                            - bytes: Antalet allokerade byte.
+********************************************************************************/
+void int_vector_stats_on_alloc(const size_t bytes)
+{
+   counter_add(&allocations, 1);
+   counter_add(&histogram[bucket_of(bytes)], 1);
+   live_add(bytes);
+   return;
+}
+
+/********************************************************************************
+* int_vector_stats_on_realloc: Registrerar en omallokering, dr angivna
+*                              adresser jmfrs fr att avgra om fltet
+*                              flyttades.
+*
+*                              - old_address: Fltets adress fre omallokeringen.
+*                              - new_address: Fltets adress efter omallokeringen.
+*                              - old_bytes  : Fltets storlek i byte fre.
+*                              - new_bytes  : Fltets storlek i byte efter.
+********************************************************************************/
+void int_vector_stats_on_realloc(const void* old_address,
+                                 const void* new_address,
+                                 const size_t old_bytes,
+                                 const size_t new_bytes)
+{
+   counter_add(&reallocations, 1);
+   counter_add(&histogram[bucket_of(new_bytes)], 1);
+
+   if (old_address == new_address)
+   {
+      counter_add(&in_place, 1);
+   }
+   else
+   {
+      counter_add(&moved, 1);
+      counter_add(&bytes_copied, old_bytes < new_bytes ? old_bytes : new_bytes);
+   }
+
+   if (new_bytes >= old_bytes)
+   {
+      live_add(new_bytes - old_bytes);
+   }
+   else
+   {
+      atomic_fetch_sub_explicit(&live_bytes, old_bytes - new_bytes, memory_order_relaxed);
+   }
+   return;
+}
+
+/********************************************************************************
+* int_vector_stats_on_copy: Registrerar att angivet antal byte har kopierats.
+*
+*                           - bytes: Antalet kopierade byte.
+********************************************************************************/
+void int_vector_stats_on_copy(const size_t bytes)
+{
+   counter_add(&bytes_copied, bytes);
+   return;
+}
+
+/********************************************************************************
+* int_vector_stats_on_free: Registrerar ett frigrande av angivet antal byte.
+*
+*                           - bytes: Antalet frigjorda byte.
+********************************************************************************/
+void int_vector_stats_on_free(const size_t bytes)
+{
+   counter_add(&frees, 1);
+   atomic_fetch_sub_explicit(&live_bytes, bytes, memory_order_relaxed);
+   return;
+}
+
+/********************************************************************************
+* int_vector_stats_enabled: Indikerar att instrumenteringen r aktiverad.
+********************************************************************************/
+int int_vector_stats_enabled(void)
+{
+   return 1;
+}
+
+/********************************************************************************
+* int_vector_stats_get: Kopierar nuvarande statistik till angiven strukt.
+*
+*                       - stats: Pekare till strukten som ska tilldelas.
+********************************************************************************/
+void int_vector_stats_get(struct int_vector_stats* stats)
+{
+   stats->allocations = counter_get(&allocations);
+   stats->reallocations = counter_get(&reallocations);
+   stats->in_place = counter_get(&in_place);
+   stats->moved = counter_get(&moved);
+   stats->bytes_copied = counter_get(&bytes_copied);
+   stats->frees = counter_get(&frees);
+   stats->live_bytes = counter_get(&live_bytes);
+   stats->peak_live_bytes = counter_get(&peak_live_bytes);
+
+   for (size_t i = 0; i < INT_VECTOR_STATS_BUCKETS; ++i)
+   {
+      stats->histogram[i] = counter_get(&histogram[i]);
+   }
+   return;
+}
+
+/********************************************************************************
+* int_vector_stats_reset: Nollstller samtliga rknare utom antalet levande
+*                         byte, vilket ven blir nytt hgsta antal.
+********************************************************************************/
+void int_vector_stats_reset(void)
+{
+   atomic_store_explicit(&allocations, 0, memory_order_relaxed);
+   atomic_store_explicit(&reallocations, 0, memory_order_relaxed);
+   atomic_store_explicit(&in_place, 0, memory_order_relaxed);
+   atomic_store_explicit(&moved, 0, memory_order_relaxed);
+   atomic_store_explicit(&bytes_copied, 0, memory_order_relaxed);
+   atomic_store_explicit(&frees, 0, memory_order_relaxed);
+   atomic_store_explicit(&peak_live_bytes, counter_get(&live_bytes), memory_order_relaxed);
+
+   for (size_t i = 0; i < INT_VECTOR_STATS_BUCKETS; ++i)
+   {
+      atomic_store_explicit(&histogram[i], 0, memory_order_relaxed);
+   }
+   return;
+}
+
+#else
+
+/********************************************************************************
+* int_vector_stats_enabled: Indikerar att instrumenteringen inte r aktiverad.
+********************************************************************************/
+int int_vector_stats_enabled(void)
+{
+   return 0;
+}
+
+/********************************************************************************
+* int_vector_stats_get: Nollstller angiven strukt, eftersom ingen statistik
+*                       samlas in.
+*
+*                       - stats: Pekare till strukten som ska nollstllas.
+********************************************************************************/
+void int_vector_stats_get(struct int_vector_stats* stats)
+{
+   memset(stats, 0, sizeof(struct int_vector_stats));
+   return;
+}
+
+/********************************************************************************
+* int_vector_stats_reset: Gr ingenting, eftersom ingen statistik samlas in.
+********************************************************************************/
+void int_vector_stats_reset(void)
+{
+   return;
+}
+
+#endif /* INT_VECTOR_STATS */
+
+/********************************************************************************
+* int_vector_stats_dump: Skriver ut nuvarande statistik samt samtliga
+*                        histogramfack som inte r tomma via angiven utstrm.
+*
+*                        - ostream: Pekare till angiven utstrm (default = stdout).
+********************************************************************************/
+void int_vector_stats_dump(FILE* ostream)
+{
+   struct int_vector_stats stats;
+   if (!ostream) ostream = stdout;
+
+   if (!int_vector_stats_enabled())
+   {
+      fprintf(ostream, "int_vector: statistik ej aktiverad (kompilera med -DINT_VECTOR_STATS)\n");
+      return;
+   }
+
+   int_vector_stats_get(&stats);
+   fprintf(ostream, "--------------------------------------------------------------------------------\n");
+   fprintf(ostream, "int_vector: allokeringsstatistik\n");
+   fprintf(ostream, "%-28s %20zu\n", "allokeringar", stats.allocations);
+   fprintf(ostream, "%-28s %20zu\n", "omallokeringar", stats.reallocations);
+   fprintf(ostream, "%-28s %20zu\n", "  varav p plats", stats.in_place);
+   fprintf(ostream, "%-28s %20zu\n", "  varav flyttade", stats.moved);
+   fprintf(ostream, "%-28s %20zu\n", "kopierade byte", stats.bytes_copied);
+   fprintf(ostream, "%-28s %20zu\n", "frigranden", stats.frees);
+   fprintf(ostream, "%-28s %20zu\n", "levande byte", stats.live_bytes);
+   fprintf(ostream, "%-28s %20zu\n", "hgsta antal levande byte", stats.peak_live_bytes);
+   fprintf(ostream, "begrda storlekar:\n");
+
+   for (size_t i = 0; i < INT_VECTOR_STATS_BUCKETS; ++i)
+   {
+      char range[32];
+      if (stats.histogram[i] == 0) continue;
+      if (i == 0) sprintf(range, "[0, 2)");
+      else sprintf(range, "[2^%zu, 2^%zu)", i, i + 1);
+      fprintf(ostream, "  %-26s %20zu\n", range, stats.histogram[i]);
+   }
+   fprintf(ostream, "--------------------------------------------------------------------------------\n\n");
+   return;
+}
\ No newline at end of file
@@ -0,0 +1,143 @@
+/********************************************************************************
+* int_vector_stats.h: Innehller valbar instrumentering av minnesallokeringar
+*                     fr vektorer av strukten int_vector, s att tid och minne
+*                     som lggs p omallokeringar kan fljas upp ven i
+*                     produktionsbyggen utan extern profilerare.
+*
+*                     Instrumenteringen aktiveras genom att definiera makrot
+*                     INT_VECTOR_STATS vid kompilering, exempelvis via
+*                     flaggan -DINT_VECTOR_STATS. D rknas samtliga
+*                     allokeringar, omallokeringar och frigranden av
+*                     vektorernas flt via atomiska rknare som delas av
+*                     processens trdar. Omallokeringar delas upp i sdana
+*                     som kunde ske p plats och sdana dr fltet flyttades,
+*                     samtidigt som antalet kopierade byte, antalet levande
+*                     byte samt hgsta antalet levande byte fljs upp.
+*                     Dessutom frs ett histogram ver begrda storlekar,
+*                     dr fack k rknar storlekar i intervallet [2^k, 2^(k+1)).
+*
+*                     Utan makrot expanderar samtliga mtpunkter till ingenting,
+*                     vilket innebr att instrumenteringen d inte kostar
+*                     ngot. Funktionerna nedan finns dock alltid, s att
+*                     anropande kod inte behver villkoras.
+********************************************************************************/
+#ifndef INT_VECTOR_STATS_H_
+#define INT_VECTOR_STATS_H_
+
+/* Inkluderingsdirektiv: */
+#include <stdio.h>  /* Innehller FILE* och fprintf. */
+#include <stddef.h> /* Innehller size_t. */
+
+/********************************************************************************
+* INT_VECTOR_STATS_BUCKETS: Antalet fack i histogrammet ver begrda
+*                           storlekar, ett fack per tvpotens.
+********************************************************************************/
+#define INT_VECTOR_STATS_BUCKETS 64
+
+/********************************************************************************
+* int_vector_stats: Strukt fr en gonblicksbild av statistiken.
+********************************************************************************/
+struct int_vector_stats
+{
+   size_t allocations;       /* Antalet nya allokeringar. */
+   size_t reallocations;     /* Antalet omallokeringar. */
+   size_t in_place;          /* Antalet omallokeringar p samma adress. */
+   size_t moved;             /* Antalet omallokeringar till ny adress. */
+   size_t bytes_copied;      /* Antalet byte som kopierats vid flytt. */
+   size_t frees;             /* Antalet frigranden. */
+   size_t live_bytes;        /* Antalet byte som fr nrvarande r allokerade. */
+   size_t peak_live_bytes;   /* Hgsta antalet samtidigt allokerade byte. */
+   size_t histogram[INT_VECTOR_STATS_BUCKETS]; /* Begrda storlekar per tvpotens. */
+};
+
+/********************************************************************************
+* int_vector_stats_enabled: Indikerar ifall instrumenteringen r aktiverad,
+*                           dvs. om makrot INT_VECTOR_STATS var definierat
+*                           nr int_vector_stats.c kompilerades.
+********************************************************************************/
+int int_vector_stats_enabled(void);
+
+/********************************************************************************
+* int_vector_stats_get: Kopierar nuvarande statistik till angiven strukt.
+*                       Rknarna lses var fr sig, vilket innebr att
+*                       gonblicksbilden inte r helt konsistent om andra
+*                       trdar allokerar samtidigt. Om instrumenteringen inte
+*                       r aktiverad nollstlls strukten.
+*
+*                       - stats: Pekare till strukten som ska tilldelas.
+********************************************************************************/
+void int_vector_stats_get(struct int_vector_stats* stats);
+
+/********************************************************************************
+* int_vector_stats_reset: Nollstller samtliga rknare utom antalet levande
+*                         byte, vilket ven blir nytt hgsta antal, s att
+*                         efterfljande frigranden av redan allokerat minne
+*                         inte ger negativa vrden.
+********************************************************************************/
+void int_vector_stats_reset(void);
+
+/********************************************************************************
+* int_vector_stats_dump: Skriver ut nuvarande statistik samt samtliga
+*                        histogramfack som inte r tomma via angiven utstrm,
+*                        dr standardutenhet stdout anvnds som default.
+*
+*                        - ostream: Pekare till angiven utstrm (default = stdout).
+********************************************************************************/
+void int_vector_stats_dump(FILE* ostream);
+
+#ifdef INT_VECTOR_STATS
+
+/********************************************************************************
+* int_vector_stats_on_alloc: Registrerar en ny allokering av angivet antal byte.
+*
+*                            - bytes: Antalet allokerade byte.
+********************************************************************************/
+void int_vector_stats_on_alloc(const size_t bytes);
+
+/********************************************************************************
+* int_vector_stats_on_realloc: Registrerar en omallokering, dr angivna
+*                              adresser jmfrs fr att avgra om fltet
+*                              flyttades. Vid flytt rknas det mindre av
+*                              gammalt och nytt antal byte som kopierat.
+*
+*                              - old_address: Fltets adress fre omallokeringen.
+*                              - new_address: Fltets adress efter omallokeringen.
+*                              - old_bytes  : Fltets storlek i byte fre.
+*                              - new_bytes  : Fltets storlek i byte efter.
+********************************************************************************/
+void int_vector_stats_on_realloc(const void* old_address,
+                                 const void* new_address,
+                                 const size_t old_bytes,
+                                 const size_t new_bytes);
+
+/********************************************************************************
+* int_vector_stats_on_copy: Registrerar att angivet antal byte har kopierats
+*                           mellan en vektors inbyggda buffert och heapen.
+*
+*                           - bytes: Antalet kopierade byte.
+********************************************************************************/
+void int_vector_stats_on_copy(const size_t bytes);
+
+/********************************************************************************
+* int_vector_stats_on_free: Registrerar ett frigrande av angivet antal byte.
+*
+*                           - bytes: Antalet frigjorda byte.
+********************************************************************************/
+void int_vector_stats_on_free(const size_t bytes);
+
+#define INT_VECTOR_STATS_ALLOC(bytes) int_vector_stats_on_alloc(bytes)
+#define INT_VECTOR_STATS_REALLOC(old_address, new_address, old_bytes, new_bytes) \
+   int_vector_stats_on_realloc(old_address, new_address, old_bytes, new_bytes)
+#define INT_VECTOR_STATS_COPY(bytes) int_vector_stats_on_copy(bytes)
+#define INT_VECTOR_STATS_FREE(bytes) int_vector_stats_on_free(bytes)
+
+#else
+
+#define INT_VECTOR_STATS_ALLOC(bytes) ((void)0)
+#define INT_VECTOR_STATS_REALLOC(old_address, new_address, old_bytes, new_bytes) ((void)0)
+#define INT_VECTOR_STATS_COPY(bytes) ((void)0)
+#define INT_VECTOR_STATS_FREE(bytes) ((void)0)
+
+#endif /* INT_VECTOR_STATS */
+
+#endif /* INT_VECTOR_STATS_H_ */
\ No newline at end of file
@@ -0,0 +1,109 @@
+/********************************************************************************
+* int_vector_view.c: Innehller definitioner av associerade funktioner fr
+*                    strukten int_vector_view.
+********************************************************************************/
+#include "int_vector_view.h"
+#include "int_format.h"
+#include "int_simd.h"
+
+/********************************************************************************
+* int_vector_assign_slice: Tilldelar heltalen i det halvppna intervallet
+*                          [first, last) i angiven vektor en aritmetisk
+*                          talfljd via int_simd_assign.
+*
+*                          - self     : Pekare till vektorn.
+*                          - first    : Index fr det frsta heltalet.
+*                          - last     : Index efter det sista heltalet.
+*                          - start_val: Startvrde fr talfljden.
+*                          - step_val : Stegvrde.
+********************************************************************************/
+int int_vector_assign_slice(struct int_vector* self,
+                            const size_t first,
+                            const size_t last,
+                            const int start_val,
+                            const int step_val)
+{
+   if (self->borrowed || first > last || last > self->size) return 1;
+   int_simd_assign(self->data + first, last - first, start_val, step_val);
+   return 0;
+}
+
+/********************************************************************************
+* int_vector_view_sum: Returnerar summan av heltalen i angiven vy.
+*
+*                      - self: Vyn.
+********************************************************************************/
+long long int_vector_view_sum(const struct int_vector_view self)
+{
+   return int_simd_sum(self.data, self.size);
+}
+
+/********************************************************************************
+* int_vector_view_minmax: Tilldelar angivna variabler minsta respektive strsta
+*                         heltal i angiven vy.
+*
+*                         - self: Vyn.
+*                         - min : Pekare till variabel fr minsta heltalet.
+*                         - max : Pekare till variabel fr strsta heltalet.
+********************************************************************************/
+int int_vector_view_minmax(const struct int_vector_view self,
+                           int* min,
+                           int* max)
+{
+   return int_simd_minmax(self.data, self.size, min, max);
+}
+
+/********************************************************************************
+* int_vector_view_count_eq: Returnerar antalet heltal i angiven vy som r lika
+*                           med angivet vrde.
+*
+*                           - self : Vyn.
+*                           - value: Vrdet som ska rknas.
+********************************************************************************/
+size_t int_vector_view_count_eq(const struct int_vector_view self,
+                                const int value)
+{
+   return int_simd_count_eq(self.data, self.size, value);
+}
+
+/********************************************************************************
+* int_vector_view_count_range: Returnerar antalet heltal i angiven vy som
+*                              ligger i det slutna intervallet [low, high].
+*
+*                              - self: Vyn.
+*                              - low : Intervallets undre grns.
+*                              - high: Intervallets vre grns.
+********************************************************************************/
+size_t int_vector_view_count_range(const struct int_vector_view self,
+                                   const int low,
+                                   const int high)
+{
+   return int_simd_count_range(self.data, self.size, low, high);
+}
+
+/********************************************************************************
+* int_vector_view_find: Returnerar adressen till frsta heltalet i angiven vy
+*                       som r lika med angivet vrde, annars null.
+*
+*                       - self : Vyn.
+*                       - value: Vrdet som ska skas efter.
+********************************************************************************/
+const int* int_vector_view_find(const struct int_vector_view self,
+                                const int value)
+{
+   const size_t index = int_simd_find(self.data, self.size, value);
+   return index < self.size ? self.data + index : 0;
+}
+
+/********************************************************************************
+* int_vector_view_print: Skriver ut heltalen i angiven vy via angiven utstrm.
+*
+*                        - self   : Vyn som ska skrivas ut.
+*                        - ostream: Pekare till utstrmmen (default = stdout).
+********************************************************************************/
+void int_vector_view_print(const struct int_vector_view self,
+                           FILE* ostream)
+{
+   int_format_print(self.data, self.size, ostream, 0, 0);
+   return;
+}
\ No newline at end of file
@@ -0,0 +1,183 @@
+/********************************************************************************
+* int_vector_view.h: Innehller strukten int_vector_view, en skrivskyddad vy
+*                    av en sammanhngande del av en vektor eller ett flt,
+*                    samt associerade funktioner.
+*
+*                    En vy bestr endast av en pekare och en lngd och ger
+*                    inga element, vilket innebr att en del av en vektor
+*                    kan lmnas vidare utan att en ny vektor allokeras och
+*                    elementen kopieras. Vyer kan kopieras via tilldelning
+*                    och delas upp ytterligare via int_vector_view_slice.
+*                    Utskrift, summering, min/max, rkning och skning sker
+*                    via samma krnor som fr int_vector, se int_simd.h.
+*
+*                    En vy r giltig s lnge de underliggande elementen
+*                    inte flyttas eller frigrs, dvs. tills vektorn ndrar
+*                    kapacitet eller tms.
+********************************************************************************/
+#ifndef INT_VECTOR_VIEW_H_
+#define INT_VECTOR_VIEW_H_
+
+/* Inkluderingsdirektiv: */
+#include "int_vector.h"
+
+/********************************************************************************
+* int_vector_view: Strukt fr en skrivskyddad vy av angivet antal heltal.
+********************************************************************************/
+struct int_vector_view
+{
+   const int* data; /* Pekare till vyns frsta heltal. */
+   size_t size;     /* Antalet heltal i vyn. */
+};
+
+/********************************************************************************
+* int_vector_view_of: Returnerar en vy av samtliga heltal i angiven vektor.
+*
+*                     - vector: Pekare till vektorn.
+********************************************************************************/
+static inline struct int_vector_view int_vector_view_of(const struct int_vector* vector)
+{
+   struct int_vector_view view;
+   view.data = vector->data;
+   view.size = vector->size;
+   return view;
+}
+
+/********************************************************************************
+* int_vector_view_array: Returnerar en vy av angivet flt.
+*
+*                        - data: Pekare till fltets frsta heltal.
+*                        - size: Antalet heltal i fltet.
+********************************************************************************/
+static inline struct int_vector_view int_vector_view_array(const int* data,
+                                                           const size_t size)
+{
+   struct int_vector_view view;
+   view.data = data;
+   view.size = size;
+   return view;
+}
+
+/********************************************************************************
+* int_vector_view_slice: Returnerar en vy av heltalen i det halvppna
+*                        intervallet [first, last) i angiven vy. Grnserna
+*                        begrnsas till vyns storlek, s att ett ogiltigt
+*                        intervall ger en tom vy.
+*
+*                        - self : Vyn som ska delas upp.
+*                        - first: Index fr det frsta heltalet.
+*                        - last : Index efter det sista heltalet.
+********************************************************************************/
+static inline struct int_vector_view int_vector_view_slice(const struct int_vector_view self,
+                                                           size_t first,
+                                                           size_t last)
+{
+   if (last > self.size) last = self.size;
+   if (first > last) first = last;
+   return int_vector_view_array(self.data + first, last - first);
+}
+
+/********************************************************************************
+* int_vector_slice: Returnerar en vy av heltalen i det halvppna intervallet
+*                   [first, last) i angiven vektor, utan att heltalen
+*                   kopieras. Grnserna begrnsas till vektorns storlek.
+*
+*                   - vector: Pekare till vektorn.
+*                   - first : Index fr det frsta heltalet.
+*                   - last  : Index efter det sista heltalet.
+********************************************************************************/
+static inline struct int_vector_view int_vector_slice(const struct int_vector* vector,
+                                                      const size_t first,
+                                                      const size_t last)
+{
+   return int_vector_view_slice(int_vector_view_of(vector), first, last);
+}
+
+/********************************************************************************
+* int_vector_assign_slice: Tilldelar heltalen i det halvppna intervallet
+*                          [first, last) i angiven vektor en aritmetisk
+*                          talfljd p samma stt som int_vector_assign,
+*                          utan att vriga heltal pverkas. Vid lyckad
+*                          tilldelning returneras 0. Om intervallet r
+*                          ogiltigt eller om vektorn har lnat minne
+*                          returneras felkod 1 och vektorn lmnas intakt.
+*
+*                          - self     : Pekare till vektorn.
+*                          - first    : Index fr det frsta heltalet.
+*                          - last     : Index efter det sista heltalet.
+*                          - start_val: Startvrde fr talfljden.
+*                          - step_val : Stegvrde, dvs. differensen mellan
+*                                       varje heltal.
+********************************************************************************/
+int int_vector_assign_slice(struct int_vector* self,
+                            const size_t first,
+                            const size_t last,
+                            const int start_val,
+                            const int step_val);
+
+/********************************************************************************
+* int_vector_view_sum: Returnerar summan av heltalen i angiven vy som ett
+*                      64-bitars tal.
+*
+*                      - self: Vyn.
+********************************************************************************/
+long long int_vector_view_sum(const struct int_vector_view self);
+
+/********************************************************************************
+* int_vector_view_minmax: Tilldelar angivna variabler minsta respektive strsta
+*                         heltal i angiven vy. Vid lyckad skning returneras
+*                         0. Om vyn r tom returneras felkod 1 och
+*                         variablerna lmnas ofrndrade.
+*
+*                         - self: Vyn.
+*                         - min : Pekare till variabel fr minsta heltalet.
+*                         - max : Pekare till variabel fr strsta heltalet.
+********************************************************************************/
+int int_vector_view_minmax(const struct int_vector_view self,
+                           int* min,
+                           int* max);
+
+/********************************************************************************
+* int_vector_view_count_eq: Returnerar antalet heltal i angiven vy som r lika
+*                           med angivet vrde.
+*
+*                           - self : Vyn.
+*                           - value: Vrdet som ska rknas.
+********************************************************************************/
+size_t int_vector_view_count_eq(const struct int_vector_view self,
+                                const int value);
+
+/********************************************************************************
+* int_vector_view_count_range: Returnerar antalet heltal i angiven vy som
+*                              ligger i det slutna intervallet [low, high].
+*
+*                              - self: Vyn.
+*                              - low : Intervallets undre grns (inklusive).
+*                              - high: Intervallets vre grns (inklusive).
+********************************************************************************/
+size_t int_vector_view_count_range(const struct int_vector_view self,
+                                   const int low,
+                                   const int high);
+
+/********************************************************************************
+* int_vector_view_find: Returnerar adressen till frsta heltalet i angiven vy
+*                       som r lika med angivet vrde. Om vrdet saknas
+*                       returneras null.
+*
+*                       - self : Vyn.
+*                       - value: Vrdet som ska skas efter.
+********************************************************************************/
+const int* int_vector_view_find(const struct int_vector_view self,
+                                const int value);
+
+/********************************************************************************
+* int_vector_view_print: Skriver ut heltalen i angiven vy via angiven utstrm
+*                        med samma format som int_vector_print.
+*
+*                        - self   : Vyn som ska skrivas ut.
+*                        - ostream: Pekare till utstrmmen (default = stdout).
+********************************************************************************/
+void int_vector_view_print(const struct int_vector_view self,
+                           FILE* ostream);
+
+#endif /* INT_VECTOR_VIEW_H_ */
\ No newline at end of file
@@ -0,0 +1,426 @@
+/********************************************************************************
+* int_vector_writer.c: Innehller definitioner av associerade funktioner fr
+*                      strukten int_vector_writer.
+********************************************************************************/
+#define _GNU_SOURCE /* Krvs fr O_DIRECT, posix_memalign och posix_fallocate. */
+#include "int_vector_writer.h"
+
+#include <errno.h>  /* Innehller errno, EINTR och EINVAL. */
+#include <fcntl.h>  /* Innehller open, fcntl och posix_fallocate. */
+#include <stdint.h> /* Innehller SIZE_MAX. */
+#include <string.h> /* Innehller memcpy. */
+#include <unistd.h> /* Innehller write, ftruncate och close. */
+
+/********************************************************************************
+* drop_direct: Slr av O_DIRECT fr angiven utstrm, varefter terstende
+*              skrivningar passerar sidcachen.
+*
+*              - self: Pekare till utstrmmen.
+********************************************************************************/
+static void drop_direct(struct int_vector_writer* self)
+{
+#ifdef O_DIRECT
+   const int flags = fcntl(self->fd, F_GETFL);
+   if (flags != -1) fcntl(self->fd, F_SETFL, flags & ~O_DIRECT);
+#endif
+   self->direct = 0;
+   return;
+}
+
+/********************************************************************************
+* write_buffer: Skriver angiven buffert i sin helhet till utstrmmens fil. Vid
+*               O_DIRECT mste adress, lngd och filposition vara justerade,
+*               vilket gller fr samtliga fulla buffertar. En ojusterad
+*               skrivning, exempelvis den sista bufferten, eller en
+*               skrivning som filsystemet avvisar med EINVAL slr drfr av
+*               O_DIRECT fr terstende skrivningar. Vid lyckad skrivning
+*               returneras 0, annars felkod 1. Anropas endast av
+*               bakgrundstrden.
+*
+*               - self  : Pekare till utstrmmen.
+*               - buffer: Pekare till bufferten.
+*               - length: Antalet byte som ska skrivas.
+********************************************************************************/
+static int write_buffer(struct int_vector_writer* self,
+                        const char* buffer,
+                        size_t length)
+{
+   while (length > 0)
+   {
+      ssize_t written;
+
+      if (self->direct && ((size_t)(buffer - self->memory) % INT_VECTOR_WRITER_ALIGNMENT ||
+                           length % INT_VECTOR_WRITER_ALIGNMENT ||
+                           self->offset % INT_VECTOR_WRITER_ALIGNMENT))
+      {
+         drop_direct(self);
+      }
+
+      written = write(self->fd, buffer, length);
+
+      if (written < 0)
+      {
+         if (errno == EINTR) continue;
+         if (errno != EINVAL || !self->direct) return 1;
+         drop_direct(self);
+         continue;
+      }
+
+      buffer += written;
+      length -= (size_t)written;
+      self->offset += (unsigned long long)written;
+   }
+
+   return 0;
+}
+
+/********************************************************************************
+* drain: Bakgrundstrdens funktion, som skriver kade buffertar till filen i
+*        tur och ordning tills utstrmmen stngs och kn r tom. Lset
+*        slpps under sjlva skrivningen, s att anroparen kan fylla nsta
+*        buffert samtidigt. Efter ett skrivfel kastas kade buffertar utan
+*        att skrivas, s att anroparen aldrig blockeras i ondan.
+*
+*        - arg: Pekare till utstrmmen.
+********************************************************************************/
+static void* drain(void* arg)
+{
+   struct int_vector_writer* self = (struct int_vector_writer*)arg;
+   pthread_mutex_lock(&self->lock);
+
+   for (;;)
+   {
+      const char* buffer;
+      size_t length;
+      int failed = 0;
+
+      while (self->queued == 0 && !self->closing)
+      {
+         pthread_cond_wait(&self->filled, &self->lock);
+      }
+
+      if (self->queued == 0) break;
+      buffer = self->memory + self->tail * self->buffer_size;
+      length = self->lengths[self->tail];
+
+      if (!self->error)
+      {
+         pthread_mutex_unlock(&self->lock);
+         failed = write_buffer(self, buffer, length);
+         pthread_mutex_lock(&self->lock);
+      }
+
+      if (failed) self->error = 1;
+      self->tail = (self->tail + 1) % self->count;
+      self->queued--;
+      pthread_cond_broadcast(&self->drained);
+   }
+
+   pthread_mutex_unlock(&self->lock);
+   return 0;
+}
+
+/********************************************************************************
+* enqueue: Kar aktuell buffert fr skrivning och vcker bakgrundstrden.
+*          Lset mste vara taget av anroparen.
+*
+*          - self: Pekare till utstrmmen.
+********************************************************************************/
+static void enqueue(struct int_vector_writer* self)
+{
+   self->lengths[self->head] = self->length;
+   self->head = (self->head + 1) % self->count;
+   self->queued++;
+   pthread_cond_signal(&self->filled);
+   return;
+}
+
+/********************************************************************************
+* submit: Kar aktuell buffert fr skrivning och vntar vid behov tills
+*         nsta buffert i ringen har skrivits (mottryck), varefter denna blir
+*         aktuell buffert. Om ett skrivfel har uppsttt returneras felkod 1,
+*         annars 0.
+*
+*         - self: Pekare till utstrmmen.
+********************************************************************************/
+static int submit(struct int_vector_writer* self)
+{
+   int error;
+   pthread_mutex_lock(&self->lock);
+   enqueue(self);
+
+   while (self->queued == self->count)
+   {
+      pthread_cond_wait(&self->drained, &self->lock);
+   }
+
+   error = self->error;
+   pthread_mutex_unlock(&self->lock);
+
+   self->current = self->memory + self->head * self->buffer_size;
+   self->length = 0;
+   return error;
+}
+
+/********************************************************************************
+* int_vector_writer_open_with: ppnar angiven fil fr skrivning via angiven
+*                              utstrm och startar bakgrundstrden.
+*
+*                              - self       : Pekare till utstrmmen.
+*                              - path       : Skvg till filen.
+*                              - buffer_size: Storleken p varje buffert i byte.
+*                              - count      : Antalet buffertar.
+*                              - flags      : Flaggor.
+*                              - preallocate: Antalet byte som frallokeras.
+********************************************************************************/
+int int_vector_writer_open_with(struct int_vector_writer* self,
+                                const char* path,
+                                size_t buffer_size,
+                                size_t count,
+                                const int flags,
+                                const size_t preallocate)
+{
+   void* memory;
+   const int mode = O_WRONLY | O_CREAT | O_TRUNC;
+
+   if (buffer_size == 0) buffer_size = INT_VECTOR_WRITER_BUFFER_SIZE;
+   if (count == 0) count = INT_VECTOR_WRITER_BUFFERS;
+   if (count < 2) count = 2;
+
+   buffer_size = (buffer_size + INT_VECTOR_WRITER_ALIGNMENT - 1) /
+                 INT_VECTOR_WRITER_ALIGNMENT * INT_VECTOR_WRITER_ALIGNMENT;
+   if (buffer_size < INT_VECTOR_WRITER_ALIGNMENT || count > SIZE_MAX / buffer_size) return 1;
+
+   if (posix_memalign(&memory, INT_VECTOR_WRITER_ALIGNMENT, buffer_size * count)) return 1;
+   self->memory = (char*)memory;
+   self->lengths = (size_t*)malloc(sizeof(size_t) * count);
+
+   if (!self->lengths)
+   {
+      free(self->memory);
+      return 1;
+   }
+
+   self->direct = 0;
+
+#ifdef O_DIRECT
+   if (flags & INT_VECTOR_WRITER_DIRECT)
+   {
+      self->fd = open(path, mode | O_DIRECT, 0666);
+      self->direct = self->fd != -1;
+   }
+#else
+   (void)flags;
+#endif
+
+   if (!self->direct) self->fd = open(path, mode, 0666);
+
+   if (self->fd == -1)
+   {
+      free(self->lengths);
+      free(self->memory);
+      return 1;
+   }
+
+   self->preallocate = preallocate;
+   if (preallocate > 0 && posix_fallocate(self->fd, 0, (off_t)preallocate) != 0) self->preallocate = 0;
+
+   self->current = self->memory;
+   self->length = 0;
+   self->buffer_size = buffer_size;
+   self->count = count;
+   self->head = 0;
+   self->tail = 0;
+   self->queued = 0;
+   self->offset = 0;
+   self->error = 0;
+   self->closing = 0;
+
+   pthread_mutex_init(&self->lock, 0);
+   pthread_cond_init(&self->filled, 0);
+   pthread_cond_init(&self->drained, 0);
+
+   if (pthread_create(&self->thread, 0, drain, self) != 0)
+   {
+      pthread_cond_destroy(&self->drained);
+      pthread_cond_destroy(&self->filled);
+      pthread_mutex_destroy(&self->lock);
+      close(self->fd);
+      free(self->lengths);
+      free(self->memory);
+      return 1;
+   }
+
+   return 0;
+}
+
+/********************************************************************************
+* int_vector_writer_write: Kopierar angivna byte till utstrmmens buffertar,
+*                          dr varje fylld buffert kas fr skrivning.
+*
+*                          - self: Pekare till utstrmmen.
+*                          - data: Pekare till de byte som ska skrivas.
+*                          - size: Antalet byte som ska skrivas.
+********************************************************************************/
+int int_vector_writer_write(struct int_vector_writer* self,
+                            const void* data,
+                            size_t size)
+{
+   const char* source = (const char*)data;
+
+   while (size > 0)
+   {
+      const size_t room = self->buffer_size - self->length;
+      const size_t count = size < room ? size : room;
+
+      memcpy(self->current + self->length, source, count);
+      self->length += count;
+      source += count;
+      size -= count;
+
+      if (self->length == self->buffer_size && submit(self)) return 1;
+   }
+
+   return 0;
+}
+
+/********************************************************************************
+* int_vector_writer_print_range: Skriver ut angivet antal element via angiven
+*                                utstrm. Elementen formateras direkt i
+*                                aktuell buffert s lnge ett helt element
+*                                garanterat ryms. Drefter formateras ett
+*                                element i taget till en lokal buffert och
+*                                kopieras via int_vector_writer_write, vilket
+*                                delar elementet mellan tv buffertar s att
+*                                varje buffert fylls helt.
+*
+*                                - self    : Pekare till utstrmmen.
+*                                - context : Pekare till elementens klla.
+*                                - size    : Antalet element.
+*                                - max_line: Maximalt antal tecken per element.
+*                                - format  : Funktionen som formaterar elementen.
+********************************************************************************/
+int int_vector_writer_print_range(struct int_vector_writer* self,
+                                  const void* context,
+                                  const size_t size,
+                                  const size_t max_line,
+                                  int_format_range_fn format)
+{
+   static const char header[] = INT_FORMAT_SEPARATOR "\n";
+   static const char footer[] = INT_FORMAT_SEPARATOR "\n\n";
+   char line[INT_VECTOR_WRITER_MAX_LINE];
+   size_t i = 0;
+
+   if (size == 0) return 0;
+   if (int_vector_writer_write(self, header, sizeof(header) - 1)) return 1;
+
+   while (i < size)
+   {
+      const size_t room = (self->buffer_size - self->length) / max_line;
+
+      if (room == 0)
+      {
+         if (int_vector_writer_write(self, line, format(line, context, i, 1))) return 1;
+         i++;
+      }
+      else
+      {
+         const size_t count = room < size - i ? room : size - i;
+         self->length += format(self->current + self->length, context, i, count);
+         i += count;
+         if (self->length == self->buffer_size && submit(self)) return 1;
+      }
+   }
+
+   return int_vector_writer_write(self, footer, sizeof(footer) - 1);
+}
+
+/********************************************************************************
+* format_ints: Formaterar angivet antal heltal frn angivet index i ett flt,
+*              se int_format_range_fn.
+*
+*              - s      : Pekare till bufferten som ska tilldelas tecknen.
+*              - context: Pekare till fltets frsta heltal.
+*              - first  : Index fr det frsta heltalet.
+*              - count  : Antalet heltal som ska formateras.
+********************************************************************************/
+static size_t format_ints(char* s,
+                          const void* context,
+                          const size_t first,
+                          const size_t count)
+{
+   return int_format_lines(s, (const int*)context + first, count);
+}
+
+/********************************************************************************
+* int_vector_writer_print: Skriver ut heltalen i angiven vektor via angiven
+*                          utstrm med samma format som int_vector_print.
+*
+*                          - self  : Pekare till utstrmmen.
+*                          - vector: Pekare till vektorn som ska skrivas ut.
+********************************************************************************/
+int int_vector_writer_print(struct int_vector_writer* self,
+                            const struct int_vector* vector)
+{
+   return int_vector_writer_print_range(self, vector->data, vector->size,
+                                        INT_FORMAT_MAX_LINE, format_ints);
+}
+
+/********************************************************************************
+* int_vector_writer_flush: Kar aktuell buffert och vntar tills samtliga
+*                          kade buffertar har skrivits till filen.
+*
+*                          - self: Pekare till utstrmmen.
+********************************************************************************/
+int int_vector_writer_flush(struct int_vector_writer* self)
+{
+   int error;
+   pthread_mutex_lock(&self->lock);
+   if (self->length > 0) enqueue(self);
+
+   while (self->queued > 0)
+   {
+      pthread_cond_wait(&self->drained, &self->lock);
+   }
+
+   error = self->error;
+   pthread_mutex_unlock(&self->lock);
+
+   self->current = self->memory + self->head * self->buffer_size;
+   self->length = 0;
+   return error;
+}
+
+/********************************************************************************
+* int_vector_writer_close: Skriver terstende buffertar till filen, avslutar
+*                          bakgrundstrden och stnger filen. Vid
+*                          frallokering kortas filen till det antal byte
+*                          som faktiskt skrevs.
+*
+*                          - self: Pekare till utstrmmen.
+********************************************************************************/
+int int_vector_writer_close(struct int_vector_writer* self)
+{
+   int error = int_vector_writer_flush(self);
+
+   pthread_mutex_lock(&self->lock);
+   self->closing = 1;
+   pthread_cond_signal(&self->filled);
+   pthread_mutex_unlock(&self->lock);
+   pthread_join(self->thread, 0);
+
+   if (self->preallocate > 0 && self->offset < self->preallocate &&
+       ftruncate(self->fd, (off_t)self->offset) != 0)
+   {
+      error = 1;
+   }
+
+   if (close(self->fd) != 0) error = 1;
+
+   pthread_cond_destroy(&self->drained);
+   pthread_cond_destroy(&self->filled);
+   pthread_mutex_destroy(&self->lock);
+   free(self->lengths);
+   free(self->memory);
+   return error;
+}
\ No newline at end of file
@@ -0,0 +1,229 @@
+/********************************************************************************
+* int_vector_writer.h: Innehller strukten int_vector_writer, en asynkron
+*                      utstrm till en fil, samt associerade funktioner.
+*
+*                      Vid utskrift via int_vector_print vntar anroparen
+*                      medan varje buffert skrivs till disken. En
+*                      int_vector_writer formaterar i stllet till en ring
+*                      av buffertar, medan en bakgrundstrd skriver fyllda
+*                      buffertar till filen i tur och ordning. Drmed
+*                      verlappar skrivningen till disken anroparens
+*                      fortsatta arbete, exempelvis berkningen av nsta
+*                      omgng heltal.
+*
+*                      Minnestgngen r begrnsad till ringens buffertar.
+*                      Om samtliga buffertar vntar p att skrivas blockeras
+*                      anroparen tills bakgrundstrden har skrivit en
+*                      buffert (mottryck). Buffertarna fylls alltid helt
+*                      innan de skrivs, varfr varje skrivning utom den
+*                      sista omfattar exakt en buffert.
+*
+*                      Skrivfel sparas av bakgrundstrden och rapporteras
+*                      via efterfljande anrop samt via
+*                      int_vector_writer_flush och int_vector_writer_close.
+*                      Efter ett skrivfel kastas terstende buffertar.
+*
+*                      Vid behov kan filen ppnas med O_DIRECT, s att
+*                      stora utskrifter inte passerar sidcachen, samt
+*                      frallokeras via posix_fallocate, se
+*                      int_vector_writer_open_with.
+********************************************************************************/
+#ifndef INT_VECTOR_WRITER_H_
+#define INT_VECTOR_WRITER_H_
+
+/* Inkluderingsdirektiv: */
+#include <pthread.h> /* Innehller pthread_t, pthread_mutex_t med mera. */
+
+#include "int_vector.h"
+#include "int_format.h"
+
+/********************************************************************************
+* INT_VECTOR_WRITER_BUFFER_SIZE: Standardstorlek i byte fr varje buffert.
+********************************************************************************/
+#ifndef INT_VECTOR_WRITER_BUFFER_SIZE
+#define INT_VECTOR_WRITER_BUFFER_SIZE (1 << 20)
+#endif
+
+/********************************************************************************
+* INT_VECTOR_WRITER_BUFFERS: Standardantal buffertar i ringen.
+********************************************************************************/
+#ifndef INT_VECTOR_WRITER_BUFFERS
+#define INT_VECTOR_WRITER_BUFFERS 4
+#endif
+
+/********************************************************************************
+* INT_VECTOR_WRITER_ALIGNMENT: Justering i byte fr buffertarna samt fr
+*                              buffertstorleken, vilket krvs av O_DIRECT.
+********************************************************************************/
+#define INT_VECTOR_WRITER_ALIGNMENT 4096
+
+/********************************************************************************
+* INT_VECTOR_WRITER_MAX_LINE: Maximalt antal tecken per element inklusive
+*                             radbrytning vid utskrift via
+*                             int_vector_writer_print_range.
+********************************************************************************/
+#define INT_VECTOR_WRITER_MAX_LINE 64
+
+/********************************************************************************
+* int_vector_writer_flags: Flaggor vid ppning av en int_vector_writer.
+*
+*                          - INT_VECTOR_WRITER_DIRECT: Skriver frbi sidcachen
+*                            via O_DIRECT om plattformen och filsystemet
+*                            stder detta, annars ignoreras flaggan.
+********************************************************************************/
+enum int_vector_writer_flags
+{
+   INT_VECTOR_WRITER_DIRECT = 1
+};
+
+/********************************************************************************
+* int_vector_writer: Strukt fr en asynkron utstrm till en fil. Flten
+*                    head, tail, queued, error och closing delas med
+*                    bakgrundstrden och skyddas av lset. Strukten fr
+*                    inte kopieras via tilldelning.
+********************************************************************************/
+struct int_vector_writer
+{
+   char* memory;               /* Ringens buffertar i ett sammanhngande block. */
+   size_t* lengths;            /* Antalet byte i varje kad buffert. */
+   char* current;              /* Bufferten som fylls av anroparen. */
+   size_t length;              /* Antalet byte i aktuell buffert. */
+   size_t buffer_size;         /* Storleken p varje buffert i byte. */
+   size_t count;               /* Antalet buffertar i ringen. */
+   size_t head;                /* Index fr aktuell buffert. */
+   size_t tail;                /* Index fr nsta buffert som ska skrivas. */
+   size_t queued;              /* Antalet buffertar som vntar p att skrivas. */
+   unsigned long long offset;  /* Antalet byte som har skrivits till filen. */
+   size_t preallocate;         /* Antalet frallokerade byte. */
+   int fd;                     /* Filens fildeskriptor. */
+   int direct;                 /* Indikerar ifall filen skrivs via O_DIRECT. */
+   int error;                  /* Indikerar ifall ett skrivfel har uppsttt. */
+   int closing;                /* Indikerar att bakgrundstrden ska avslutas. */
+   pthread_mutex_t lock;       /* Ls fr flten som delas med trden. */
+   pthread_cond_t filled;      /* Signaleras nr en buffert har kats. */
+   pthread_cond_t drained;     /* Signaleras nr en buffert har skrivits. */
+   pthread_t thread;           /* Bakgrundstrden. */
+};
+
+/********************************************************************************
+* int_vector_writer_open_with: ppnar angiven fil fr skrivning via angiven
+*                              utstrm, varvid filens tidigare innehll
+*                              tms, och startar bakgrundstrden. Vid lyckad
+*                              ppning returneras 0, annars returneras
+*                              felkod 1 och ingen fil eller trd lmnas
+*                              ppen.
+*
+*                              - self       : Pekare till utstrmmen.
+*                              - path       : Skvg till filen.
+*                              - buffer_size: Storleken p varje buffert i
+*                                             byte, som avrundas uppt till
+*                                             en multipel av
+*                                             INT_VECTOR_WRITER_ALIGNMENT
+*                                             (0 = standardstorlek).
+*                              - count      : Antalet buffertar, minst 2
+*                                             (0 = standardantal).
+*                              - flags      : Flaggor, se
+*                                             int_vector_writer_flags.
+*                              - preallocate: Frvntat antal byte som
+*                                             frallokeras via
+*                                             posix_fallocate, vilket
+*                                             minskar fragmenteringen vid
+*                                             stora utskrifter (0 = ingen
+*                                             frallokering). Filen kortas
+*                                             vid stngning till det antal
+*                                             byte som faktiskt skrevs.
+********************************************************************************/
+int int_vector_writer_open_with(struct int_vector_writer* self,
+                                const char* path,
+                                size_t buffer_size,
+                                size_t count,
+                                const int flags,
+                                const size_t preallocate);
+
+/********************************************************************************
+* int_vector_writer_open: ppnar angiven fil fr skrivning via angiven
+*                         utstrm med standardstorlek och standardantal
+*                         buffertar. Vid lyckad ppning returneras 0, annars
+*                         felkod 1.
+*
+*                         - self: Pekare till utstrmmen.
+*                         - path: Skvg till filen.
+********************************************************************************/
+static inline int int_vector_writer_open(struct int_vector_writer* self,
+                                         const char* path)
+{
+   return int_vector_writer_open_with(self, path, 0, 0, 0, 0);
+}
+
+/********************************************************************************
+* int_vector_writer_write: Kopierar angivna byte till utstrmmens buffertar.
+*                          Varje fylld buffert kas fr skrivning, varvid
+*                          anroparen blockeras om samtliga buffertar r
+*                          kade. Om ett skrivfel har uppsttt returneras
+*                          felkod 1, annars 0.
+*
+*                          - self: Pekare till utstrmmen.
+*                          - data: Pekare till de byte som ska skrivas.
+*                          - size: Antalet byte som ska skrivas.
+********************************************************************************/
+int int_vector_writer_write(struct int_vector_writer* self,
+                            const void* data,
+                            size_t size);
+
+/********************************************************************************
+* int_vector_writer_print_range: Skriver ut angivet antal element via angiven
+*                                utstrm med samma format som
+*                                int_format_print_range, dr elementen
+*                                formateras direkt i utstrmmens buffertar.
+*                                Om ett skrivfel har uppsttt returneras
+*                                felkod 1, annars 0.
+*
+*                                - self    : Pekare till utstrmmen.
+*                                - context : Pekare till elementens klla.
+*                                - size    : Antalet element som ska skrivas ut.
+*                                - max_line: Maximalt antal tecken per element
+*                                            inklusive radbrytning, hgst
+*                                            INT_VECTOR_WRITER_MAX_LINE.
+*                                - format  : Funktionen som formaterar elementen.
+********************************************************************************/
+int int_vector_writer_print_range(struct int_vector_writer* self,
+                                  const void* context,
+                                  const size_t size,
+                                  const size_t max_line,
+                                  int_format_range_fn format);
+
+/********************************************************************************
+* int_vector_writer_print: Skriver ut heltalen i angiven vektor via angiven
+*                          utstrm med samma format som int_vector_print.
+*                          Om ett skrivfel har uppsttt returneras felkod 1,
+*                          annars 0.
+*
+*                          - self  : Pekare till utstrmmen.
+*                          - vector: Pekare till vektorn som ska skrivas ut.
+********************************************************************************/
+int int_vector_writer_print(struct int_vector_writer* self,
+                            const struct int_vector* vector);
+
+/********************************************************************************
+* int_vector_writer_flush: Kar aktuell buffert, ven om den inte r full,
+*                          och vntar tills samtliga kade buffertar har
+*                          skrivits till filen. Om ett skrivfel har
+*                          uppsttt returneras felkod 1, annars 0. Data
+*                          synkroniseras inte till disken, se fsync.
+*
+*                          - self: Pekare till utstrmmen.
+********************************************************************************/
+int int_vector_writer_flush(struct int_vector_writer* self);
+
+/********************************************************************************
+* int_vector_writer_close: Skriver terstende buffertar till filen, avslutar
+*                          bakgrundstrden, stnger filen och frigr
+*                          buffertarna. Om ngot skrivfel har uppsttt,
+*                          inklusive vid stngningen av filen, returneras
+*                          felkod 1, annars 0.
+*
+*                          - self: Pekare till utstrmmen.
+********************************************************************************/
+int int_vector_writer_close(struct int_vector_writer* self);
+
+#endif /* INT_VECTOR_WRITER_H_ */
\ No newline at end of file
@@ -0,0 +1,71 @@
+/********************************************************************************
+* vector_family.h: Inkluderar samtliga vektortyper som genereras via
+*                  vector_template.h, dvs. i8_vector, i16_vector, i32_vector
+*                  (int_vector), i64_vector och f32_vector, samt
+*                  funktionalitet fr att vlja den smalaste heltalstypen som
+*                  rymmer ett givet vrdeintervall.
+*
+*                  Smalare element ger fler element per cachelinje och per
+*                  vektorregister, vilket minskar minnesbandbredden vid
+*                  exempelvis summering och kopiering. Ett flt med vrden i
+*                  intervallet [0, 100] upptar en fjrdedel s mycket minne
+*                  som i8_vector jmfrt med int_vector.
+********************************************************************************/
+#ifndef VECTOR_FAMILY_H_
+#define VECTOR_FAMILY_H_
+
+/* Inkluderingsdirektiv: */
+#include "i8_vector.h"
+#include "i16_vector.h"
+#include "i32_vector.h"
+#include "i64_vector.h"
+#include "f32_vector.h"
+
+/********************************************************************************
+* vector_width: Enumeration fr heltalsvektorernas elementbredd.
+********************************************************************************/
+enum vector_width
+{
+   VECTOR_WIDTH_8,  /* i8_vector. */
+   VECTOR_WIDTH_16, /* i16_vector. */
+   VECTOR_WIDTH_32, /* i32_vector, dvs. int_vector. */
+   VECTOR_WIDTH_64  /* i64_vector. */
+};
+
+/********************************************************************************
+* vector_width_for_range: Returnerar den smalaste elementbredd vars heltalstyp
+*                         rymmer samtliga vrden i det slutna intervallet
+*                         [min, max]. Om min verstiger max returneras
+*                         VECTOR_WIDTH_8, eftersom intervallet d r tomt.
+*
+*                         - min: Intervallets minsta vrde.
+*                         - max: Intervallets strsta vrde.
+********************************************************************************/
+static inline enum vector_width vector_width_for_range(const long long min,
+                                                       const long long max)
+{
+   if (min > max) return VECTOR_WIDTH_8;
+   if (min >= INT8_MIN && max <= INT8_MAX) return VECTOR_WIDTH_8;
+   if (min >= INT16_MIN && max <= INT16_MAX) return VECTOR_WIDTH_16;
+   if (min >= INT32_MIN && max <= INT32_MAX) return VECTOR_WIDTH_32;
+   return VECTOR_WIDTH_64;
+}
+
+/********************************************************************************
+* vector_width_name: Returnerar namnet p vektortypen med angiven elementbredd,
+*                    exempelvis "i16_vector".
+*
+*                    - width: Elementbredden.
+********************************************************************************/
+static inline const char* vector_width_name(const enum vector_width width)
+{
+   switch (width)
+   {
+      case VECTOR_WIDTH_8:  return "i8_vector";
+      case VECTOR_WIDTH_16: return "i16_vector";
+      case VECTOR_WIDTH_32: return "i32_vector";
+      default:              return "i64_vector";
+   }
+}
+
+#endif /* VECTOR_FAMILY_H_ */
\ No newline at end of file
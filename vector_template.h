@@ -0,0 +1,568 @@
+/********************************************************************************
+* vector_template.h: Mall fr dynamiska vektorer av godtycklig elementtyp.
+*                    Vid varje inkludering genereras en strukt samt samtliga
+*                    associerade funktioner fr den elementtyp som anges via
+*                    makron enligt nedan, dr exempelvis VECTOR_NAME satt
+*                    till i8_vector ger strukten i8_vector samt funktionerna
+*                    i8_vector_init, i8_vector_push med mera:
+*
+*                    - VECTOR_NAME          : Vektortypens namn.
+*                    - VECTOR_TYPE          : Elementtypen.
+*                    - VECTOR_SUM_TYPE      : Returtypen vid summering.
+*                    - VECTOR_SMALL_CAPACITY: Antalet element som ryms i den
+*                                             inbyggda bufferten.
+*
+*                    Samtliga makron odefinieras efter inkluderingen, s att
+*                    mallen kan inkluderas flera gnger i samma fil.
+*                    Motsvarande funktionsdefinitioner genereras via
+*                    vector_template_impl.h, som inkluderas i en kllkodsfil
+*                    per elementtyp.
+*
+*                    Funktionerna beskrivs nedan med prefixet vector_, som
+*                    erstts av angivet namn, exempelvis int_vector_push.
+********************************************************************************/
+#ifndef VECTOR_TEMPLATE_H_
+#define VECTOR_TEMPLATE_H_
+
+/* Inkluderingsdirektiv: */
+#include <stdio.h>  /* Innehller printf, FILE* med mera. */
+#include <stdlib.h> /* Innehller malloc, realloc och free. */
+
+#include "allocator.h"
+#include "int_vector_stats.h"
+
+/********************************************************************************
+* VECTOR_PASTE: Sammanfogar angivet vektornamn och funktionsnamn med ett
+*               understreck emellan, exempelvis int_vector och push till
+*               int_vector_push, efter att makron i argumenten har expanderats.
+********************************************************************************/
+#define VECTOR_PASTE_(name, function) name##_##function
+#define VECTOR_PASTE(name, function) VECTOR_PASTE_(name, function)
+
+/********************************************************************************
+* VECTOR_FN: Returnerar namnet p angiven funktion fr aktuell vektortyp.
+********************************************************************************/
+#define VECTOR_FN(function) VECTOR_PASTE(VECTOR_NAME, function)
+
+/********************************************************************************
+* INT_VECTOR_GROWTH_FACTOR: Standardvrde fr tillvxtfaktorn, dvs. den faktor
+*                           som kapaciteten multipliceras med nr en vektor
+*                           blir full. Kan ndras i krtid per vektortyp via
+*                           funktionen vector_set_growth_factor.
+********************************************************************************/
+#ifndef INT_VECTOR_GROWTH_FACTOR
+#define INT_VECTOR_GROWTH_FACTOR 2.0
+#endif
+
+/********************************************************************************
+* INT_VECTOR_MIN_CAPACITY: Minsta kapacitet som allokeras nr en tom vektor
+*                          vxer, s att de frsta pushoperationerna inte
+*                          medfr en omallokering vardera.
+********************************************************************************/
+#ifndef INT_VECTOR_MIN_CAPACITY
+#define INT_VECTOR_MIN_CAPACITY 4
+#endif
+
+/********************************************************************************
+* INT_VECTOR_SHRINK_THRESHOLD: Standardvrde fr lgvattenmrket, dvs. den
+*                              andel av kapaciteten som storleken mste
+*                              understiga innan en popoperation halverar
+*                              kapaciteten. Kan ndras i krtid per vektortyp
+*                              via funktionen vector_set_shrink_threshold.
+********************************************************************************/
+#ifndef INT_VECTOR_SHRINK_THRESHOLD
+#define INT_VECTOR_SHRINK_THRESHOLD 0.25
+#endif
+
+/********************************************************************************
+* INT_VECTOR_SMALL_CAPACITY: Antalet heltal av typen int som ryms i
+*                            int_vectors inbyggda buffert. S lnge en vektor
+*                            inte rymmer fler element n s lagras de direkt
+*                            i strukten utan ngon minnesallokering p
+*                            heapen. Nr vektorn vxer frbi bufferten flyttas
+*                            elementen till heapen automatiskt. vriga
+*                            vektortyper fr en buffert av samma storlek i
+*                            byte, exempelvis 64 element fr i8_vector.
+********************************************************************************/
+#ifndef INT_VECTOR_SMALL_CAPACITY
+#define INT_VECTOR_SMALL_CAPACITY 16
+#endif
+
+#if INT_VECTOR_SMALL_CAPACITY < 1
+#error "INT_VECTOR_SMALL_CAPACITY mste vara minst 1!"
+#endif
+
+/********************************************************************************
+* VECTOR_SMALL_BYTES: Storleken i byte p samtliga vektortypers inbyggda
+*                     buffert.
+********************************************************************************/
+#define VECTOR_SMALL_BYTES (INT_VECTOR_SMALL_CAPACITY * sizeof(int))
+
+#endif /* VECTOR_TEMPLATE_H_ */
+
+#if !defined(VECTOR_NAME) || !defined(VECTOR_TYPE) || \
+    !defined(VECTOR_SUM_TYPE) || !defined(VECTOR_SMALL_CAPACITY)
+#error "VECTOR_NAME, VECTOR_TYPE, VECTOR_SUM_TYPE och VECTOR_SMALL_CAPACITY mste definieras!"
+#endif
+
+/********************************************************************************
+* vector: Strukt fr dynamiska arrayer (vektorer) innehllande element av
+*         angiven typ. Eftersom fltpekaren kan peka p strukturens inbyggda
+*         buffert fr en vektor inte kopieras via tilldelning, utan
+*         elementen ska i stllet kopieras via exempelvis vector_concat.
+********************************************************************************/
+struct VECTOR_NAME
+{
+   VECTOR_TYPE* data; /* Pekare till det dynamiska fltet (arrayen). */
+   size_t size;       /* Vektorns storlek, dvs. antalet element den rymmer. */
+   size_t capacity;   /* Vektorns kapacitet, dvs. antalet element som ryms i
+                         allokerat minne innan omallokering krvs. Lnat minne
+                         har kapacitet 0. */
+   int borrowed;      /* Indikerar lnat minne som vektorn inte ger och som
+                         endast fr lsas, exempelvis en minnesmappad fil. */
+   const struct allocator* allocator; /* Allokerare fr fltet, null = malloc. */
+   VECTOR_TYPE small_buffer[VECTOR_SMALL_CAPACITY]; /* Inbyggd buffert fr korta vektorer. */
+};
+
+/********************************************************************************
+* vector_init: Initierar ny tom dynamisk vektor, vars element lagras i den
+*              inbyggda bufferten tills vektorn vxer frbi denna.
+*
+*              - self: Pekare till den vektor som ska initieras.
+********************************************************************************/
+static inline void VECTOR_FN(init)(struct VECTOR_NAME* self)
+{
+   self->data = self->small_buffer;
+   self->size = 0;
+   self->capacity = VECTOR_SMALL_CAPACITY;
+   self->borrowed = 0;
+   self->allocator = 0;
+   return;
+}
+
+/********************************************************************************
+* vector_init_with: Initierar ny tom dynamisk vektor, vars flt allokeras via
+*                   angiven allokerare, exempelvis en arena. Allokeraren mste
+*                   finnas kvar s lnge vektorn anvnds och bibehlls nr
+*                   vektorn tms.
+*
+*                   - self     : Pekare till den vektor som ska initieras.
+*                   - allocator: Pekare till allokeraren (null = malloc).
+********************************************************************************/
+static inline void VECTOR_FN(init_with)(struct VECTOR_NAME* self,
+                                        const struct allocator* allocator)
+{
+   VECTOR_FN(init)(self);
+   self->allocator = allocator;
+   return;
+}
+
+/********************************************************************************
+* vector_is_small: Indikerar ifall elementen i angiven vektor lagras i dess
+*                  inbyggda buffert, dvs. utan minnesallokering p heapen.
+*
+*                  - self: Pekare till vektorn.
+********************************************************************************/
+static inline int VECTOR_FN(is_small)(const struct VECTOR_NAME* self)
+{
+   return self->data == self->small_buffer;
+}
+
+/********************************************************************************
+* vector_is_borrowed: Indikerar ifall angiven vektor har lnat minne, som
+*                     endast fr lsas. Funktioner som ndrar en sdan vektor,
+*                     exempelvis vector_push, vector_pop och vector_resize,
+*                     returnerar felkod 1 och lmnar vektorn intakt, ven nr
+*                     vektorn r tom. Referensen slpps via vector_clear,
+*                     varefter vektorn kan anvndas som vanligt.
+*
+*                     - self: Pekare till vektorn.
+********************************************************************************/
+static inline int VECTOR_FN(is_borrowed)(const struct VECTOR_NAME* self)
+{
+   return self->borrowed;
+}
+
+/********************************************************************************
+* vector_clear: Tmmer angiven dynamisk vektor och frigr allokerat minne,
+*               dvs. storleken stts till noll och kapaciteten tergr till
+*               den inbyggda buffertens. Lnat minne frigrs inte, utan
+*               vektorn slpper endast sin referens till detta. Vektorns
+*               allokerare bibehlls.
+*
+*               - self: Pekare till den vektor som ska tmmas.
+********************************************************************************/
+static inline void VECTOR_FN(clear)(struct VECTOR_NAME* self)
+{
+   if (!self->borrowed && !VECTOR_FN(is_small)(self))
+   {
+      allocator_free(self->allocator, self->data, self->capacity * sizeof(VECTOR_TYPE));
+      INT_VECTOR_STATS_FREE(self->capacity * sizeof(VECTOR_TYPE));
+   }
+   VECTOR_FN(init_with)(self, self->allocator);
+   return;
+}
+
+/********************************************************************************
+* vector_new: Returnerar en pekare till en ny dynamiskt allokerad vektor, som
+*             initieras till tom vid start. Om minnesallokeringen misslyckas
+*             returneras null.
+********************************************************************************/
+static inline struct VECTOR_NAME* VECTOR_FN(new)(void)
+{
+   struct VECTOR_NAME* self = (struct VECTOR_NAME*)malloc(sizeof(struct VECTOR_NAME));
+   if (!self) return 0;
+   VECTOR_FN(init)(self);
+   return self;
+}
+
+/********************************************************************************
+* vector_new_with: Returnerar en pekare till en ny dynamiskt allokerad vektor,
+*                  vars huvud allokeras via en allokerare och vars flt
+*                  allokeras via en annan, exempelvis en pool fr huvudena
+*                  och en arena fr flten. Om minnesallokeringen misslyckas
+*                  returneras null. Vektorn ska raderas via vector_delete_with
+*                  med samma huvudallokerare.
+*
+*                  - header_allocator: Allokerare fr vektorns huvud
+*                                      (null = malloc).
+*                  - data_allocator  : Allokerare fr vektorns flt
+*                                      (null = malloc).
+********************************************************************************/
+static inline struct VECTOR_NAME* VECTOR_FN(new_with)(const struct allocator* header_allocator,
+                                                      const struct allocator* data_allocator)
+{
+   struct VECTOR_NAME* self =
+      (struct VECTOR_NAME*)allocator_alloc(header_allocator, sizeof(struct VECTOR_NAME));
+   if (!self) return 0;
+   VECTOR_FN(init_with)(self, data_allocator);
+   return self;
+}
+
+/********************************************************************************
+* vector_delete: Raderar angiven dynamiskt allokerad vektor och stter
+*                vektorpekaren till null.
+*
+*                - self: Adressen till vektorpekaren.
+********************************************************************************/
+static inline void VECTOR_FN(delete)(struct VECTOR_NAME** self)
+{
+   VECTOR_FN(clear)(*self);
+   free(*self);
+   *self = 0;
+   return;
+}
+
+/********************************************************************************
+* vector_delete_with: Raderar angiven vektor allokerad via vector_new_with och
+*                     stter vektorpekaren till null.
+*
+*                     - self            : Adressen till vektorpekaren.
+*                     - header_allocator: Allokeraren som vektorns huvud
+*                                         allokerades via (null = malloc).
+********************************************************************************/
+static inline void VECTOR_FN(delete_with)(struct VECTOR_NAME** self,
+                                          const struct allocator* header_allocator)
+{
+   VECTOR_FN(clear)(*self);
+   allocator_free(header_allocator, *self, sizeof(struct VECTOR_NAME));
+   *self = 0;
+   return;
+}
+
+/********************************************************************************
+* vector_begin: Returnerar adressen till frsta elementet i angiven vektor.
+*               Om vektorn r tom r adressen lika med vector_end.
+*
+*               - self: Pekare till vektorn.
+********************************************************************************/
+static inline VECTOR_TYPE* VECTOR_FN(begin)(const struct VECTOR_NAME* self)
+{
+   return self->data;
+}
+
+/********************************************************************************
+* vector_end: Returnerar adressen efter sista elementet i angiven vektor.
+*             Om vektorn r tom r adressen lika med vector_begin.
+*
+*             - self: Pekare till vektorn.
+********************************************************************************/
+static inline VECTOR_TYPE* VECTOR_FN(end)(const struct VECTOR_NAME* self)
+{
+   return self->data + self->size;
+}
+
+/********************************************************************************
+* vector_last: Returnerar adressen till sista elementet i angiven vektor.
+*              Om vektorn r tom returneras null.
+*
+*              - self: Pekare till vektorn.
+********************************************************************************/
+static inline VECTOR_TYPE* VECTOR_FN(last)(const struct VECTOR_NAME* self)
+{
+   return self->size > 0 ? VECTOR_FN(end)(self) - 1 : 0;
+}
+
+/********************************************************************************
+* vector_capacity: Returnerar kapaciteten fr angiven vektor, dvs. antalet
+*                  element som ryms innan en omallokering krvs.
+*
+*                  - self: Pekare till vektorn.
+********************************************************************************/
+static inline size_t VECTOR_FN(capacity)(const struct VECTOR_NAME* self)
+{
+   return self->capacity;
+}
+
+/********************************************************************************
+* vector_set_growth_factor: Stter tillvxtfaktorn som anvnds nr en vektor
+*                           av aktuell typ behver vxa, exempelvis 1.5 eller
+*                           2.0. Faktorn mste verstiga 1.0, annars
+*                           returneras felkod 1 och nuvarande faktor
+*                           bibehlls. Vid lyckad ndring returneras 0.
+*
+*                           - factor: Den nya tillvxtfaktorn.
+********************************************************************************/
+int VECTOR_FN(set_growth_factor)(const double factor);
+
+/********************************************************************************
+* vector_growth_factor: Returnerar tillvxtfaktorn som anvnds nr en vektor
+*                       av aktuell typ behver vxa.
+********************************************************************************/
+double VECTOR_FN(growth_factor)(void);
+
+/********************************************************************************
+* vector_set_shrink_threshold: Stter lgvattenmrket fr popoperationer, dvs.
+*                              den andel av kapaciteten som storleken mste
+*                              understiga innan minne frigrs. Andelen mste
+*                              ligga i intervallet [0, 0.5), dr 0 stnger av
+*                              krympningen helt. Annars returneras felkod 1
+*                              och nuvarande vrde bibehlls. Vid lyckad
+*                              ndring returneras 0.
+*
+*                              - fraction: Det nya lgvattenmrket.
+********************************************************************************/
+int VECTOR_FN(set_shrink_threshold)(const double fraction);
+
+/********************************************************************************
+* vector_shrink_threshold: Returnerar lgvattenmrket fr popoperationer.
+********************************************************************************/
+double VECTOR_FN(shrink_threshold)(void);
+
+/********************************************************************************
+* vector_reserve: Skerstller att angiven vektor har kapacitet fr minst
+*                 angivet antal element utan att storleken ndras. Om
+*                 kapaciteten redan rcker genomfrs ingen omallokering. Vid
+*                 lyckad minnesallokering returneras 0, annars returneras
+*                 felkod 1 och vektorn lmnas intakt.
+*
+*                 - self    : Pekare till vektorn.
+*                 - capacity: Minsta kapacitet efter anropet.
+********************************************************************************/
+int VECTOR_FN(reserve)(struct VECTOR_NAME* self,
+                       const size_t capacity);
+
+/********************************************************************************
+* vector_shrink_to_fit: Minskar kapaciteten fr angiven vektor till dess
+*                       storlek s att outnyttjat minne frigrs. Element som
+*                       ryms i den inbyggda bufferten flyttas dit. Vid lyckad
+*                       minnesallokering returneras 0, annars returneras
+*                       felkod 1 och vektorn lmnas intakt.
+*
+*                       - self: Pekare till vektorn.
+********************************************************************************/
+int VECTOR_FN(shrink_to_fit)(struct VECTOR_NAME* self);
+
+/********************************************************************************
+* vector_resize: ndrar storleken p angiven dynamisk vektor. Omallokering sker
+*                endast om den nya storleken verstiger kapaciteten, vid
+*                minskning bibehlls kapaciteten. Vid storlek 0 tms vektorn
+*                och minnet frigrs. Vid lyckad minnesallokering returneras 0,
+*                annars returneras felkod 1.
+*
+*                - self: Pekare till den vektor vars storlek ska ndras.
+*                - size: Vektorns storlek efter omallokeringen.
+********************************************************************************/
+int VECTOR_FN(resize)(struct VECTOR_NAME* self,
+                      const size_t size);
+
+/********************************************************************************
+* vector_push: Lgger till ett nytt element lngst bak i angiven vektor. Nr
+*              vektorn r full vxer kapaciteten geometriskt med
+*              tillvxtfaktorn, vilket ger amorterad konstant tid per anrop.
+*              Om minnesallokeringen lyckas s returneras 0, annars felkod 1.
+*
+*              - self: Pekare till vektorn som ska tilldelas det nya elementet.
+*              - num : Det nya element som ska lggas till.
+********************************************************************************/
+int VECTOR_FN(push)(struct VECTOR_NAME* self,
+                    const VECTOR_TYPE num);
+
+/********************************************************************************
+* vector_pop: Tar bort sista elementet i angiven vektor i konstant tid utan
+*             omallokering. Frst nr storleken understiger lgvattenmrket
+*             halveras kapaciteten, vilket frhindrar att en vektor som
+*             pendlar kring en storleksgrns anropar allokeraren vid varje
+*             operation. Element som ryms i den inbyggda bufferten flyttas
+*             dit, annars understiger kapaciteten aldrig
+*             INT_VECTOR_MIN_CAPACITY. Minnet frigrs helt frst via
+*             vector_clear. Minnesallokering kan inte f anropet att
+*             misslyckas, drmed returneras 0 utom fr vektorer med lnat
+*             minne, d felkod 1 returneras.
+*
+*             - self: Pekare till vektorn vars sista element ska tas bort.
+********************************************************************************/
+int VECTOR_FN(pop)(struct VECTOR_NAME* self);
+
+/********************************************************************************
+* vector_append: Lgger till angivet antal element frn ett godtyckligt flt
+*                lngst bak i angiven vektor. Hgst en omallokering sker,
+*                varefter elementen kopieras i ett svep. Kllfltet fr ligga
+*                i vektorn sjlv. Vid lyckad minnesallokering returneras 0,
+*                annars returneras felkod 1 och vektorn lmnas intakt.
+*
+*                - self: Pekare till vektorn som ska tilldelas elementen.
+*                - src : Pekare till fltet som elementen kopieras frn.
+*                - n   : Antalet element som ska lggas till.
+********************************************************************************/
+int VECTOR_FN(append)(struct VECTOR_NAME* self,
+                      const VECTOR_TYPE* src,
+                      const size_t n);
+
+/********************************************************************************
+* vector_insert_range: Infogar angivet antal element frn ett godtyckligt flt
+*                      p angiven position i angiven vektor, dr efterfljande
+*                      element flyttas bakt. Hgst en omallokering sker.
+*                      Kllfltet fr ligga i vektorn sjlv. Vid lyckad
+*                      minnesallokering returneras 0. Om positionen ligger
+*                      utanfr vektorn eller minnesallokeringen misslyckas
+*                      returneras felkod 1 och vektorn lmnas intakt.
+*
+*                      - self: Pekare till vektorn.
+*                      - pos : Index dr det frsta elementet ska infogas.
+*                      - src : Pekare till fltet som elementen kopieras frn.
+*                      - n   : Antalet element som ska infogas.
+********************************************************************************/
+int VECTOR_FN(insert_range)(struct VECTOR_NAME* self,
+                            const size_t pos,
+                            const VECTOR_TYPE* src,
+                            const size_t n);
+
+/********************************************************************************
+* vector_erase_range: Tar bort elementen i det halvppna intervallet
+*                     [first, last) frn angiven vektor, dr efterfljande
+*                     element flyttas framt. Kapaciteten minskas enligt samma
+*                     lgvattenmrke som vid popoperationer. Vid lyckad
+*                     borttagning returneras 0. Om intervallet r ogiltigt
+*                     returneras felkod 1 och vektorn lmnas intakt.
+*
+*                     - self : Pekare till vektorn.
+*                     - first: Index fr det frsta elementet som tas bort.
+*                     - last : Index efter det sista elementet som tas bort.
+********************************************************************************/
+int VECTOR_FN(erase_range)(struct VECTOR_NAME* self,
+                           const size_t first,
+                           const size_t last);
+
+/********************************************************************************
+* vector_concat: Lgger till samtliga element i en vektor lngst bak i en
+*                annan vektor, dr kllvektorn lmnas ofrndrad. Samma vektor
+*                fr anges som bde ml och klla. Vid lyckad minnesallokering
+*                returneras 0, annars returneras felkod 1 och mlvektorn
+*                lmnas intakt.
+*
+*                - dst: Pekare till vektorn som ska tilldelas elementen.
+*                - src: Pekare till vektorn vars element ska kopieras.
+********************************************************************************/
+int VECTOR_FN(concat)(struct VECTOR_NAME* dst,
+                      const struct VECTOR_NAME* src);
+
+/********************************************************************************
+* vector_assign: Tilldelar element till angiven vektor med godtyckligt start-
+*                och stegvrde. Fr heltalstyper ger verslag
+*                tvkomplementsomslag, och fr int sker tilldelningen
+*                vektoriserat via int_simd_assign, se int_simd.h. Vektorer
+*                med lnat minne lmnas ofrndrade.
+*
+*                - self     : Pekare till vektorn som ska tilldelas.
+*                - start_val: Startvrde fr tilldelningen.
+*                - step_val : Stegvrde, dvs. differensen mellan varje element.
+********************************************************************************/
+void VECTOR_FN(assign)(struct VECTOR_NAME* self,
+                       const VECTOR_TYPE start_val,
+                       const VECTOR_TYPE step_val);
+
+/********************************************************************************
+* vector_sum: Returnerar summan av samtliga element i angiven vektor. Fr
+*             heltalstyper returneras summan som ett 64-bitars tal, s att
+*             summan inte slr ver fr 8-, 16- och 32-bitars element, och
+*             fr flyttal summeras i dubbel precision. Fr int sker
+*             summeringen vektoriserat via int_simd_sum, se int_simd.h.
+*
+*             - self: Pekare till vektorn.
+********************************************************************************/
+VECTOR_SUM_TYPE VECTOR_FN(sum)(const struct VECTOR_NAME* self);
+
+/********************************************************************************
+* vector_minmax: Tilldelar angivna variabler minsta respektive strsta
+*                element i angiven vektor. Vid lyckad skning returneras 0.
+*                Om vektorn r tom returneras felkod 1 och variablerna lmnas
+*                ofrndrade.
+*
+*                - self: Pekare till vektorn.
+*                - min : Pekare till variabel fr minsta elementet.
+*                - max : Pekare till variabel fr strsta elementet.
+********************************************************************************/
+int VECTOR_FN(minmax)(const struct VECTOR_NAME* self,
+                      VECTOR_TYPE* min,
+                      VECTOR_TYPE* max);
+
+/********************************************************************************
+* vector_count_eq: Returnerar antalet element i angiven vektor som r lika med
+*                  angivet vrde.
+*
+*                  - self : Pekare till vektorn.
+*                  - value: Vrdet som ska rknas.
+********************************************************************************/
+size_t VECTOR_FN(count_eq)(const struct VECTOR_NAME* self,
+                           const VECTOR_TYPE value);
+
+/********************************************************************************
+* vector_count_range: Returnerar antalet element i angiven vektor som ligger i
+*                     det slutna intervallet [low, high]. Om low verstiger
+*                     high returneras 0.
+*
+*                     - self: Pekare till vektorn.
+*                     - low : Intervallets undre grns (inklusive).
+*                     - high: Intervallets vre grns (inklusive).
+********************************************************************************/
+size_t VECTOR_FN(count_range)(const struct VECTOR_NAME* self,
+                              const VECTOR_TYPE low,
+                              const VECTOR_TYPE high);
+
+/********************************************************************************
+* vector_find: Returnerar adressen till frsta elementet i angiven vektor som
+*              r lika med angivet vrde. Om vrdet saknas returneras null.
+*
+*              - self : Pekare till vektorn.
+*              - value: Vrdet som ska skas efter.
+********************************************************************************/
+VECTOR_TYPE* VECTOR_FN(find)(const struct VECTOR_NAME* self,
+                             const VECTOR_TYPE value);
+
+/********************************************************************************
+* vector_print: Skriver ut elementen i angiven vektor via godtycklig utstrm,
+*               dr standardutenheten stdout anvnds som default fr utskrift
+*               i terminalen. Elementen formateras buffrat via elementtypens
+*               formaterare, se int_format.h.
+*
+*               - self   : Pekare till vektorn som ska skrivas ut.
+*               - ostream: Pekare till godtycklig utstrm (default = stdout).
+********************************************************************************/
+void VECTOR_FN(print)(const struct VECTOR_NAME* self,
+                      FILE* ostream);
+
+#undef VECTOR_NAME
+#undef VECTOR_TYPE
+#undef VECTOR_SUM_TYPE
+#undef VECTOR_SMALL_CAPACITY
\ No newline at end of file
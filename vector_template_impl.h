@@ -0,0 +1,618 @@
+/********************************************************************************
+* vector_template_impl.h: Mall fr definitioner av de funktioner som deklareras
+*                         i vector_template.h. Inkluderas i en kllkodsfil per
+*                         elementtyp efter typens header, dr fljande makron
+*                         anges p samma stt som fr vector_template.h:
+*
+*                         - VECTOR_NAME    : Vektortypens namn.
+*                         - VECTOR_TYPE    : Elementtypen.
+*                         - VECTOR_SUM_TYPE: Returtypen vid summering.
+*                         - VECTOR_LINES   : Funktion som formaterar element
+*                                            till text, se int_format.h.
+*                         - VECTOR_MAX_LINE: Maximalt antal tecken per
+*                                            formaterat element.
+*
+*                         Fr heltalstyper anges dessutom VECTOR_UNSIGNED_TYPE,
+*                         dvs. motsvarande teckenlsa typ, som anvnds fr
+*                         tvkomplementsomslag vid tilldelning och summering.
+*                         Fr flyttalstyper anges i stllet VECTOR_FLOATING.
+*                         Om VECTOR_SIMD anges sker tilldelning, summering och
+*                         skning via funktionerna i int_simd.h, vilket endast
+*                         r mjligt fr int.
+*
+*                         Samtliga makron odefinieras efter inkluderingen.
+********************************************************************************/
+#if !defined(VECTOR_NAME) || !defined(VECTOR_TYPE) || !defined(VECTOR_SUM_TYPE) || \
+    !defined(VECTOR_LINES) || !defined(VECTOR_MAX_LINE)
+#error "VECTOR_NAME, VECTOR_TYPE, VECTOR_SUM_TYPE, VECTOR_LINES och VECTOR_MAX_LINE mste definieras!"
+#endif
+
+#if !defined(VECTOR_FLOATING) && !defined(VECTOR_UNSIGNED_TYPE)
+#error "Antingen VECTOR_FLOATING eller VECTOR_UNSIGNED_TYPE mste definieras!"
+#endif
+
+#include <stdint.h> /* Innehller SIZE_MAX. */
+#include <string.h> /* Innehller memcpy och memmove. */
+
+#include "int_format.h"
+
+/********************************************************************************
+* VECTOR_SMALL: Returnerar antalet element som ryms i angiven vektors inbyggda
+*               buffert.
+********************************************************************************/
+#define VECTOR_SMALL(self) (sizeof((self)->small_buffer) / sizeof((self)->small_buffer[0]))
+
+/********************************************************************************
+* VECTOR_SUM_BLOCK: Antalet 8- eller 16-bitars element som summeras till en
+*                   int t gngen, vilket ryms utan verslag eftersom
+*                   65536 * 32767 understiger INT_MAX.
+********************************************************************************/
+#define VECTOR_SUM_BLOCK 65536
+
+/* Statiska variabler: */
+static double growth_factor = INT_VECTOR_GROWTH_FACTOR;       /* Tillvxtfaktor. */
+static double shrink_threshold = INT_VECTOR_SHRINK_THRESHOLD; /* Lgvattenmrke. */
+
+/********************************************************************************
+* vector_set_growth_factor: Stter tillvxtfaktorn som anvnds nr en vektor
+*                           av aktuell typ behver vxa. Faktorn mste
+*                           verstiga 1.0, annars returneras felkod 1 och
+*                           nuvarande faktor bibehlls. Vid lyckad ndring
+*                           returneras 0.
+*
+*                           - factor: Den nya tillvxtfaktorn.
+********************************************************************************/
+int VECTOR_FN(set_growth_factor)(const double factor)
+{
+   if (!(factor > 1.0)) return 1;
+   growth_factor = factor;
+   return 0;
+}
+
+/********************************************************************************
+* vector_growth_factor: Returnerar tillvxtfaktorn som anvnds nr en vektor
+*                       av aktuell typ behver vxa.
+********************************************************************************/
+double VECTOR_FN(growth_factor)(void)
+{
+   return growth_factor;
+}
+
+/********************************************************************************
+* vector_set_shrink_threshold: Stter lgvattenmrket fr popoperationer.
+*                              Andelen mste ligga i intervallet [0, 0.5),
+*                              annars returneras felkod 1 och nuvarande vrde
+*                              bibehlls. Vid lyckad ndring returneras 0.
+*
+*                              - fraction: Det nya lgvattenmrket.
+********************************************************************************/
+int VECTOR_FN(set_shrink_threshold)(const double fraction)
+{
+   if (!(fraction >= 0.0 && fraction < 0.5)) return 1;
+   shrink_threshold = fraction;
+   return 0;
+}
+
+/********************************************************************************
+* vector_shrink_threshold: Returnerar lgvattenmrket fr popoperationer.
+********************************************************************************/
+double VECTOR_FN(shrink_threshold)(void)
+{
+   return shrink_threshold;
+}
+
+/********************************************************************************
+* vector_realloc: Omallokerar fltet i angiven vektor s att det rymmer exakt
+*                 angivet antal element. Storleken pverkas inte, vilket
+*                 innebr att kapaciteten inte fr understiga storleken.
+*                 Omallokeringen sker via vektorns allokerare. Om angiven
+*                 kapacitet ryms i den inbyggda bufferten flyttas elementen
+*                 dit och kapaciteten stts till buffertens, annars flyttas de
+*                 vid behov frn bufferten till heapen. Vektorer med lnat
+*                 minne kan inte omallokeras. Vid lyckad omallokering
+*                 returneras 0, annars returneras felkod 1 och vektorn lmnas
+*                 intakt.
+*
+*                 - self    : Pekare till vektorn som ska omallokeras.
+*                 - capacity: Vektorns kapacitet efter omallokeringen.
+********************************************************************************/
+static int VECTOR_FN(realloc)(struct VECTOR_NAME* self,
+                              const size_t capacity)
+{
+   VECTOR_TYPE* copy = 0;
+   if (self->borrowed || capacity > SIZE_MAX / sizeof(VECTOR_TYPE)) return 1;
+
+   if (capacity <= VECTOR_SMALL(self))
+   {
+      if (!VECTOR_FN(is_small)(self))
+      {
+         memcpy(self->small_buffer, self->data, sizeof(VECTOR_TYPE) * self->size);
+         allocator_free(self->allocator, self->data, sizeof(VECTOR_TYPE) * self->capacity);
+         INT_VECTOR_STATS_FREE(sizeof(VECTOR_TYPE) * self->capacity);
+         INT_VECTOR_STATS_COPY(sizeof(VECTOR_TYPE) * self->size);
+         self->data = self->small_buffer;
+         self->capacity = VECTOR_SMALL(self);
+      }
+      return 0;
+   }
+
+   if (VECTOR_FN(is_small)(self))
+   {
+      copy = (VECTOR_TYPE*)allocator_alloc(self->allocator, sizeof(VECTOR_TYPE) * capacity);
+      if (!copy) return 1;
+      memcpy(copy, self->data, sizeof(VECTOR_TYPE) * self->size);
+      INT_VECTOR_STATS_ALLOC(sizeof(VECTOR_TYPE) * capacity);
+      INT_VECTOR_STATS_COPY(sizeof(VECTOR_TYPE) * self->size);
+   }
+   else
+   {
+      copy = (VECTOR_TYPE*)allocator_realloc(self->allocator, self->data,
+                                             sizeof(VECTOR_TYPE) * self->capacity,
+                                             sizeof(VECTOR_TYPE) * capacity);
+      if (!copy) return 1;
+      INT_VECTOR_STATS_REALLOC(self->data, copy, sizeof(VECTOR_TYPE) * self->capacity,
+                               sizeof(VECTOR_TYPE) * capacity);
+   }
+
+   self->data = copy;
+   self->capacity = capacity;
+   return 0;
+}
+
+/********************************************************************************
+* vector_grown_capacity: Returnerar ny kapacitet fr angiven vektor nr den
+*                        mste rymma minst angivet antal element. Den
+*                        nuvarande kapaciteten multipliceras med
+*                        tillvxtfaktorn, dock minst till angivet antal samt
+*                        till INT_VECTOR_MIN_CAPACITY.
+*
+*                        - self    : Pekare till vektorn som ska vxa.
+*                        - required: Minsta antal element som ska rymmas.
+********************************************************************************/
+static size_t VECTOR_FN(grown_capacity)(const struct VECTOR_NAME* self,
+                                        const size_t required)
+{
+   const size_t max_capacity = SIZE_MAX / sizeof(VECTOR_TYPE);
+   size_t capacity = max_capacity;
+
+   if ((double)self->capacity < (double)max_capacity / growth_factor)
+   {
+      capacity = (size_t)((double)self->capacity * growth_factor);
+   }
+
+   if (capacity < INT_VECTOR_MIN_CAPACITY) capacity = INT_VECTOR_MIN_CAPACITY;
+   return capacity < required ? required : capacity;
+}
+
+/********************************************************************************
+* vector_shrink_if_sparse: Halverar kapaciteten fr angiven vektor om
+*                          storleken understiger lgvattenmrket, dock aldrig
+*                          under INT_VECTOR_MIN_CAPACITY. Vektorer i den
+*                          inbyggda bufferten krymps inte. En misslyckad
+*                          krympning lmnar vektorn intakt och kan drmed
+*                          ignoreras.
+*
+*                          - self: Pekare till vektorn som ska krympas.
+********************************************************************************/
+static void VECTOR_FN(shrink_if_sparse)(struct VECTOR_NAME* self)
+{
+   if (!VECTOR_FN(is_small)(self) && self->capacity > INT_VECTOR_MIN_CAPACITY &&
+       (double)self->size < (double)self->capacity * shrink_threshold)
+   {
+      const size_t capacity = self->capacity / 2;
+      VECTOR_FN(realloc)(self, capacity < INT_VECTOR_MIN_CAPACITY ?
+                               INT_VECTOR_MIN_CAPACITY : capacity);
+   }
+
+   return;
+}
+
+/********************************************************************************
+* vector_reserve: Skerstller att angiven vektor har kapacitet fr minst
+*                 angivet antal element utan att storleken ndras.
+*
+*                 - self    : Pekare till vektorn.
+*                 - capacity: Minsta kapacitet efter anropet.
+********************************************************************************/
+int VECTOR_FN(reserve)(struct VECTOR_NAME* self,
+                       const size_t capacity)
+{
+   if (self->borrowed) return 1;
+   if (capacity <= self->capacity) return 0;
+   return VECTOR_FN(realloc)(self, capacity);
+}
+
+/********************************************************************************
+* vector_shrink_to_fit: Minskar kapaciteten fr angiven vektor till dess
+*                       storlek s att outnyttjat minne frigrs.
+*
+*                       - self: Pekare till vektorn.
+********************************************************************************/
+int VECTOR_FN(shrink_to_fit)(struct VECTOR_NAME* self)
+{
+   if (self->borrowed) return 1;
+   if (self->size == self->capacity) return 0;
+
+   if (self->size == 0)
+   {
+      VECTOR_FN(clear)(self);
+      return 0;
+   }
+   else
+   {
+      return VECTOR_FN(realloc)(self, self->size);
+   }
+}
+
+/********************************************************************************
+* vector_resize: ndrar storleken p angiven dynamisk vektor. Omallokering sker
+*                endast om den nya storleken verstiger kapaciteten.
+*
+*                - self: Pekare till den vektor vars storlek ska ndras.
+*                - size: Vektorns storlek efter omallokeringen.
+********************************************************************************/
+int VECTOR_FN(resize)(struct VECTOR_NAME* self,
+                      const size_t size)
+{
+   if (self->borrowed) return 1;
+
+   if (size == 0)
+   {
+      VECTOR_FN(clear)(self);
+      return 0;
+   }
+   else
+   {
+      if (size > self->capacity &&
+          VECTOR_FN(realloc)(self, VECTOR_FN(grown_capacity)(self, size))) return 1;
+      self->size = size;
+      return 0;
+   }
+}
+
+/********************************************************************************
+* vector_push: Lgger till ett nytt element lngst bak i angiven vektor.
+*
+*              - self: Pekare till vektorn som ska tilldelas det nya elementet.
+*              - num : Det nya element som ska lggas till.
+********************************************************************************/
+int VECTOR_FN(push)(struct VECTOR_NAME* self,
+                    const VECTOR_TYPE num)
+{
+   if (self->borrowed) return 1;
+   if (self->size >= self->capacity &&
+       VECTOR_FN(realloc)(self, VECTOR_FN(grown_capacity)(self, self->size + 1))) return 1;
+   self->data[self->size++] = num;
+   return 0;
+}
+
+/********************************************************************************
+* vector_pop: Tar bort sista elementet i angiven vektor och krymper
+*             kapaciteten frst nr storleken understiger lgvattenmrket.
+*
+*             - self: Pekare till vektorn vars sista element ska tas bort.
+********************************************************************************/
+int VECTOR_FN(pop)(struct VECTOR_NAME* self)
+{
+   if (self->borrowed) return 1;
+   if (self->size == 0) return 0;
+   self->size--;
+   VECTOR_FN(shrink_if_sparse)(self);
+   return 0;
+}
+
+/********************************************************************************
+* vector_append: Lgger till angivet antal element frn ett godtyckligt flt
+*                lngst bak i angiven vektor.
+*
+*                - self: Pekare till vektorn som ska tilldelas elementen.
+*                - src : Pekare till fltet som elementen kopieras frn.
+*                - n   : Antalet element som ska lggas till.
+********************************************************************************/
+int VECTOR_FN(append)(struct VECTOR_NAME* self,
+                      const VECTOR_TYPE* src,
+                      const size_t n)
+{
+   return VECTOR_FN(insert_range)(self, self->size, src, n);
+}
+
+/********************************************************************************
+* vector_insert_range: Infogar angivet antal element frn ett godtyckligt flt
+*                      p angiven position i angiven vektor.
+*
+*                      - self: Pekare till vektorn.
+*                      - pos : Index dr det frsta elementet ska infogas.
+*                      - src : Pekare till fltet som elementen kopieras frn.
+*                      - n   : Antalet element som ska infogas.
+********************************************************************************/
+int VECTOR_FN(insert_range)(struct VECTOR_NAME* self,
+                            const size_t pos,
+                            const VECTOR_TYPE* src,
+                            const size_t n)
+{
+   const int aliased = src >= self->data && src < self->data + self->size;
+   const size_t offset = aliased ? (size_t)(src - self->data) : 0;
+
+   if (self->borrowed || pos > self->size || n > SIZE_MAX - self->size) return 1;
+   if (n == 0) return 0;
+
+   if (self->size + n > self->capacity &&
+       VECTOR_FN(realloc)(self, VECTOR_FN(grown_capacity)(self, self->size + n))) return 1;
+
+   memmove(self->data + pos + n, self->data + pos, sizeof(VECTOR_TYPE) * (self->size - pos));
+
+   if (!aliased)
+   {
+      memcpy(self->data + pos, src, sizeof(VECTOR_TYPE) * n);
+   }
+   else if (offset + n <= pos)
+   {
+      memcpy(self->data + pos, self->data + offset, sizeof(VECTOR_TYPE) * n);
+   }
+   else if (offset >= pos)
+   {
+      memcpy(self->data + pos, self->data + offset + n, sizeof(VECTOR_TYPE) * n);
+   }
+   else
+   {
+      /* Kllan omsluter positionen, endast dess bakre del har flyttats. */
+      const size_t front = pos - offset;
+      memcpy(self->data + pos, self->data + offset, sizeof(VECTOR_TYPE) * front);
+      memcpy(self->data + pos + front, self->data + pos + n, sizeof(VECTOR_TYPE) * (n - front));
+   }
+
+   self->size += n;
+   return 0;
+}
+
+/********************************************************************************
+* vector_erase_range: Tar bort elementen i det halvppna intervallet
+*                     [first, last) frn angiven vektor.
+*
+*                     - self : Pekare till vektorn.
+*                     - first: Index fr det frsta elementet som tas bort.
+*                     - last : Index efter det sista elementet som tas bort.
+********************************************************************************/
+int VECTOR_FN(erase_range)(struct VECTOR_NAME* self,
+                           const size_t first,
+                           const size_t last)
+{
+   if (self->borrowed || first > last || last > self->size) return 1;
+   if (first == last) return 0;
+   memmove(self->data + first, self->data + last, sizeof(VECTOR_TYPE) * (self->size - last));
+   self->size -= last - first;
+   VECTOR_FN(shrink_if_sparse)(self);
+   return 0;
+}
+
+/********************************************************************************
+* vector_concat: Lgger till samtliga element i en vektor lngst bak i en
+*                annan vektor.
+*
+*                - dst: Pekare till vektorn som ska tilldelas elementen.
+*                - src: Pekare till vektorn vars element ska kopieras.
+********************************************************************************/
+int VECTOR_FN(concat)(struct VECTOR_NAME* dst,
+                      const struct VECTOR_NAME* src)
+{
+   return VECTOR_FN(append)(dst, src->data, src->size);
+}
+
+/********************************************************************************
+* vector_assign: Tilldelar element till angiven vektor med godtyckligt start-
+*                och stegvrde. Heltal berknas i motsvarande teckenlsa typ,
+*                s att verslag ger tvkomplementsomslag i stllet fr
+*                odefinierat beteende. Flyttal berknas som startvrdet plus
+*                index gnger stegvrdet, s att avrundningsfel inte ackumuleras.
+*
+*                - self     : Pekare till vektorn som ska tilldelas.
+*                - start_val: Startvrde fr tilldelningen.
+*                - step_val : Stegvrde, dvs. differensen mellan varje element.
+********************************************************************************/
+void VECTOR_FN(assign)(struct VECTOR_NAME* self,
+                       const VECTOR_TYPE start_val,
+                       const VECTOR_TYPE step_val)
+{
+   if (self->borrowed) return;
+#if defined(VECTOR_SIMD)
+   VECTOR_SIMD(assign)(self->data, self->size, start_val, step_val);
+#elif defined(VECTOR_FLOATING)
+   for (size_t i = 0; i < self->size; ++i)
+   {
+      self->data[i] = (VECTOR_TYPE)(start_val + (VECTOR_TYPE)i * step_val);
+   }
+#else
+   VECTOR_UNSIGNED_TYPE value = (VECTOR_UNSIGNED_TYPE)start_val;
+
+   for (size_t i = 0; i < self->size; ++i)
+   {
+      self->data[i] = (VECTOR_TYPE)value;
+      value = (VECTOR_UNSIGNED_TYPE)(value + (VECTOR_UNSIGNED_TYPE)step_val);
+   }
+#endif
+   return;
+}
+
+/********************************************************************************
+* vector_sum: Returnerar summan av samtliga element i angiven vektor. Heltal
+*             summeras i ett teckenlst 64-bitars tal, s att summan av
+*             64-bitars element slr om i stllet fr att ge odefinierat
+*             beteende, och flyttal summeras i dubbel precision.
+*
+*             - self: Pekare till vektorn.
+********************************************************************************/
+VECTOR_SUM_TYPE VECTOR_FN(sum)(const struct VECTOR_NAME* self)
+{
+#if defined(VECTOR_SIMD)
+   return VECTOR_SIMD(sum)(self->data, self->size);
+#elif defined(VECTOR_FLOATING)
+   double sum = 0.0;
+   for (size_t i = 0; i < self->size; ++i)
+   {
+      sum += self->data[i];
+   }
+   return (VECTOR_SUM_TYPE)sum;
+#else
+   unsigned long long sum = 0;
+   size_t i = 0;
+
+   if (sizeof(VECTOR_TYPE) <= sizeof(short))
+   {
+      /* Smala element summeras i block om VECTOR_SUM_BLOCK element till en
+         int, som inte kan sl ver, vilket kompilatorn kan vektorisera. */
+      for (; i + VECTOR_SUM_BLOCK <= self->size; i += VECTOR_SUM_BLOCK)
+      {
+         int block = 0;
+         for (size_t j = 0; j < VECTOR_SUM_BLOCK; ++j) block += self->data[i + j];
+         sum += (unsigned long long)(long long)block;
+      }
+   }
+
+   for (; i < self->size; ++i)
+   {
+      sum += (unsigned long long)(long long)self->data[i];
+   }
+   return (VECTOR_SUM_TYPE)sum;
+#endif
+}
+
+/********************************************************************************
+* vector_minmax: Tilldelar angivna variabler minsta respektive strsta
+*                element i angiven vektor. Om vektorn r tom returneras
+*                felkod 1 och variablerna lmnas ofrndrade.
+*
+*                - self: Pekare till vektorn.
+*                - min : Pekare till variabel fr minsta elementet.
+*                - max : Pekare till variabel fr strsta elementet.
+********************************************************************************/
+int VECTOR_FN(minmax)(const struct VECTOR_NAME* self,
+                      VECTOR_TYPE* min,
+                      VECTOR_TYPE* max)
+{
+#if defined(VECTOR_SIMD)
+   return VECTOR_SIMD(minmax)(self->data, self->size, min, max);
+#else
+   VECTOR_TYPE low, high;
+   if (self->size == 0) return 1;
+   low = high = self->data[0];
+
+   for (size_t i = 1; i < self->size; ++i)
+   {
+      if (self->data[i] < low) low = self->data[i];
+      if (self->data[i] > high) high = self->data[i];
+   }
+
+   *min = low;
+   *max = high;
+   return 0;
+#endif
+}
+
+/********************************************************************************
+* vector_count_eq: Returnerar antalet element i angiven vektor som r lika med
+*                  angivet vrde.
+*
+*                  - self : Pekare till vektorn.
+*                  - value: Vrdet som ska rknas.
+********************************************************************************/
+size_t VECTOR_FN(count_eq)(const struct VECTOR_NAME* self,
+                           const VECTOR_TYPE value)
+{
+#if defined(VECTOR_SIMD)
+   return VECTOR_SIMD(count_eq)(self->data, self->size, value);
+#else
+   size_t count = 0;
+   for (size_t i = 0; i < self->size; ++i)
+   {
+      count += self->data[i] == value;
+   }
+   return count;
+#endif
+}
+
+/********************************************************************************
+* vector_count_range: Returnerar antalet element i angiven vektor som ligger i
+*                     det slutna intervallet [low, high].
+*
+*                     - self: Pekare till vektorn.
+*                     - low : Intervallets undre grns (inklusive).
+*                     - high: Intervallets vre grns (inklusive).
+********************************************************************************/
+size_t VECTOR_FN(count_range)(const struct VECTOR_NAME* self,
+                              const VECTOR_TYPE low,
+                              const VECTOR_TYPE high)
+{
+#if defined(VECTOR_SIMD)
+   return VECTOR_SIMD(count_range)(self->data, self->size, low, high);
+#else
+   size_t count = 0;
+   for (size_t i = 0; i < self->size; ++i)
+   {
+      count += self->data[i] >= low && self->data[i] <= high;
+   }
+   return count;
+#endif
+}
+
+/********************************************************************************
+* vector_find: Returnerar adressen till frsta elementet i angiven vektor som
+*              r lika med angivet vrde. Om vrdet saknas returneras null.
+*
+*              - self : Pekare till vektorn.
+*              - value: Vrdet som ska skas efter.
+********************************************************************************/
+VECTOR_TYPE* VECTOR_FN(find)(const struct VECTOR_NAME* self,
+                             const VECTOR_TYPE value)
+{
+#if defined(VECTOR_SIMD)
+   const size_t index = VECTOR_SIMD(find)(self->data, self->size, value);
+   return index < self->size ? self->data + index : 0;
+#else
+   for (size_t i = 0; i < self->size; ++i)
+   {
+      if (self->data[i] == value) return self->data + i;
+   }
+   return 0;
+#endif
+}
+
+/********************************************************************************
+* vector_format_lines: Anpassar elementtypens formaterare till
+*                      int_format_lines_fn.
+*
+*                      - s   : Pekare till bufferten som ska tilldelas tecknen.
+*                      - data: Pekare till fltet som ska formateras.
+*                      - size: Antalet element som ska formateras.
+********************************************************************************/
+static size_t VECTOR_FN(format_lines)(char* s,
+                                      const void* data,
+                                      const size_t size)
+{
+   return VECTOR_LINES(s, (const VECTOR_TYPE*)data, size);
+}
+
+/********************************************************************************
+* vector_print: Skriver ut elementen i angiven vektor via godtycklig utstrm,
+*               dr standardutenheten stdout anvnds som default.
+*
+*               - self   : Pekare till vektorn som ska skrivas ut.
+*               - ostream: Pekare till godtycklig utstrm (default = stdout).
+********************************************************************************/
+void VECTOR_FN(print)(const struct VECTOR_NAME* self,
+                      FILE* ostream)
+{
+   int_format_print_with(self->data, self->size, sizeof(VECTOR_TYPE), VECTOR_MAX_LINE,
+                         VECTOR_FN(format_lines), ostream, 0, 0);
+   return;
+}
+
+#undef VECTOR_SMALL
+#undef VECTOR_SUM_BLOCK
+#undef VECTOR_NAME
+#undef VECTOR_TYPE
+#undef VECTOR_SUM_TYPE
+#undef VECTOR_LINES
+#undef VECTOR_MAX_LINE
+#undef VECTOR_UNSIGNED_TYPE
+#undef VECTOR_FLOATING
+#undef VECTOR_SIMD
\ No newline at end of file